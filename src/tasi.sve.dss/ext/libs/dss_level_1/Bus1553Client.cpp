@@ -0,0 +1,252 @@
+/******************************************************************************
+
+    PROJECT:      DSS - S/C Dynamics Simulation Software
+    FILE:         Bus1553Client.cpp
+    RELEASE:      0.01
+    AUTHOR:       DSS Team
+    DATE:         2026/10/19
+
+    OVERVIEW
+    ========
+    Source Code for the BUS 1553 Client (external Bus Controller side of
+    the local IPC endpoint)
+
+    CHANGE LOG
+    ==========
+
+******************************************************************************/
+
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include "Bus1553Client.h"
+
+//-------------------------------------------------------------------------
+Bus1553Client::Bus1553Client ()
+//-------------------------------------------------------------------------
+{
+   shared          = NULL;
+   client_socket   = -1;
+   sequence        = 0;
+   response        = NULL;
+   round_trip_time = 0.0;
+}
+
+//-------------------------------------------------------------------------
+Bus1553Client::~Bus1553Client ()
+//-------------------------------------------------------------------------
+{
+   Disconnect ();
+}
+
+//-------------------------------------------------------------------------
+typ_return Bus1553Client::Connect (const char *endpoint_name, Bus1553Ipc::typ_transport transport)
+//-------------------------------------------------------------------------
+{
+   struct sockaddr_un   address;
+   struct stat          status;
+   char                 shm_name[sizeof(address.sun_path)+1];
+   int                  fd, length;
+
+   Disconnect ();
+   if (!endpoint_name || !*endpoint_name || strlen (endpoint_name) >= sizeof(address.sun_path) - 1)
+      return Error;
+
+   if (transport == Bus1553Ipc::Shared_Memory)
+   {
+      shm_name[0] = '/';
+      strcpy (shm_name+1, endpoint_name);
+      fd = shm_open (shm_name, O_RDWR, 0);
+      if (fd < 0)
+         return Error;
+      if (fstat (fd, &status) == 0 && status.st_size == (off_t) sizeof(Bus1553Ipc::typ_Shared))
+         shared = (Bus1553Ipc::typ_Shared*) mmap (NULL, sizeof(Bus1553Ipc::typ_Shared), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+      close (fd);
+      if (!shared || shared == MAP_FAILED)
+      {
+         shared = NULL;
+         return Error;
+      }
+      if (memcmp (shared->magic, BUS1553_IPC_MAGIC, sizeof(shared->magic))
+       || shared->version != BUS1553_IPC_VERSION
+       || shared->slots != BUS1553_IPC_RING_SLOTS
+       || shared->transaction_size != sizeof(Bus1553Ipc::typ_Transaction))
+      {
+         Disconnect ();
+         return Error;
+      }
+      // The sequence numbers follow the request ring index: the responses of a previous client are discarded
+      __atomic_thread_fence (__ATOMIC_ACQUIRE);
+      sequence = shared->request.head;
+   }
+   else
+   {
+      length        = Bus1553Ipc::Socket_Address (&address, endpoint_name);
+      client_socket = socket (AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+      if (client_socket < 0)
+         return Error;
+      if (connect (client_socket, (struct sockaddr*) &address, length))
+      {
+         Disconnect ();
+         return Error;
+      }
+      response = new Bus1553Ipc::typ_Transaction[BUS1553_IPC_RING_SLOTS];
+   }
+   return Nominal;
+}
+
+//-------------------------------------------------------------------------
+void Bus1553Client::Disconnect ()
+//-------------------------------------------------------------------------
+{
+   if (shared)
+      munmap (shared, sizeof(Bus1553Ipc::typ_Shared));
+   if (client_socket >= 0)
+      close (client_socket);
+   shared        = NULL;
+   client_socket = -1;
+   delete[] response;
+   response      = NULL;
+}
+
+//-------------------------------------------------------------------------
+typ_return Bus1553Client::Transact (Bus1553Ipc::typ_Transaction batch[], int n, double timeout)
+//-------------------------------------------------------------------------
+{
+   double               start = Bus1553Ipc::Clock ();
+   typ_return           result;
+   int                  i;
+
+   if (n < 1 || n > BUS1553_IPC_RING_SLOTS || !Is_Connected ())
+      return Error;
+   for (i = 0; i < n; i++)
+   {
+      batch[i].sequence = sequence + i;
+      batch[i].status   = Bus1553Ipc::Pending;
+   }
+   sequence += n;
+
+   if (shared)
+      result = Transact_Shared_Memory (batch, n, start + timeout);
+   else
+      result = Transact_Socket (batch, n, start + timeout);
+   round_trip_time = Bus1553Ipc::Clock () - start;
+   return result;
+}
+
+//-------------------------------------------------------------------------
+typ_return Bus1553Client::Transact_Shared_Memory (Bus1553Ipc::typ_Transaction batch[], int n, double deadline)
+//-------------------------------------------------------------------------
+{
+   Bus1553Ipc::typ_Ring          *request = &shared->request, *answer = &shared->response;
+   Bus1553Ipc::typ_Transaction   *transaction;
+   unsigned int                  head, tail, index, first = batch[0].sequence;
+   int                           i, received;
+
+   // Submit the batch at once (the ring has room unless a previous batch timed out and is still pending)
+   head = request->head;
+   if (Bus1553Ipc::Ring_Free (request, head) < (unsigned int) n)
+      return Error;
+   for (i = 0; i < n; i++, head++)
+      request->slot[head & (BUS1553_IPC_RING_SLOTS-1)] = batch[i];
+   Bus1553Ipc::Ring_Publish (request, head);
+
+   // Collect the responses, discarding the late ones of a timed out batch
+   tail = answer->tail;
+   for (received = 0; received < n; )
+   {
+      head = Bus1553Ipc::Ring_Wait (answer, tail, deadline - Bus1553Ipc::Clock ());
+      if (head == tail)
+         return Error;
+      for (; tail != head; tail++)
+      {
+         transaction = &answer->slot[tail & (BUS1553_IPC_RING_SLOTS-1)];
+         index       = transaction->sequence - first;
+         if (index < (unsigned int) n)
+         {
+            batch[index] = *transaction;
+            received++;
+         }
+      }
+      __atomic_store_n (&answer->tail, tail, __ATOMIC_RELEASE);
+   }
+   return Nominal;
+}
+
+//-------------------------------------------------------------------------
+typ_return Bus1553Client::Transact_Socket (Bus1553Ipc::typ_Transaction batch[], int n, double deadline)
+//-------------------------------------------------------------------------
+{
+   struct pollfd        descriptor;
+   struct timespec      wait_time;
+   double               remaining;
+   ssize_t              size;
+
+   if (send (client_socket, batch, n * sizeof(Bus1553Ipc::typ_Transaction), MSG_NOSIGNAL) < 0)
+      return Error;
+
+   // Wait for the response message of this batch, discarding the late ones of a timed out batch
+   for (;;)
+   {
+      size = recv (client_socket, response, BUS1553_IPC_RING_SLOTS * sizeof(Bus1553Ipc::typ_Transaction), MSG_DONTWAIT);
+      if (size == (ssize_t) (n * sizeof(Bus1553Ipc::typ_Transaction)) && response[0].sequence == batch[0].sequence)
+         break;
+      if (size == 0 || (size < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+         return Error;
+      if (size > 0)
+         continue;
+      remaining = deadline - Bus1553Ipc::Clock ();
+      if (remaining <= 0.0)
+         return Error;
+      descriptor.fd      = client_socket;
+      descriptor.events  = POLLIN;
+      wait_time.tv_sec   = (time_t) remaining;
+      wait_time.tv_nsec  = (long) ((remaining - wait_time.tv_sec) * 1.0e9);
+      ppoll (&descriptor, 1, &wait_time, NULL);
+   }
+   memcpy (batch, response, n * sizeof(Bus1553Ipc::typ_Transaction));
+   return Nominal;
+}
+
+//-------------------------------------------------------------------------
+void Bus1553Client::Receive_Data (Bus1553Ipc::typ_Transaction *transaction, int rt, int sa, int word_count, const unsigned short *words)
+//-------------------------------------------------------------------------
+{
+   memset (transaction, '\0', sizeof(*transaction));
+   transaction->transaction = Bus1553Ipc::Receive_Data;
+   transaction->rt          = (unsigned char) rt;
+   transaction->sa          = (unsigned char) sa;
+   transaction->word_count  = (unsigned char) word_count;
+   if (words && 0 < word_count && word_count <= 32)
+      memcpy (transaction->words, words, word_count * sizeof(unsigned short));
+}
+
+//-------------------------------------------------------------------------
+void Bus1553Client::Transmit_Data (Bus1553Ipc::typ_Transaction *transaction, int rt, int sa, int word_count)
+//-------------------------------------------------------------------------
+{
+   memset (transaction, '\0', sizeof(*transaction));
+   transaction->transaction = Bus1553Ipc::Transmit_Data;
+   transaction->rt          = (unsigned char) rt;
+   transaction->sa          = (unsigned char) sa;
+   transaction->word_count  = (unsigned char) word_count;
+}
+
+//-------------------------------------------------------------------------
+void Bus1553Client::Mode_Command (Bus1553Ipc::typ_Transaction *transaction, int rt, typ_B1553_TxRx tx_rx, typ_B1553_ModeCode mode_code, unsigned short data_word)
+//-------------------------------------------------------------------------
+{
+   memset (transaction, '\0', sizeof(*transaction));
+   transaction->transaction = Bus1553Ipc::Mode_Command;
+   transaction->rt          = (unsigned char) rt;
+   transaction->sa          = (unsigned char) mode_code;
+   transaction->tx_rx       = (unsigned char) tx_rx;
+   transaction->word_count  = (mode_code >= 16) ? 1 : 0;
+   transaction->words[0]    = data_word;
+}
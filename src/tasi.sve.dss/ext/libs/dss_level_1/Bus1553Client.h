@@ -0,0 +1,98 @@
+#if !defined(__Bus1553Client_h) // Use file only if it's not already included.
+#define __Bus1553Client_h
+
+/******************************************************************************
+
+    PROJECT:      DSS - S/C Dynamics Simulation Software
+    FILE:         Bus1553Client.h
+    RELEASE:      0.01
+    AUTHOR:       DSS Team
+    DATE:         2026/10/19
+
+    OVERVIEW
+    ========
+    Header file for the BUS 1553 Client: external Bus Controller side of
+    the local IPC endpoint (see Bus1553Ipc.h), i.e. the stand-in library
+    a flight-software emulator or a test program links to submit its 1553
+    transactions to a running simulator (BUS1553_ENDPOINT Model).
+    It depends on Bus1553Ipc.h and GenericTypes.h only, and can be built
+    outside the simulator:
+
+       g++ -I<dss_level_1> my_bc.cpp <dss_level_1>/Bus1553Client.cpp
+
+    Typical minor frame:
+
+       Bus1553Client::Receive_Data  (&batch[0], 5, 1, 4, words);
+       Bus1553Client::Transmit_Data (&batch[1], 5, 2, 8);
+       if (client.Transact (batch, 2, 0.01) == Nominal && batch[1].status == Bus1553Ipc::Served)
+          ... batch[1].words holds the RT-to-BC data ...
+
+    Only one client at a time shall be connected to an endpoint.
+
+    CHANGE LOG
+    ==========
+
+******************************************************************************/
+
+#include "GenericTypes.h"
+#include "Bus1553Ipc.h"
+
+/**
+* Class definition for the <b>BUS 1553 Client</b> (external Bus Controller side).
+*/
+
+class Bus1553Client
+{
+
+/*-------------------------------------------------------------------------
+   Data declarations
+-------------------------------------------------------------------------*/
+
+private:
+
+   Bus1553Ipc::typ_Shared     *shared;                         //!<  Mapped <b>shared memory segment</b> (Shared_Memory), NULL if not connected
+   int                        client_socket;                   //!<  <b>Connected socket</b> (Socket), -1 if not connected
+   unsigned int               sequence;                        //!<  <b>Sequence number</b> of the next transaction
+   Bus1553Ipc::typ_Transaction *response;                      //!<  Response buffer (Socket)
+
+public:
+
+   double                     round_trip_time;                 //!<  Duration [s] of the last <b>Transact</b> call
+
+/*-------------------------------------------------------------------------
+   Function declarations
+-------------------------------------------------------------------------*/
+
+public:
+
+/** Class <b>Constructor</b>*/
+   Bus1553Client ();
+/** Class <b>Destructor</b>: the client is disconnected*/
+   ~Bus1553Client ();
+
+/** Public Method to <b>connect</b> to the endpoint "name" opened by the simulator*/
+   typ_return                    Connect (const char *endpoint_name /*! <b>Endpoint name</b>*/, Bus1553Ipc::typ_transport transport = Bus1553Ipc::Shared_Memory /*! <b>IPC transport</b>*/);
+/** Public Method to <b>disconnect</b> from the endpoint*/
+   void                          Disconnect ();
+/** Public Method returning true if the client is <b>connected</b>*/
+   inline bool                   Is_Connected ()   {return shared != NULL || client_socket >= 0;};
+/** Public Method to <b>submit a batch</b> of transactions and wait for their responses, copied back into "batch". Returns Error on timeout or broken connection*/
+   typ_return                    Transact (Bus1553Ipc::typ_Transaction batch[] /*! <b>Transactions</b>, [1..BUS1553_IPC_RING_SLOTS]*/, int n /*! Number of the transactions*/, double timeout /*! <b>Timeout</b> [s] on the responses*/);
+
+/** Public Method to build a <b>BC-to-RT</b> transaction*/
+   static void                   Receive_Data (Bus1553Ipc::typ_Transaction *transaction, int rt /*! RT address (31 broadcast)*/, int sa /*! Subaddress*/, int word_count /*! Number of the data words*/, const unsigned short *words /*! Data words*/);
+/** Public Method to build a <b>RT-to-BC</b> transaction*/
+   static void                   Transmit_Data (Bus1553Ipc::typ_Transaction *transaction, int rt /*! RT address*/, int sa /*! Subaddress*/, int word_count /*! Number of the data words*/);
+/** Public Method to build a <b>mode command</b> transaction*/
+   static void                   Mode_Command (Bus1553Ipc::typ_Transaction *transaction, int rt /*! RT address (31 broadcast)*/, typ_B1553_TxRx tx_rx /*! Direction*/, typ_B1553_ModeCode mode_code /*! Mode code*/, unsigned short data_word = 0 /*! Data word (mode codes 16..31 from the BC)*/);
+
+private:
+
+/** Private Method serving "Transact" on the shared memory rings*/
+   typ_return                    Transact_Shared_Memory (Bus1553Ipc::typ_Transaction batch[], int n, double deadline);
+/** Private Method serving "Transact" on the socket*/
+   typ_return                    Transact_Socket (Bus1553Ipc::typ_Transaction batch[], int n, double deadline);
+
+};
+
+#endif // __Bus1553Client_h end
@@ -0,0 +1,292 @@
+/******************************************************************************
+
+    PROJECT:      DSS - S/C Dynamics Simulation Software
+    FILE:         Bus1553Endpoint.cpp
+    RELEASE:      0.01
+    AUTHOR:       DSS Team
+    DATE:         2026/10/19
+
+    OVERVIEW
+    ========
+    Source Code for the BUS 1553 Endpoint (simulator side of the local IPC
+    endpoint)
+
+    CHANGE LOG
+    ==========
+
+******************************************************************************/
+
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "Bus1553Endpoint.h"
+#include "GenericObject.h"
+
+//-------------------------------------------------------------------------
+Bus1553Endpoint::Bus1553Endpoint ()
+//-------------------------------------------------------------------------
+{
+   name[0]       = '\0';
+   transport     = Bus1553Ipc::Shared_Memory;
+   shared        = NULL;
+   listen_socket = -1;
+   client_socket = -1;
+   batch         = NULL;
+   transactions  = 0;
+   batches       = 0;
+   no_responses  = 0;
+   invalid       = 0;
+}
+
+//-------------------------------------------------------------------------
+Bus1553Endpoint::~Bus1553Endpoint ()
+//-------------------------------------------------------------------------
+{
+   Close ();
+}
+
+//-------------------------------------------------------------------------
+typ_return Bus1553Endpoint::Open (const char *endpoint_name, Bus1553Ipc::typ_transport endpoint_transport)
+//-------------------------------------------------------------------------
+{
+   struct sockaddr_un   address;
+   char                 shm_name[sizeof(name)+1];
+   int                  fd, length;
+
+   Close ();
+   if (!endpoint_name || !*endpoint_name || strlen (endpoint_name) >= sizeof(name) || strchr (endpoint_name, '/'))
+      return Error;
+   strcpy (name, endpoint_name);
+   transport = endpoint_transport;
+
+   if (transport == Bus1553Ipc::Shared_Memory)
+   {
+      // A new shared memory object: a stale one left by a crashed run is removed first
+      shm_name[0] = '/';
+      strcpy (shm_name+1, name);
+      shm_unlink (shm_name);
+      fd = shm_open (shm_name, O_RDWR | O_CREAT | O_EXCL, 0600);
+      if (fd < 0)
+         return Error;
+      if (ftruncate (fd, sizeof(Bus1553Ipc::typ_Shared)) == 0)
+         shared = (Bus1553Ipc::typ_Shared*) mmap (NULL, sizeof(Bus1553Ipc::typ_Shared), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+      close (fd);
+      if (!shared || shared == MAP_FAILED)
+      {
+         shared = NULL;
+         shm_unlink (shm_name);
+         return Error;
+      }
+      // The segment is zero-filled (empty rings); the magic is written last to validate it
+      shared->version          = BUS1553_IPC_VERSION;
+      shared->slots            = BUS1553_IPC_RING_SLOTS;
+      shared->transaction_size = sizeof(Bus1553Ipc::typ_Transaction);
+      __atomic_thread_fence (__ATOMIC_RELEASE);
+      memcpy (shared->magic, BUS1553_IPC_MAGIC, sizeof(shared->magic));
+   }
+   else
+   {
+      length        = Bus1553Ipc::Socket_Address (&address, name);
+      listen_socket = socket (AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC | SOCK_NONBLOCK, 0);
+      if (listen_socket < 0)
+         return Error;
+      if (bind (listen_socket, (struct sockaddr*) &address, length) || listen (listen_socket, 1))
+      {
+         close (listen_socket);
+         listen_socket = -1;
+         return Error;
+      }
+      batch = new Bus1553Ipc::typ_Transaction[BUS1553_IPC_RING_SLOTS];
+   }
+   return Nominal;
+}
+
+//-------------------------------------------------------------------------
+void Bus1553Endpoint::Close ()
+//-------------------------------------------------------------------------
+{
+   char                 shm_name[sizeof(name)+1];
+
+   if (shared)
+   {
+      munmap (shared, sizeof(Bus1553Ipc::typ_Shared));
+      shared      = NULL;
+      shm_name[0] = '/';
+      strcpy (shm_name+1, name);
+      shm_unlink (shm_name);
+   }
+   if (client_socket >= 0)
+      close (client_socket);
+   if (listen_socket >= 0)
+      close (listen_socket);
+   client_socket = -1;
+   listen_socket = -1;
+   delete[] batch;
+   batch = NULL;
+}
+
+//-------------------------------------------------------------------------
+int Bus1553Endpoint::Serve (double timeout)
+//-------------------------------------------------------------------------
+{
+   int                  n;
+
+   if (shared)
+      n = Serve_Shared_Memory (timeout);
+   else if (listen_socket >= 0)
+      n = Serve_Socket (timeout);
+   else
+      n = 0;
+   if (n > 0)
+      batches++;
+   return n;
+}
+
+//-------------------------------------------------------------------------
+int Bus1553Endpoint::Serve_Shared_Memory (double timeout)
+//-------------------------------------------------------------------------
+{
+   Bus1553Ipc::typ_Ring *request = &shared->request, *response = &shared->response;
+   unsigned int         request_head, request_tail, response_head, n_free;
+   int                  n = 0;
+
+   request_tail  = request->tail;
+   response_head = response->head;
+   request_head  = Bus1553Ipc::Ring_Wait (request, request_tail, timeout);
+
+   // The requests are answered in order, as long as the response ring has room: a stalled client only delays the service
+   n_free = Bus1553Ipc::Ring_Free (response, response_head);
+   for (; request_tail != request_head && n_free; request_tail++, response_head++, n_free--, n++)
+   {
+      Bus1553Ipc::typ_Transaction *transaction = &response->slot[response_head & (BUS1553_IPC_RING_SLOTS-1)];
+
+      *transaction = request->slot[request_tail & (BUS1553_IPC_RING_SLOTS-1)];
+      Serve_Transaction (transaction);
+   }
+   if (n)
+   {
+      __atomic_store_n (&request->tail, request_tail, __ATOMIC_RELEASE);
+      Bus1553Ipc::Ring_Publish (response, response_head);
+   }
+   return n;
+}
+
+//-------------------------------------------------------------------------
+int Bus1553Endpoint::Serve_Socket (double timeout)
+//-------------------------------------------------------------------------
+{
+   struct pollfd        descriptor;
+   struct timespec      wait_time;
+   double               deadline = Bus1553Ipc::Clock () + timeout, remaining;
+   ssize_t              size;
+   int                  i, n;
+
+   // Accept the client connection (one client at a time)
+   while (client_socket < 0)
+   {
+      client_socket = accept4 (listen_socket, NULL, NULL, SOCK_CLOEXEC);
+      if (client_socket >= 0)
+         break;
+      remaining = deadline - Bus1553Ipc::Clock ();
+      if ((errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) || remaining <= 0.0)
+         return 0;
+      descriptor.fd      = listen_socket;
+      descriptor.events  = POLLIN;
+      wait_time.tv_sec   = (time_t) remaining;
+      wait_time.tv_nsec  = (long) ((remaining - wait_time.tv_sec) * 1.0e9);
+      ppoll (&descriptor, 1, &wait_time, NULL);
+   }
+
+   // Receive one batch
+   for (;;)
+   {
+      size = recv (client_socket, batch, BUS1553_IPC_RING_SLOTS * sizeof(Bus1553Ipc::typ_Transaction), MSG_DONTWAIT);
+      if (size >= 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+         break;
+      remaining = deadline - Bus1553Ipc::Clock ();
+      if (remaining <= 0.0)
+         return 0;
+      descriptor.fd      = client_socket;
+      descriptor.events  = POLLIN;
+      wait_time.tv_sec   = (time_t) remaining;
+      wait_time.tv_nsec  = (long) ((remaining - wait_time.tv_sec) * 1.0e9);
+      ppoll (&descriptor, 1, &wait_time, NULL);
+   }
+   if (size <= 0) // The client has disconnected: wait for the next one
+   {
+      close (client_socket);
+      client_socket = -1;
+      return 0;
+   }
+
+   // Serve the batch and send it back as the response
+   n = (int) (size / sizeof(Bus1553Ipc::typ_Transaction));
+   for (i = 0; i < n; i++)
+      Serve_Transaction (&batch[i]);
+   if (send (client_socket, batch, n * sizeof(Bus1553Ipc::typ_Transaction), MSG_NOSIGNAL) < 0)
+   {
+      close (client_socket);
+      client_socket = -1;
+   }
+   return n;
+}
+
+//-------------------------------------------------------------------------
+void Bus1553Endpoint::Serve_Transaction (Bus1553Ipc::typ_Transaction *transaction)
+//-------------------------------------------------------------------------
+{
+   switch (Execute (transaction))
+   {
+      case Bus1553Ipc::No_Response:
+         no_responses++;
+         break;
+      case Bus1553Ipc::Invalid:
+         invalid++;
+         break;
+      default:
+         break;
+   }
+   transactions++;
+}
+
+//-------------------------------------------------------------------------
+Bus1553Ipc::typ_status Bus1553Endpoint::Execute (Bus1553Ipc::typ_Transaction *transaction)
+//-------------------------------------------------------------------------
+{
+   Bus1553Ipc::typ_Transaction   *t = transaction;
+   bool                          broadcast = (t->rt == B1553_BROADCAST_ADDRES);
+
+   // Same validity rules as the BUS1553_BC schedule entries
+   if (t->transaction == Bus1553Ipc::Mode_Command)
+      t->word_count = (t->sa >= 16) ? 1 : 0; // Mode codes 16..31 have one data word
+   if (t->rt < 1 || t->rt > 31
+    || t->transaction > Bus1553Ipc::Mode_Command
+    || (t->transaction != Bus1553Ipc::Mode_Command && (t->sa < 1 || t->sa > 30 || t->word_count < 1 || t->word_count > 32))
+    || (t->transaction == Bus1553Ipc::Mode_Command && (t->sa > 31 || t->tx_rx > DSS_TX))
+    || (broadcast && (t->transaction == Bus1553Ipc::Transmit_Data || (t->transaction == Bus1553Ipc::Mode_Command && t->tx_rx == DSS_TX && t->word_count))))
+      t->status = Bus1553Ipc::Invalid;
+   else if (!broadcast && !GenericObject::Get_Rt1553 (t->rt))
+      t->status = Bus1553Ipc::No_Response;
+   else
+   {
+      switch (t->transaction)
+      {
+         case Bus1553Ipc::Receive_Data:
+            GenericObject::Bc1553_ReceiveData (t->rt, t->sa, t->word_count, t->words);
+            break;
+         case Bus1553Ipc::Transmit_Data:
+            GenericObject::Bc1553_TransmitData (t->rt, t->sa, t->word_count, t->words);
+            break;
+         default:
+            GenericObject::Bc1553_ReceiveModeCommand (t->rt, (typ_B1553_TxRx) t->tx_rx, (typ_B1553_ModeCode) t->sa, t->words);
+            break;
+      }
+      t->status = Bus1553Ipc::Served;
+   }
+   return (Bus1553Ipc::typ_status) t->status;
+}
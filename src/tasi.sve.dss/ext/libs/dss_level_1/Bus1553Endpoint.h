@@ -0,0 +1,91 @@
+#if !defined(__Bus1553Endpoint_h) // Use file only if it's not already included.
+#define __Bus1553Endpoint_h
+
+/******************************************************************************
+
+    PROJECT:      DSS - S/C Dynamics Simulation Software
+    FILE:         Bus1553Endpoint.h
+    RELEASE:      0.01
+    AUTHOR:       DSS Team
+    DATE:         2026/10/19
+
+    OVERVIEW
+    ========
+    Header file for the BUS 1553 Endpoint: simulator side of the local IPC
+    endpoint (see Bus1553Ipc.h) letting an external Bus Controller, e.g. a
+    flight-software emulator running as a separate process, submit batches
+    of 1553 transactions that are served by the RT dispatch
+    (GenericObject::Bc1553_*).
+    The endpoint is passive: the batches are served only inside "Serve",
+    called on the simulation thread, so that the RT Models are never
+    accessed concurrently with their updating.
+
+    CHANGE LOG
+    ==========
+
+******************************************************************************/
+
+#include "GenericTypes.h"
+#include "Bus1553Ipc.h"
+
+/**
+* Class definition for the <b>BUS 1553 Endpoint</b> (simulator side).
+*/
+
+class Bus1553Endpoint
+{
+
+/*-------------------------------------------------------------------------
+   Data declarations
+-------------------------------------------------------------------------*/
+
+private:
+
+   char                       name[108];                       //!<  <b>Endpoint name</b>
+   Bus1553Ipc::typ_transport  transport;                       //!<  <b>IPC transport</b>
+   Bus1553Ipc::typ_Shared     *shared;                         //!<  Mapped <b>shared memory segment</b> (Shared_Memory), NULL if not open
+   int                        listen_socket;                   //!<  <b>Listening socket</b> (Socket), -1 if not open
+   int                        client_socket;                   //!<  <b>Connected client socket</b> (Socket), -1 if none
+   Bus1553Ipc::typ_Transaction *batch;                         //!<  Batch buffer (Socket)
+
+public:
+
+   unsigned long long         transactions;                    //!<  Number of the <b>served transactions</b>
+   unsigned long long         batches;                         //!<  Number of the <b>served batches</b> (Serve calls having served transactions)
+   unsigned long long         no_responses;                    //!<  Number of the transactions addressed to a not present RT
+   unsigned long long         invalid;                         //!<  Number of the <b>invalid transactions</b>
+
+/*-------------------------------------------------------------------------
+   Function declarations
+-------------------------------------------------------------------------*/
+
+public:
+
+/** Class <b>Constructor</b>*/
+   Bus1553Endpoint ();
+/** Class <b>Destructor</b>: the endpoint is closed*/
+   ~Bus1553Endpoint ();
+
+/** Public Method to <b>open the endpoint</b> "name" (shared memory object "/name", or abstract socket "\0name")*/
+   typ_return                    Open (const char *endpoint_name /*! <b>Endpoint name</b>*/, Bus1553Ipc::typ_transport endpoint_transport = Bus1553Ipc::Shared_Memory /*! <b>IPC transport</b>*/);
+/** Public Method to <b>close the endpoint</b>, removing the shared memory object*/
+   void                          Close ();
+/** Public Method returning true if the endpoint is <b>open</b>*/
+   inline bool                   Is_Open ()        {return shared != NULL || listen_socket >= 0;};
+/** Public Method to <b>serve the pending batches</b>, waiting up to "timeout" for the first transaction. Returns the number of the served transactions*/
+   int                           Serve (double timeout /*! <b>Timeout</b> [s] (0 only serves the pending transactions)*/);
+/** Public Method to <b>execute one transaction</b> against the RT dispatch, setting its status and its RT-to-BC data words. Returns the status*/
+   static Bus1553Ipc::typ_status Execute (Bus1553Ipc::typ_Transaction *transaction /*! <b>Transaction</b>*/);
+
+private:
+
+/** Private Method serving the shared memory rings*/
+   int                           Serve_Shared_Memory (double timeout);
+/** Private Method serving the socket (one batch per call)*/
+   int                           Serve_Socket (double timeout);
+/** Private Method to execute a transaction and update the counters*/
+   void                          Serve_Transaction (Bus1553Ipc::typ_Transaction *transaction);
+
+};
+
+#endif // __Bus1553Endpoint_h end
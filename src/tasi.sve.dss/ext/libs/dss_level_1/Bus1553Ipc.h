@@ -0,0 +1,214 @@
+#if !defined(__Bus1553Ipc_h) // Use file only if it's not already included.
+#define __Bus1553Ipc_h
+
+/******************************************************************************
+
+    PROJECT:      DSS - S/C Dynamics Simulation Software
+    FILE:         Bus1553Ipc.h
+    RELEASE:      0.01
+    AUTHOR:       DSS Team
+    DATE:         2026/10/19
+
+    OVERVIEW
+    ========
+    Protocol of the local BUS 1553 IPC endpoint, shared by the simulator
+    side (Bus1553Endpoint) and the external Bus Controller side
+    (Bus1553Client). This header does not depend on the DSS Objects, so
+    that an external flight-software emulator can include it alone.
+
+    A batch of 1553 transactions is submitted by the client and answered,
+    transaction by transaction and in the same order, by the simulator RT
+    dispatch. Two transports are available:
+
+    - Shared memory (default): a POSIX shared memory object "/<name>"
+      holding a typ_Shared segment, i.e. a request ring (client to
+      simulator) and a response ring (simulator to client) of
+      BUS1553_IPC_RING_SLOTS transactions each. Each ring has a single
+      producer and a single consumer; the producer publishes a batch by
+      advancing "head", the consumer frees it by advancing "tail". A side
+      waiting on an empty ring first spins for BUS1553_IPC_SPIN_TIME, then
+      sleeps on a futex on "head"; the producer issues the futex wake-up
+      only when the "waiting" flag is set, so that a busy consumer costs
+      no system call.
+    - Unix domain socket (fallback): a SOCK_SEQPACKET socket bound to the
+      abstract address "\0<name>"; a batch is one message made of a
+      typ_Transaction array, and it is answered by one message.
+
+    Each transaction carries a "sequence" number, copied in the response,
+    letting the client discard the late responses of a timed out batch.
+
+    CHANGE LOG
+    ==========
+
+******************************************************************************/
+
+#include <time.h>
+#include <limits.h>
+#include <stddef.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/un.h>
+#include <linux/futex.h>
+
+#define  BUS1553_IPC_MAGIC                "DSS1553E"                    //!< <b>Shared segment identifier</b> (8 characters)
+#define  BUS1553_IPC_VERSION              1                             //!< <b>Protocol version</b>
+#define  BUS1553_IPC_RING_SLOTS           256                           //!< Number of the <b>transactions of a ring</b> (power of two), i.e. the maximum batch size
+#define  BUS1553_IPC_SPIN_TIME            20.0e-6                       //!< <b>Spin time</b> [s] on an empty ring before sleeping on the futex
+
+/**
+* Class definition for the <b>BUS 1553 IPC protocol</b> (data types and ring primitives only).
+*/
+
+class Bus1553Ipc
+{
+
+/*-------------------------------------------------------------------------
+   Data Type declarations
+-------------------------------------------------------------------------*/
+
+public:
+
+   enum typ_transport      /** <b>IPC transport</b> */
+   {
+      Shared_Memory = 0,                     //!< Shared memory ring pair with futex wake-ups
+      Socket                                 //!< Unix domain (SOCK_SEQPACKET) socket fallback
+   };
+
+   enum typ_transaction    /** <b>Transaction type</b> */
+   {
+      Receive_Data = 0,                      //!< BC-to-RT data transaction (Bc1553_ReceiveData)
+      Transmit_Data,                         //!< RT-to-BC data transaction (Bc1553_TransmitData)
+      Mode_Command                           //!< Mode command (Bc1553_ReceiveModeCommand), "sa" is the mode code
+   };
+
+   enum typ_status         /** <b>Transaction status</b>, set by the simulator */
+   {
+      Pending = 0,                           //!< Not yet served
+      Served,                                //!< Served by the RT dispatch (broadcast included)
+      No_Response,                           //!< No RT at the address
+      Invalid                                //!< Invalid transaction (type, address, subaddress or word count)
+   };
+
+   struct typ_Transaction  /** Data structure type of a <b>1553 transaction</b> (76 bytes) */
+   {
+      unsigned int      sequence;            //!< <b>Sequence number</b>, set by the client and copied in the response
+      unsigned char     transaction;         //!< <b>Transaction type</b> (typ_transaction)
+      unsigned char     rt;                  //!< <b>RT address</b> (31 broadcast)
+      unsigned char     sa;                  //!< <b>Subaddress</b>, or <b>mode code</b>
+      unsigned char     tx_rx;               //!< Mode command direction (DSS_RX/DSS_TX)
+      unsigned char     word_count;          //!< Number of the <b>data words</b> [1..32] (mode commands: 0 or 1)
+      unsigned char     status;              //!< <b>Transaction status</b> (typ_status)
+      unsigned char     spare[2];            //!< Spare (alignment)
+      unsigned short    words[32];           //!< <b>Data words</b>: BC-to-RT data in the request, RT-to-BC data in the response
+   };
+
+   struct typ_Ring         /** Data structure type of a <b>transaction ring</b> */
+   {
+      unsigned int      head;                //!< Transactions written so far (producer side)
+      char              pad_head[60];        //!< Keeps "head", "tail" and "waiting" on different cache lines
+      unsigned int      tail;                //!< Transactions read so far (consumer side)
+      char              pad_tail[60];        //!< Keeps "head", "tail" and "waiting" on different cache lines
+      unsigned int      waiting;             //!< Flag set by the consumer sleeping on the "head" futex
+      char              pad_waiting[60];     //!< Keeps "head", "tail" and "waiting" on different cache lines
+      typ_Transaction   slot[BUS1553_IPC_RING_SLOTS];    //!< Transactions
+   };
+
+   struct typ_Shared       /** Data structure type of the <b>shared memory segment</b> */
+   {
+      char              magic[8];            //!< BUS1553_IPC_MAGIC, written last by the simulator
+      unsigned int      version;             //!< BUS1553_IPC_VERSION
+      unsigned int      slots;               //!< BUS1553_IPC_RING_SLOTS
+      unsigned int      transaction_size;    //!< sizeof(typ_Transaction)
+      char              pad[44];             //!< Keeps the rings cache line aligned
+      typ_Ring          request;             //!< <b>Request ring</b> (client to simulator)
+      typ_Ring          response;            //!< <b>Response ring</b> (simulator to client)
+   };
+
+/*-------------------------------------------------------------------------
+   Function declarations
+-------------------------------------------------------------------------*/
+
+public:
+
+/** Public Method returning the <b>monotonic clock</b> [s]*/
+   static inline double          Clock ()
+   {
+      struct timespec   now;
+
+      clock_gettime (CLOCK_MONOTONIC, &now);
+      return now.tv_sec + now.tv_nsec * 1.0e-9;
+   };
+
+/** Public Method [producer side] returning the number of the <b>free slots</b> of a ring*/
+   static inline unsigned int    Ring_Free (typ_Ring *ring, unsigned int head /*! Producer "head"*/)
+   {
+      return BUS1553_IPC_RING_SLOTS - (head - __atomic_load_n (&ring->tail, __ATOMIC_ACQUIRE));
+   };
+
+/** Public Method [producer side] to <b>publish</b> the slots written up to "head", waking the consumer up if it is sleeping*/
+   static inline void            Ring_Publish (typ_Ring *ring, unsigned int head /*! New producer "head"*/)
+   {
+      __atomic_store_n (&ring->head, head, __ATOMIC_SEQ_CST);
+      if (__atomic_load_n (&ring->waiting, __ATOMIC_SEQ_CST))
+         syscall (SYS_futex, &ring->head, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+   };
+
+/** Public Method [consumer side] to <b>wait</b> for at least one slot after "tail" (spin, then futex sleep). Returns the producer "head" (equal to "tail" on timeout)*/
+   static inline unsigned int    Ring_Wait (typ_Ring *ring, unsigned int tail /*! Consumer "tail"*/, double timeout /*! Timeout [s] (0 polls the ring)*/)
+   {
+      static const bool spin_flag = (sysconf (_SC_NPROCESSORS_ONLN) > 1); // Spinning on a single CPU only delays the producer
+      struct timespec   sleep_time;
+      unsigned int      head;
+      double            start, now, deadline, spin_end;
+
+      head = __atomic_load_n (&ring->head, __ATOMIC_ACQUIRE);
+      if (head != tail || timeout <= 0.0)
+         return head;
+
+      start    = Clock ();
+      deadline = start + timeout;
+      spin_end = spin_flag ? start + ((timeout < BUS1553_IPC_SPIN_TIME) ? timeout : BUS1553_IPC_SPIN_TIME) : start;
+      do
+      {
+         head = __atomic_load_n (&ring->head, __ATOMIC_ACQUIRE);
+         if (head != tail)
+            return head;
+         now = Clock ();
+      } while (now < spin_end);
+
+      while (now < deadline)
+      {
+         __atomic_store_n (&ring->waiting, 1, __ATOMIC_SEQ_CST);
+         head = __atomic_load_n (&ring->head, __ATOMIC_SEQ_CST);
+         if (head != tail)
+            break;
+         sleep_time.tv_sec  = (time_t) (deadline - now);
+         sleep_time.tv_nsec = (long) ((deadline - now - sleep_time.tv_sec) * 1.0e9);
+         syscall (SYS_futex, &ring->head, FUTEX_WAIT, tail, &sleep_time, NULL, 0);
+         head = __atomic_load_n (&ring->head, __ATOMIC_ACQUIRE);
+         if (head != tail)
+            break;
+         now = Clock ();
+      }
+      __atomic_store_n (&ring->waiting, 0, __ATOMIC_RELAXED);
+      return head;
+   };
+
+/** Public Method to fill the <b>abstract socket address</b> "\0<name>" of an endpoint; it returns the address length*/
+   static inline int             Socket_Address (struct sockaddr_un *address /*! Socket address*/, const char *name /*! Endpoint name*/)
+   {
+      int               length = (int) strlen (name);
+
+      if (length > (int) sizeof(address->sun_path) - 1)
+         length = (int) sizeof(address->sun_path) - 1;
+      memset (address, 0, sizeof(*address));
+      address->sun_family = AF_UNIX;
+      memcpy (address->sun_path + 1, name, length);
+      return (int) offsetof(struct sockaddr_un, sun_path) + 1 + length;
+   };
+
+};
+
+#endif // __Bus1553Ipc_h end
@@ -0,0 +1,166 @@
+/******************************************************************************
+
+    PROJECT:      DSS - S/C Dynamics Simulation Software
+    FILE:         Bus1553Recorder.cpp
+    RELEASE:      0.01
+    AUTHOR:       DSS Team
+    DATE:         2026/10/19
+
+    OVERVIEW
+    ========
+    Source Code for the binary BUS 1553 traffic Recorder
+
+    CHANGE LOG
+    ==========
+
+******************************************************************************/
+
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "Bus1553Recorder.h"
+
+#define  CHUNK_BYTES    ((off_t)BUS1553_RECORDER_CHUNK_RECORDS * sizeof(typ_Record))
+
+//-------------------------------------------------------------------------
+Bus1553Recorder::Bus1553Recorder ()
+//-------------------------------------------------------------------------
+{
+   fd          = -1;
+   header      = NULL;
+   chunk       = NULL;
+   chunk_first = 0;
+   n_records   = 0;
+   rt_mask     = 0;
+   sa_mask     = 0;
+   n_models    = 0;
+}
+
+//-------------------------------------------------------------------------
+Bus1553Recorder::~Bus1553Recorder ()
+//-------------------------------------------------------------------------
+{
+   Close ();
+}
+
+//-------------------------------------------------------------------------
+typ_return Bus1553Recorder::Open (const char *file_name, unsigned int rt_mask_filter, unsigned int sa_mask_filter)
+//-------------------------------------------------------------------------
+{
+   void     *map;
+
+   Close ();
+   fd = open (file_name, O_RDWR | O_CREAT | O_TRUNC, 0644);
+   if (fd < 0)
+      return Error;
+
+// Map the header page
+   if (ftruncate (fd, BUS1553_RECORDER_HEADER_SIZE)
+    || (map = mmap (NULL, BUS1553_RECORDER_HEADER_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)) == MAP_FAILED)
+   {
+      close (fd);
+      fd = -1;
+      return Error;
+   }
+   header = (typ_Header*) map;
+   memcpy (header->magic, BUS1553_RECORDER_MAGIC, 8);
+   header->version     = BUS1553_RECORDER_VERSION;
+   header->record_size = sizeof(typ_Record);
+   header->rt_mask     = rt_mask     = rt_mask_filter;
+   header->sa_mask     = sa_mask     = sa_mask_filter;
+   header->n_records   = n_records   = 0;
+   chunk_first = 0;
+   n_models    = 0;
+   return Nominal;
+}
+
+//-------------------------------------------------------------------------
+void Bus1553Recorder::Close ()
+//-------------------------------------------------------------------------
+{
+   if (fd < 0)
+      return;
+   Unmap_Chunk ();
+   munmap (header, BUS1553_RECORDER_HEADER_SIZE);
+   header = NULL;
+   if (ftruncate (fd, BUS1553_RECORDER_HEADER_SIZE + n_records * sizeof(typ_Record))) // Drop the not used part of the last chunk
+   {
+      // Not fatal: the reader stops at "n_records" anyway
+   }
+   close (fd);
+   fd = -1;
+}
+
+//-------------------------------------------------------------------------
+void Bus1553Recorder::Unmap_Chunk ()
+//-------------------------------------------------------------------------
+{
+   if (chunk)
+      munmap (chunk, CHUNK_BYTES);
+   chunk = NULL;
+}
+
+//-------------------------------------------------------------------------
+Bus1553Recorder::typ_Record* Bus1553Recorder::Next_Record ()
+//-------------------------------------------------------------------------
+{
+   off_t    offset;
+   void     *map;
+
+   if (chunk && n_records < chunk_first + BUS1553_RECORDER_CHUNK_RECORDS)
+      return chunk + (n_records - chunk_first);
+
+// Extend the file and map the next chunk
+   Unmap_Chunk ();
+   chunk_first = n_records;
+   offset      = BUS1553_RECORDER_HEADER_SIZE + (off_t)(chunk_first / BUS1553_RECORDER_CHUNK_RECORDS) * CHUNK_BYTES;
+   if (ftruncate (fd, offset + CHUNK_BYTES)
+    || (map = mmap (NULL, CHUNK_BYTES, PROT_READ | PROT_WRITE, MAP_SHARED, fd, offset)) == MAP_FAILED)
+      return NULL;
+   chunk = (typ_Record*) map;
+   return chunk;
+}
+
+//-------------------------------------------------------------------------
+void Bus1553Recorder::Record (double time, const void *model, const char *model_name, typ_transaction transaction, int rt, int sa, int tx_rx, int word_count, typ_return status, const unsigned short words[32])
+//-------------------------------------------------------------------------
+{
+   typ_Record     *record;
+   int            index;
+
+   if (fd < 0)
+      return;
+
+// Name the Model at its first transaction
+   for (index = 0; index < n_models && model_key[index] != model; index++)
+      ;
+   if (index == n_models)
+   {
+      if (n_models == BUS1553_RECORDER_MAX_MODELS || !(record = Next_Record ()))
+         return;
+      memset (record, '\0', sizeof(typ_Record));
+      record->time        = time;
+      record->model       = (unsigned short) index;
+      record->transaction = Model_Name;
+      strncpy ((char*)record->words, model_name, sizeof(record->words)-1);
+      model_key[n_models++] = model;
+      header->n_records = ++n_records;
+   }
+
+   if (!(record = Next_Record ()))
+      return;
+   if (word_count < 0)  word_count = 0;
+   if (word_count > 32) word_count = 32;
+   record->time        = time;
+   record->model       = (unsigned short) index;
+   record->transaction = (unsigned char) transaction;
+   record->rt          = (unsigned char) rt;
+   record->sa          = (unsigned char) sa;
+   record->tx_rx       = (unsigned char) tx_rx;
+   record->word_count  = (unsigned char) word_count;
+   record->status      = (unsigned char) status;
+   memcpy (record->words, words, word_count*sizeof(unsigned short));
+   memset (record->words + word_count, '\0', (32-word_count)*sizeof(unsigned short));
+   header->n_records = ++n_records; // The record is valid
+}
@@ -0,0 +1,136 @@
+#if !defined(__Bus1553Recorder_h) // Use file only if it's not already included.
+#define __Bus1553Recorder_h
+
+/******************************************************************************
+
+    PROJECT:      DSS - S/C Dynamics Simulation Software
+    FILE:         Bus1553Recorder.h
+    RELEASE:      0.01
+    AUTHOR:       DSS Team
+    DATE:         2026/10/19
+
+    OVERVIEW
+    ========
+    Header file for the binary BUS 1553 traffic Recorder.
+    Each transaction is appended as a fixed-size record (simulation time,
+    RT, subaddress/mode code, direction, word count, 32 data words, RT
+    handler status) into a memory-mapped file, mapped and extended one
+    chunk at a time. The number of the valid records is kept in the mapped
+    file header at each record, so the capture survives a SW crash.
+    The RT and subaddress masks select the recorded transactions; the
+    mode commands are recorded when the subaddress mask bit 31 (mode code
+    field) is set.
+    The Model names are written once, as MODEL_NAME records, and then
+    referenced by index. The "bus1553_decode" tool (tools directory)
+    converts the file into the 1553 text dump format.
+
+    FILE LAYOUT
+    ===========
+       [0, BUS1553_RECORDER_HEADER_SIZE)   typ_Header
+       [BUS1553_RECORDER_HEADER_SIZE, ...) typ_Record array
+
+    CHANGE LOG
+    ==========
+
+******************************************************************************/
+
+#include "GenericTypes.h"
+
+#define  BUS1553_RECORDER_MAGIC           "DSS1553R"                    //!< <b>File identifier</b> (8 characters)
+#define  BUS1553_RECORDER_VERSION         1                             //!< <b>File format version</b>
+#define  BUS1553_RECORDER_HEADER_SIZE     4096                          //!< Size of the <b>file header</b> (one page, the records start page-aligned)
+#define  BUS1553_RECORDER_CHUNK_RECORDS   4096                          //!< Number of the records of a <b>mapped chunk</b> (the chunk size is a multiple of the page size)
+#define  BUS1553_RECORDER_MAX_MODELS      1024                          //!< Maximum number of the <b>named Models</b> in a recording
+
+/**
+* Class definition for the <b>binary BUS 1553 traffic Recorder</b>.
+*/
+
+class Bus1553Recorder
+{
+
+/*-------------------------------------------------------------------------
+   Data Type declarations
+-------------------------------------------------------------------------*/
+
+public:
+
+   enum typ_transaction    /** <b>Record type</b> */
+   {
+      Receive_Data = 0,                      //!< BC-to-RT data transaction (Bc1553_ReceiveData)
+      Transmit_Data,                         //!< RT-to-BC data transaction (Bc1553_TransmitData)
+      Mode_Command,                          //!< Mode command (Bc1553_ReceiveModeCommand)
+      Model_Name                             //!< Name of the Model "model", stored in the "words" field
+   };
+
+   struct typ_Header       /** Data structure type of the <b>file header</b> */
+   {
+      char              magic[8];            //!< BUS1553_RECORDER_MAGIC
+      unsigned int      version;             //!< BUS1553_RECORDER_VERSION
+      unsigned int      record_size;         //!< sizeof(typ_Record)
+      unsigned int      rt_mask;             //!< Recorded <b>RT addresses</b> (bit per RT address)
+      unsigned int      sa_mask;             //!< Recorded <b>subaddresses</b> (bit per subaddress)
+      unsigned long long n_records;          //!< Number of the <b>valid records</b>, updated at each record
+   };
+
+   struct typ_Record       /** Data structure type of a <b>transaction record</b> (80 bytes) */
+   {
+      double            time;                //!< <b>Simulation time</b> [s] of the transaction
+      unsigned short    model;               //!< Index of the <b>served Model</b> (see the Model_Name records)
+      unsigned char     transaction;         //!< <b>Record type</b> (typ_transaction)
+      unsigned char     rt;                  //!< <b>RT address</b> of the transaction (31 if broadcast)
+      unsigned char     sa;                  //!< <b>Subaddress</b>, or <b>mode code</b> for the mode commands
+      unsigned char     tx_rx;               //!< Mode command <b>direction</b> (typ_B1553_TxRx)
+      unsigned char     word_count;          //!< Number of the valid <b>data words</b>
+      unsigned char     status;              //!< <b>Return code</b> of the RT handler (typ_return)
+      unsigned short    words[32];           //!< <b>Data words</b> (Model name characters for the Model_Name records)
+   };
+
+/*-------------------------------------------------------------------------
+   Data declarations
+-------------------------------------------------------------------------*/
+
+private:
+
+   int                        fd;                              //!<  Recording file descriptor (-1 if closed)
+   typ_Header                 *header;                         //!<  Mapped file header
+   typ_Record                 *chunk;                          //!<  Mapped current chunk
+   unsigned long long         chunk_first;                     //!<  Index of the first record of the current chunk
+   unsigned long long         n_records;                       //!<  Number of the written records
+   unsigned int               rt_mask;                         //!<  Recorded RT addresses
+   unsigned int               sa_mask;                         //!<  Recorded subaddresses
+   const void                 *model_key[BUS1553_RECORDER_MAX_MODELS];  //!<  Models already named in the recording (index = Model index)
+   int                        n_models;                        //!<  Number of the named Models
+
+/*-------------------------------------------------------------------------
+   Function declarations
+-------------------------------------------------------------------------*/
+
+public:
+
+/** Class <b>Constructor</b>*/
+   Bus1553Recorder ();
+/** Class <b>Destructor</b>: the recording is closed*/
+   ~Bus1553Recorder ();
+
+/** Public Method to <b>start a recording</b> into a new file. Returns Error if the file cannot be created or mapped*/
+   typ_return                    Open (const char *file_name /*! Recording <b>file name</b>*/, unsigned int rt_mask_filter = 0xFFFFFFFF /*! Recorded <b>RT addresses</b> (bit per address)*/, unsigned int sa_mask_filter = 0xFFFFFFFF /*! Recorded <b>subaddresses</b> (bit per subaddress)*/);
+/** Public Method to <b>stop the recording</b>: the file is truncated to the valid records and closed*/
+   void                          Close ();
+/** Public Method to say whether a <b>recording is open</b>*/
+   inline bool                   Is_Open ()        {return fd >= 0;};
+/** Public Method to say whether the transactions of the given <b>RT address and subaddress</b> are recorded*/
+   inline bool                   Accept (int rt, int sa)       {return fd >= 0 && ((rt_mask >> (rt & 31)) & (sa_mask >> (sa & 31)) & 1);};
+/** Public Method to <b>append a transaction record</b>; the Model is named in the recording at its first transaction*/
+   void                          Record (double time /*! <b>Simulation time</b> [s]*/, const void *model /*! Model identity*/, const char *model_name /*! Model name*/, typ_transaction transaction /*! <b>Record type</b>*/, int rt /*! <b>RT address</b>*/, int sa /*! <b>Subaddress</b> or <b>mode code</b>*/, int tx_rx /*! Mode command direction*/, int word_count /*! Number of the <b>data words</b>*/, typ_return status /*! <b>Return code</b> of the RT handler*/, const unsigned short words[32] /*! <b>Data words</b>*/);
+
+private:
+
+/** Private Method returning the <b>next free record</b>, mapping a new chunk when the current one is full (NULL in case of error)*/
+   typ_Record*                   Next_Record ();
+/** Private Method to unmap the current chunk*/
+   void                          Unmap_Chunk ();
+
+};
+
+#endif // __Bus1553Recorder_h end
@@ -1,24 +1,88 @@
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "CMemoryExport.h"
+#include "LZCodec.h"
+
+#define HASH_PRIME_1    0x9E3779B185EBCA87ULL    // Block hash multipliers (64-bit mixing constants)
+#define HASH_PRIME_2    0xC2B2AE3D27D4EB4FULL
 
 FILE*       CMemoryExport::save_debug     = fopen ("/home/sdve/Desktop/save_debug.txt",    "wt");
 FILE*       CMemoryExport::restore_debug  = fopen ("/home/sdve/Desktop/restore_debug.txt", "wt");
 
 uint8_t*    CMemoryExport::DataStorage    = NULL;
+int         CMemoryExport::DataSize       = 0;
 int         CMemoryExport::NestingLevel   = 0;
-uint8_t*    CMemoryExport::pCurrent       = NULL;
+
+int                           CMemoryExport::Current              = 0;
+bool                          CMemoryExport::Writing              = false;
+uint8_t*                      CMemoryExport::Staging              = NULL;
+CMemoryExport::typ_checkpoint* CMemoryExport::Checkpoints         = NULL;
+int                           CMemoryExport::N_Checkpoints        = 0;
+int                           CMemoryExport::Checkpoints_Capacity = 0;
+uint8_t**                     CMemoryExport::Last_Data            = NULL;
+uint64_t*                     CMemoryExport::Last_Hash            = NULL;
+int                           CMemoryExport::Last_Blocks          = 0;
+int                           CMemoryExport::Last_Capacity        = 0;
+int*                          CMemoryExport::Pending_Index        = NULL;
+uint8_t**                     CMemoryExport::Pending_Data         = NULL;
+uint64_t*                     CMemoryExport::Pending_Hash         = NULL;
+int                           CMemoryExport::N_Pending            = 0;
+int                           CMemoryExport::Pending_Capacity     = 0;
+int                           CMemoryExport::Selected             = -1;
+uint8_t**                     CMemoryExport::Selected_Data        = NULL;
+int                           CMemoryExport::Selected_Capacity    = 0;
+int                           CMemoryExport::DataCapacity         = 0;
+CMemoryExport::typ_field*     CMemoryExport::Fields               = NULL;
+int                           CMemoryExport::N_Fields             = 0;
+int                           CMemoryExport::Fields_Capacity      = 0;
+char*                         CMemoryExport::Pool                 = NULL;
+int                           CMemoryExport::Pool_Size            = 0;
+int                           CMemoryExport::Pool_Capacity        = 0;
+const char*                   CMemoryExport::Model_Name           = NULL;
+int                           CMemoryExport::Model_Pool           = -1;
+CMemoryExport::typ_file_job*  CMemoryExport::File_Job             = NULL;
+pthread_t                     CMemoryExport::File_Writer;
+
+//-------------------------------------------------------------------------------
+template <class T> static T* Grow (T* array, int n, int capacity)
+/*
+   This local procedure moves the first "n" entries of an array into a new one
+   of "capacity" entries (the others are zeroed) and releases the old array.
+*/
+//-------------------------------------------------------------------------------
+{
+   T* grown = new T[capacity];
+
+   memset (grown, '\0', capacity*sizeof(T));
+   if (array)
+   {
+      memcpy (grown, array, n*sizeof(T));
+      delete [] array;
+   }
+   return grown;
+}
+
+//-------------------------------------------------------------------------------
+static inline uint64_t Rotate_Left (uint64_t x, int bits)
+//-------------------------------------------------------------------------------
+{
+   return (x << bits) | (x >> (64 - bits));
+}
 
 //-------------------------------------------------------------------------------
 CMemoryExport::CMemoryExport (int /* MaxDataSize */)
 //-------------------------------------------------------------------------------
 {
-// If the RAM buffer has not been allocated yet then allocate it and reset the content
-   if (!DataStorage)
+// If the staging block has not been allocated yet then allocate it and reset the content
+   if (!Staging)
    {
-      DataStorage = pCurrent = new uint8_t[MAX_SIZE_SAVE_BUFFER];
-      if (!DataStorage)
-         GenericObject::Log_Error("CMemoryExport constructor: Unable to allocate the RAM buffer (%d [bytes])\n", MAX_SIZE_SAVE_BUFFER);
+      Staging = new uint8_t[CHECKPOINT_BLOCK_SIZE];
+      if (!Staging)
+         GenericObject::Log_Error("CMemoryExport constructor: Unable to allocate the staging block (%d [bytes])\n", CHECKPOINT_BLOCK_SIZE);
       else
-         memset (DataStorage, '\0', MAX_SIZE_SAVE_BUFFER);
+         memset (Staging, '\0', CHECKPOINT_BLOCK_SIZE);
    }
 }
 
@@ -26,47 +90,42 @@ CMemoryExport::CMemoryExport (int /* MaxDataSize */)
 void CMemoryExport::Reset (bool clear_flag)
 //-------------------------------------------------------------------------------
 {
-   if (DataStorage)
-   {
-      NestingLevel = 0;             // Reset to zero the nesting level
-      pCurrent     = DataStorage;   // Restore the current pointer to the beginning of the RAM buffer
-      if (clear_flag)               // If required clear the RAM buffer content
-         memset (DataStorage, '\0', MAX_SIZE_SAVE_BUFFER);
-   }
+   if (Writing)                     // Commit the save in progress, i.e. the data exported since the previous Reset
+      Checkpoint ();
+   if (clear_flag)                  // If required release all the checkpoints
+      Release ();
+   NestingLevel = 0;                // Reset to zero the nesting level
+   Current      = 0;                // Restore the current position to the beginning of the image
 }
 
 //-------------------------------------------------------------------------------
 bool CMemoryExport::ExportData(void* ptrData, int sizeofData, const char* description)
 //-------------------------------------------------------------------------------
 {
-   if (DataStorage)
+   if (Staging)
    {
-      if (pCurrent + sizeofData > DataStorage + MAX_SIZE_SAVE_BUFFER) // Check ther is enogh space in the RAM buffer
+      if (!Writing && Current) // The image is being read: a save shall start from its beginning
       {
-         GenericObject::Log_Error("CMemoryExport::ExportData: Data @0x%08X size %d exceedes the buffer allocated memory (%d)\n", ptrData, sizeofData, MAX_SIZE_SAVE_BUFFER);
+         GenericObject::Log_Error("CMemoryExport::ExportData: Data @0x%08X size %d written while the image is being read, Reset is required\n", ptrData, sizeofData);
          return false;
       }
-      memcpy (pCurrent, ptrData, sizeofData);   // Copy the user data into the RAM buffer
-      pCurrent += sizeofData;                   // Shift forward the current pointer to the next not-written-yet RAM buffer location
-// Log the written data into the save_debug log file, if required
-      if (save_debug)
+      if (sizeofData < 0 || sizeofData > 0x7FFFFFFF - Current) // Check the image size is representable
       {
-         fprintf (save_debug, "% 2i\t", CMemoryExport::NestingLevel);
-         for (int i = 0; i < CMemoryExport::NestingLevel; i++)
-            fprintf (save_debug, "\t");
-         fprintf (save_debug, "size = %d\tdata = ", sizeofData);
-         if (sizeofData < 64)
-            for (int i = 0; i < sizeofData; i++)
-               fprintf (save_debug, "%02X", ((unsigned char*)ptrData)[i]);
-         if (description)
-         {
-            fprintf (save_debug, "\t\t\t%s", description);
-            if (sizeofData == 1 && strstr (description, "string"))
-               fprintf (save_debug, "\t\t|%c|", ((unsigned char*)ptrData)[0]);
-         }
-         fprintf (save_debug, "\n");
-         fflush(save_debug);
+         GenericObject::Log_Error("CMemoryExport::ExportData: Data @0x%08X size %d exceedes the maximum image size\n", ptrData, sizeofData);
+         return false;
+      }
+      if (!Writing)  // A new save starts a new fields index
+      {
+         N_Fields   = 0;
+         Pool_Size  = 0;
+         Model_Pool = -1;
+         Writing    = true;
       }
+      Add_Field (Current, sizeofData, description);
+      Write ((const uint8_t*)ptrData, sizeofData);   // Copy the user data into the image, block by block
+// Log the written data into the save_debug log file (flushed by Checkpoint), if required
+      if (save_debug)
+         Trace_Data (save_debug, ptrData, sizeofData, description);
       return true;
    }
    return false;
@@ -76,32 +135,28 @@ bool CMemoryExport::ExportData(void* ptrData, int sizeofData, const char* descri
 bool CMemoryExport::ImportData(void* ptrData, int sizeofData, const char* description)
 //-------------------------------------------------------------------------------
 {
-   if (DataStorage)
+   uint8_t  **blocks = (Selected < 0) ? Last_Data : Selected_Data, *target = (uint8_t*)ptrData;
+   int      offset, n, size;
+
+   if (Staging)
    {
-      if (pCurrent + sizeofData > DataStorage + MAX_SIZE_SAVE_BUFFER) // Check ther is enogh data in the RAM buffer
+      if (Writing || sizeofData < 0 || sizeofData > Get_Image_Size () - Current) // Check there is enough data in the image
       {
-         GenericObject::Log_Error("CMemoryExport::ImportData: Data @0x%08X size %d exceedes the buffer allocated memory (%d)\n", ptrData, sizeofData, MAX_SIZE_SAVE_BUFFER);
+         GenericObject::Log_Error("CMemoryExport::ImportData: Data @0x%08X size %d exceedes the saved image (%d)%s\n", ptrData, sizeofData, Get_Image_Size (), Writing ? ", a save is in progress" : "");
          return false;
       }
-      memcpy (ptrData, pCurrent, sizeofData);   // Copy the RAM buffer data into the user buffer
-      pCurrent += sizeofData;                   // Shift forward the current pointer to the next not-read-yet RAM buffer location
+      for (size = sizeofData; size > 0; size -= n)   // Copy the image data into the user buffer, block by block
+      {
+         offset = Current % CHECKPOINT_BLOCK_SIZE;
+         n      = (CHECKPOINT_BLOCK_SIZE - offset < size) ? CHECKPOINT_BLOCK_SIZE - offset : size;
+         memcpy (target, blocks[Current / CHECKPOINT_BLOCK_SIZE] + offset, n);
+         target  += n;
+         Current += n;                                // Shift forward the current position to the next not-read-yet image location
+      }
 // Log the read data into the restore_debug log file, if required
       if (restore_debug)
       {
-         fprintf (restore_debug, "% 2i\t", CMemoryExport::NestingLevel);
-         for (int i = 0; i < CMemoryExport::NestingLevel; i++)
-            fprintf (restore_debug, "\t");
-         fprintf (restore_debug, "size = %d\tdata = ", sizeofData);
-         if (sizeofData < 64)
-            for (int i = 0; i < sizeofData; i++)
-               fprintf (restore_debug, "%02X", ((unsigned char*)ptrData)[i]);
-         if (description)
-        {
-            fprintf (restore_debug, "\t\t\t%s", description);
-            if (sizeofData == 1 && strstr (description, "string"))
-               fprintf (restore_debug, "\t\t|%c|", ((unsigned char*)ptrData)[0]);
-         }
-         fprintf (restore_debug, "\n");
+         Trace_Data (restore_debug, ptrData, sizeofData, description);
          fflush(restore_debug);
       }
       return true;
@@ -109,6 +164,581 @@ bool CMemoryExport::ImportData(void* ptrData, int sizeofData, const char* descri
    return false;
 }
 
+//-------------------------------------------------------------------------------
+int CMemoryExport::Checkpoint ()
+//-------------------------------------------------------------------------------
+{
+   typ_checkpoint *checkpoint;
+   int            i, n_blocks;
+
+   if (!Writing)
+      return -1;
+
+// Compare the last (partial) block too, then move the changed blocks into the new checkpoint
+   if (Current % CHECKPOINT_BLOCK_SIZE)
+      Commit_Block (Current / CHECKPOINT_BLOCK_SIZE, Current % CHECKPOINT_BLOCK_SIZE);
+   if (N_Checkpoints == Checkpoints_Capacity)
+   {
+      Checkpoints_Capacity = Checkpoints_Capacity ? 2*Checkpoints_Capacity : CHECKPOINT_INITIAL_SIZE;
+      Checkpoints = Grow (Checkpoints, N_Checkpoints, Checkpoints_Capacity);
+   }
+   checkpoint              = &Checkpoints[N_Checkpoints];
+   checkpoint->size        = Current;
+   checkpoint->n_blocks    = N_Pending;
+   checkpoint->block_index = new int[N_Pending];
+   checkpoint->block_data  = new uint8_t*[N_Pending];
+   memcpy (checkpoint->block_index, Pending_Index, N_Pending*sizeof(int));
+   memcpy (checkpoint->block_data,  Pending_Data,  N_Pending*sizeof(uint8_t*));
+
+// The last image shares the unchanged blocks and takes the changed ones (all the blocks beyond the previous image are changed)
+   n_blocks = (Current + CHECKPOINT_BLOCK_SIZE - 1) / CHECKPOINT_BLOCK_SIZE;
+   if (n_blocks > Last_Capacity)
+   {
+      Last_Data     = Grow (Last_Data, Last_Blocks, (n_blocks > 2*Last_Capacity) ? n_blocks : 2*Last_Capacity);
+      Last_Hash     = Grow (Last_Hash, Last_Blocks, (n_blocks > 2*Last_Capacity) ? n_blocks : 2*Last_Capacity);
+      Last_Capacity = (n_blocks > 2*Last_Capacity) ? n_blocks : 2*Last_Capacity;
+   }
+   for (i = 0; i < N_Pending; i++)
+   {
+      Last_Data[Pending_Index[i]] = Pending_Data[i];
+      Last_Hash[Pending_Index[i]] = Pending_Hash[i];
+   }
+   if (n_blocks > Last_Blocks)
+      Last_Blocks = n_blocks;
+
+   fprintfile (save_debug, "checkpoint %d : size = %d, changed blocks = %d of %d, fields = %d\n", N_Checkpoints, Current, N_Pending, n_blocks, N_Fields);
+   N_Pending    = 0;
+   Writing      = false;
+   Selected     = -1;
+   NestingLevel = 0;
+   Current      = 0;
+   return N_Checkpoints++;
+}
+
+//-------------------------------------------------------------------------------
+bool CMemoryExport::Select_Checkpoint (int checkpoint)
+//-------------------------------------------------------------------------------
+{
+   int   i, j;
+
+   if (Writing)
+      Checkpoint ();
+   if (checkpoint < -1 || checkpoint >= N_Checkpoints)
+   {
+      GenericObject::Log_Error("CMemoryExport::Select_Checkpoint: checkpoint %d not available (%d saved)\n", checkpoint, N_Checkpoints);
+      return false;
+   }
+   Selected     = checkpoint;
+   NestingLevel = 0;
+   Current      = 0;
+
+// Rebuild the image of a previous checkpoint: the base blocks replaced by the changed ones of the following deltas
+   if (checkpoint >= 0 && checkpoint < N_Checkpoints-1)
+   {
+      if (Last_Blocks > Selected_Capacity)
+      {
+         delete [] Selected_Data;
+         Selected_Capacity = Last_Blocks;
+         Selected_Data     = new uint8_t*[Selected_Capacity];
+      }
+      for (i = 0; i <= checkpoint; i++)
+         for (j = 0; j < Checkpoints[i].n_blocks; j++)
+            Selected_Data[Checkpoints[i].block_index[j]] = Checkpoints[i].block_data[j];
+   }
+   else
+      Selected = -1; // The last checkpoint image is kept up to date
+   return true;
+}
+
+//-------------------------------------------------------------------------------
+int CMemoryExport::Get_Image_Size ()
+//-------------------------------------------------------------------------------
+{
+   if (!N_Checkpoints)
+      return 0;
+   return Checkpoints[(Selected < 0) ? N_Checkpoints-1 : Selected].size;
+}
+
+//-------------------------------------------------------------------------------
+bool CMemoryExport::Flatten ()
+//-------------------------------------------------------------------------------
+{
+   uint8_t  **blocks = (Selected < 0) ? Last_Data : Selected_Data;
+   int      i, size = Get_Image_Size ();
+
+   if (!N_Checkpoints || Writing)
+   {
+      GenericObject::Log_Error("CMemoryExport::Flatten: no checkpoint image available%s\n", Writing ? ", a save is in progress" : "");
+      return false;
+   }
+   if (size > DataCapacity) // Grow the flat buffer (it moves)
+   {
+      delete [] DataStorage;
+      DataStorage  = new uint8_t[size];
+      DataCapacity = size;
+   }
+   for (i = 0; i < size; i += CHECKPOINT_BLOCK_SIZE)
+      memcpy (DataStorage + i, blocks[i / CHECKPOINT_BLOCK_SIZE], (size - i < CHECKPOINT_BLOCK_SIZE) ? size - i : CHECKPOINT_BLOCK_SIZE);
+   DataSize = size;
+   return true;
+}
+
+//-------------------------------------------------------------------------------
+bool CMemoryExport::Load_Image (const uint8_t* image, int size)
+//-------------------------------------------------------------------------------
+{
+   if (!Staging || !image || size < 0)
+      return false;
+   Reset ();        // Commit the save in progress, if any
+   Writing  = true;
+   N_Fields = 0;    // The fields of a flat image are not known
+   Write (image, size);
+   return Checkpoint () >= 0;
+}
+
+//-------------------------------------------------------------------------------
+void CMemoryExport::Write (const uint8_t* data, int size)
+//-------------------------------------------------------------------------------
+{
+   int   offset, n;
+
+   for (; size > 0; size -= n)
+   {
+      offset = Current % CHECKPOINT_BLOCK_SIZE;
+      n      = (CHECKPOINT_BLOCK_SIZE - offset < size) ? CHECKPOINT_BLOCK_SIZE - offset : size;
+      memcpy (Staging + offset, data, n);
+      data    += n;
+      Current += n;
+      if (offset + n == CHECKPOINT_BLOCK_SIZE) // Block complete
+         Commit_Block (Current / CHECKPOINT_BLOCK_SIZE - 1, CHECKPOINT_BLOCK_SIZE);
+   }
+}
+
+//-------------------------------------------------------------------------------
+void CMemoryExport::Commit_Block (int index, int used)
+//-------------------------------------------------------------------------------
+{
+   uint64_t hash;
+
+// The unused tail of the last block is zeroed, so that its hash depends only on the image
+   if (used < CHECKPOINT_BLOCK_SIZE)
+      memset (Staging + used, '\0', CHECKPOINT_BLOCK_SIZE - used);
+   hash = Hash_Block (Staging);
+   if (index < Last_Blocks && Last_Hash[index] == hash // Unchanged: shared with the last checkpoint (the data are compared too, the hash may collide)
+    && !memcmp (Last_Data[index], Staging, CHECKPOINT_BLOCK_SIZE))
+      return;
+
+   if (N_Pending == Pending_Capacity)
+   {
+      Pending_Index    = Grow (Pending_Index, N_Pending, Pending_Capacity ? 2*Pending_Capacity : CHECKPOINT_INITIAL_SIZE);
+      Pending_Data     = Grow (Pending_Data,  N_Pending, Pending_Capacity ? 2*Pending_Capacity : CHECKPOINT_INITIAL_SIZE);
+      Pending_Hash     = Grow (Pending_Hash,  N_Pending, Pending_Capacity ? 2*Pending_Capacity : CHECKPOINT_INITIAL_SIZE);
+      Pending_Capacity = Pending_Capacity ? 2*Pending_Capacity : CHECKPOINT_INITIAL_SIZE;
+   }
+   Pending_Index[N_Pending] = index;
+   Pending_Hash[N_Pending]  = hash;
+   Pending_Data[N_Pending]  = new uint8_t[CHECKPOINT_BLOCK_SIZE];
+   memcpy (Pending_Data[N_Pending++], Staging, CHECKPOINT_BLOCK_SIZE);
+}
+
+//-------------------------------------------------------------------------------
+void CMemoryExport::Release ()
+//-------------------------------------------------------------------------------
+{
+   int   i, j;
+
+   Wait_File ();    // The file writer reads the blocks
+   for (i = 0; i < N_Checkpoints; i++)
+   {
+      for (j = 0; j < Checkpoints[i].n_blocks; j++)
+         delete [] Checkpoints[i].block_data[j];
+      delete [] Checkpoints[i].block_index;
+      delete [] Checkpoints[i].block_data;
+   }
+   Abort ();
+   N_Checkpoints = 0;
+   N_Fields      = 0;
+   Last_Blocks   = 0;
+   Selected      = -1;
+}
+
+//-------------------------------------------------------------------------------
+void CMemoryExport::Abort ()
+//-------------------------------------------------------------------------------
+{
+   int   i;
+
+   for (i = 0; i < N_Pending; i++)
+      delete [] Pending_Data[i];
+   N_Pending = 0;
+   Writing   = false;
+   Current   = 0;
+}
+
+//-------------------------------------------------------------------------------
+uint64_t CMemoryExport::Hash_Block (const uint8_t* block)
+/*
+   64-bit hash of a block: four independent multiply-rotate lanes over the
+   8-byte words (no dependency between the lanes), merged and mixed at the end.
+*/
+//-------------------------------------------------------------------------------
+{
+   uint64_t lane0 = HASH_PRIME_1 + HASH_PRIME_2, lane1 = HASH_PRIME_2, lane2 = 0, lane3 = (uint64_t)0 - HASH_PRIME_1, word[4], hash;
+   int      i;
+
+   for (i = 0; i < CHECKPOINT_BLOCK_SIZE; i += sizeof(word))
+   {
+      memcpy (word, block + i, sizeof(word));
+      lane0 = Rotate_Left (lane0 + word[0] * HASH_PRIME_2, 31) * HASH_PRIME_1;
+      lane1 = Rotate_Left (lane1 + word[1] * HASH_PRIME_2, 31) * HASH_PRIME_1;
+      lane2 = Rotate_Left (lane2 + word[2] * HASH_PRIME_2, 31) * HASH_PRIME_1;
+      lane3 = Rotate_Left (lane3 + word[3] * HASH_PRIME_2, 31) * HASH_PRIME_1;
+   }
+   hash  = Rotate_Left (lane0, 1) + Rotate_Left (lane1, 7) + Rotate_Left (lane2, 12) + Rotate_Left (lane3, 18);
+   hash ^= hash >> 33;
+   hash *= HASH_PRIME_2;
+   hash ^= hash >> 29;
+   return hash;
+}
+
+//-------------------------------------------------------------------------------
+void CMemoryExport::Add_Field (int offset, int size, const char* description)
+//-------------------------------------------------------------------------------
+{
+   if (N_Fields == Fields_Capacity)
+   {
+      Fields          = Grow (Fields, N_Fields, Fields_Capacity ? 2*Fields_Capacity : CHECKPOINT_INITIAL_SIZE);
+      Fields_Capacity = Fields_Capacity ? 2*Fields_Capacity : CHECKPOINT_INITIAL_SIZE;
+   }
+   if (Model_Pool < 0) // First field of the model: its name is stored once
+      Model_Pool = Add_Name (Model_Name ? Model_Name : "");
+   Fields[N_Fields].model  = Model_Pool;
+   Fields[N_Fields].field  = Add_Name (description ? description : "");
+   Fields[N_Fields].offset = offset;
+   Fields[N_Fields].size   = size;
+   N_Fields++;
+}
+
+//-------------------------------------------------------------------------------
+int CMemoryExport::Add_Name (const char* name)
+//-------------------------------------------------------------------------------
+{
+   int   length = strlen (name) + 1, position = Pool_Size, capacity;
+
+   if (Pool_Size + length > Pool_Capacity)
+   {
+      for (capacity = Pool_Capacity ? 2*Pool_Capacity : 64*CHECKPOINT_INITIAL_SIZE; capacity < Pool_Size + length; capacity *= 2)
+         ;
+      Pool          = Grow (Pool, Pool_Size, capacity);
+      Pool_Capacity = capacity;
+   }
+   memcpy (Pool + Pool_Size, name, length);
+   Pool_Size += length;
+   return position;
+}
+
+//-------------------------------------------------------------------------------
+void CMemoryExport::Trace_Data (FILE* f, const void* ptrData, int sizeofData, const char* description)
+/*
+   The trace line is built in memory and written with a single call: nesting
+   level, size, data (less than 64 bytes, hexadecimal) and description.
+*/
+//-------------------------------------------------------------------------------
+{
+   static const char    hex[] = "0123456789ABCDEF";
+   const unsigned char  *data = (const unsigned char*)ptrData;
+   char                 line[512];
+   int                  n, i;
+
+   n = sprintf (line, "% 2i\t", NestingLevel);
+   for (i = 0; i < NestingLevel && n < 64; i++)
+      line[n++] = '\t';
+   n += sprintf (line + n, "size = %d\tdata = ", sizeofData);
+   if (sizeofData < 64)
+      for (i = 0; i < sizeofData; i++)
+      {
+         line[n++] = hex[data[i] >> 4];
+         line[n++] = hex[data[i] & 15];
+      }
+   line[n] = '\0';
+   if (description)
+   {
+      n += snprintf (line + n, sizeof(line) - n - 16, "\t\t\t%s", description);
+      if (n > (int)sizeof(line) - 17)
+         n = sizeof(line) - 17;
+      if (sizeofData == 1 && strstr (description, "string"))
+         n += sprintf (line + n, "\t\t|%c|", data[0]);
+   }
+   line[n++] = '\n';
+   line[n]   = '\0';
+   fputs (line, f);
+}
+
+//-------------------------------------------------------------------------------
+bool CMemoryExport::Write_File (const char* file_name, bool compress)
+//-------------------------------------------------------------------------------
+{
+   typ_file_job   *job;
+   bool           result;
+
+   if (Writing)                     // Commit the save in progress
+      Checkpoint ();
+   Wait_File ();                    // One file at a time
+   if (!N_Checkpoints)
+   {
+      GenericObject::Log_Error("CMemoryExport::Write_File: no checkpoint to be written in \"%s\"\n", file_name);
+      return false;
+   }
+
+// Snapshot of the last checkpoint: the block table only, the blocks are not modified until they are released
+   job            = new typ_file_job;
+   job->file_name = new char[strlen (file_name) + 1];
+   strcpy (job->file_name, file_name);
+   job->compress  = compress;
+   job->result    = false;
+   job->size      = Checkpoints[N_Checkpoints-1].size;
+   job->n_blocks  = (job->size + CHECKPOINT_BLOCK_SIZE - 1) / CHECKPOINT_BLOCK_SIZE;
+   job->blocks    = new uint8_t*[job->n_blocks];
+   memcpy (job->blocks, Last_Data, job->n_blocks*sizeof(uint8_t*));
+   job->n_fields  = N_Fields;
+   job->fields    = new typ_field[N_Fields];
+   memcpy (job->fields, Fields, N_Fields*sizeof(typ_field));
+   job->pool_size = Pool_Size;
+   job->pool      = new char[Pool_Size];
+   memcpy (job->pool, Pool, Pool_Size);
+
+   File_Job = job;
+   if (pthread_create (&File_Writer, NULL, File_Writer_Thread, job))
+   {
+      GenericObject::Log_Warning("CMemoryExport::Write_File: unable to start the writer thread, \"%s\" is written now\n", file_name);
+      File_Writer_Thread (job);
+      File_Job = NULL;
+      result   = job->result;
+      delete [] job->file_name;
+      delete [] job->blocks;
+      delete [] job->fields;
+      delete [] job->pool;
+      delete job;
+      return result;
+   }
+   return true;
+}
+
+//-------------------------------------------------------------------------------
+bool CMemoryExport::Wait_File ()
+//-------------------------------------------------------------------------------
+{
+   bool  result;
+
+   if (!File_Job)
+      return true;
+   pthread_join (File_Writer, NULL);
+   result = File_Job->result;
+   delete [] File_Job->file_name;
+   delete [] File_Job->blocks;
+   delete [] File_Job->fields;
+   delete [] File_Job->pool;
+   delete File_Job;
+   File_Job = NULL;
+   return result;
+}
+
+//-------------------------------------------------------------------------------
+void* CMemoryExport::File_Writer_Thread (void* job)
+//-------------------------------------------------------------------------------
+{
+   ((typ_file_job*)job)->result = Write_Mapped_File ((typ_file_job*)job);
+   return NULL;
+}
+
+//-------------------------------------------------------------------------------
+bool CMemoryExport::Write_Mapped_File (typ_file_job* job)
+//-------------------------------------------------------------------------------
+{
+   typ_file_header   header;
+   typ_file_block    *table;
+   uint8_t           *map;
+   char              *temporary_name;
+   size_t            data_start, capacity, position;
+   int               fd, i, n;
+   bool              result = false;
+
+// Layout: header, blocks table, fields index, names pool, then the blocks data (at most all raw)
+   data_start = sizeof(header) + job->n_blocks*sizeof(typ_file_block) + job->n_fields*sizeof(typ_field) + job->pool_size;
+   data_start = (data_start + 7) & ~(size_t)7;
+   capacity   = data_start + (size_t)job->n_blocks*CHECKPOINT_BLOCK_SIZE;
+
+   temporary_name = new char[strlen (job->file_name) + 8];
+   sprintf (temporary_name, "%s.tmp", job->file_name);
+   fd = open (temporary_name, O_RDWR | O_CREAT | O_TRUNC, 0644);
+   if (fd < 0 || ftruncate (fd, capacity) ||
+       (map = (uint8_t*) mmap (NULL, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)) == MAP_FAILED)
+   {
+      GenericObject::Log_Error("CMemoryExport::Write_File: unable to map the file \"%s\" (%lu [bytes])\n", temporary_name, (unsigned long)capacity);
+      if (fd >= 0)
+      {
+         close (fd);
+         unlink (temporary_name);
+      }
+      delete [] temporary_name;
+      return false;
+   }
+
+   memset (&header, '\0', sizeof(header));
+   memcpy (header.magic, CHECKPOINT_FILE_MAGIC, sizeof(header.magic));
+   header.version    = CHECKPOINT_FILE_VERSION;
+   header.block_size = CHECKPOINT_BLOCK_SIZE;
+   header.n_blocks   = job->n_blocks;
+   header.n_fields   = job->n_fields;
+   header.pool_size  = job->pool_size;
+   header.image_size = job->size;
+   memcpy (map, &header, sizeof(header));
+   table    = (typ_file_block*) (map + sizeof(header));
+   position = sizeof(header) + job->n_blocks*sizeof(typ_file_block);
+   memcpy (map + position, job->fields, job->n_fields*sizeof(typ_field));
+   position += job->n_fields*sizeof(typ_field);
+   memcpy (map + position, job->pool, job->pool_size);
+
+// Blocks data, compressed straight into the mapping (raw if they do not shrink)
+   for (i = 0, position = data_start; i < job->n_blocks; i++)
+   {
+      n = job->compress ? LZCodec::Compress (map + position, CHECKPOINT_BLOCK_SIZE - 1, job->blocks[i], CHECKPOINT_BLOCK_SIZE) : 0;
+      table[i].offset     = position;
+      table[i].compressed = (n > 0);
+      if (!n)
+      {
+         memcpy (map + position, job->blocks[i], CHECKPOINT_BLOCK_SIZE);
+         n = CHECKPOINT_BLOCK_SIZE;
+      }
+      table[i].size = n;
+      position     += n;
+   }
+
+// The file is cut to its size and renamed only when complete
+   if (munmap (map, capacity) == 0 && ftruncate (fd, position) == 0 && fsync (fd) == 0)
+      result = true;
+   if (close (fd) || !result || rename (temporary_name, job->file_name))
+   {
+      GenericObject::Log_Error("CMemoryExport::Write_File: unable to write the file \"%s\"\n", job->file_name);
+      unlink (temporary_name);
+      result = false;
+   }
+   delete [] temporary_name;
+   return result;
+}
+
+//-------------------------------------------------------------------------------
+bool CMemoryExport::Read_File (const char* file_name)
+//-------------------------------------------------------------------------------
+{
+   typ_file_header         header;
+   const typ_file_block    *table;
+   const typ_field         *fields;
+   const uint8_t           *map;
+   struct stat             status;
+   size_t                  fields_start, pool_start;
+   int                     fd, i, used;
+   bool                    result = true;
+
+   if (!Staging)
+      return false;
+   Reset ();        // Commit the save in progress, if any
+   Wait_File ();    // The file could be the one being written
+
+   fd = open (file_name, O_RDONLY);
+   if (fd < 0 || fstat (fd, &status) || (size_t)status.st_size < sizeof(header) ||
+       (map = (const uint8_t*) mmap (NULL, status.st_size, PROT_READ, MAP_PRIVATE, fd, 0)) == MAP_FAILED)
+   {
+      GenericObject::Log_Error("CMemoryExport::Read_File: unable to map the file \"%s\"\n", file_name);
+      if (fd >= 0)
+         close (fd);
+      return false;
+   }
+   close (fd);      // The mapping is kept
+
+// Check the header and that the tables are inside the file
+   memcpy (&header, map, sizeof(header));
+   fields_start = sizeof(header) + (size_t)header.n_blocks*sizeof(typ_file_block);
+   pool_start   = fields_start + (size_t)header.n_fields*sizeof(typ_field);
+   if (memcmp (header.magic, CHECKPOINT_FILE_MAGIC, sizeof(header.magic)) || header.version != CHECKPOINT_FILE_VERSION ||
+       header.block_size != CHECKPOINT_BLOCK_SIZE || header.image_size > 0x7FFFFFFF ||
+       header.n_blocks != (header.image_size + CHECKPOINT_BLOCK_SIZE - 1) / CHECKPOINT_BLOCK_SIZE ||
+       pool_start + header.pool_size > (size_t)status.st_size || (header.pool_size && map[pool_start + header.pool_size - 1]))
+   {
+      GenericObject::Log_Error("CMemoryExport::Read_File: \"%s\" is not a valid checkpoint file (version %d, block size %d)\n", file_name, CHECKPOINT_FILE_VERSION, CHECKPOINT_BLOCK_SIZE);
+      munmap ((void*)map, status.st_size);
+      return false;
+   }
+   table  = (const typ_file_block*) (map + sizeof(header));
+   fields = (const typ_field*) (map + fields_start);
+
+// Blocks decoded from the mapping straight into the staging block, then kept only if changed (the last partial block is left
+// in the staging block for "Checkpoint", as by "Write")
+   Writing = true;
+   for (i = 0; i < (int)header.n_blocks && result; i++)
+   {
+      used = (header.image_size - Current < CHECKPOINT_BLOCK_SIZE) ? header.image_size - Current : CHECKPOINT_BLOCK_SIZE;
+      if (table[i].offset > (uint64_t)status.st_size || table[i].size > status.st_size - table[i].offset)
+         result = false;
+      else if (table[i].compressed)
+         result = LZCodec::Decompress (Staging, CHECKPOINT_BLOCK_SIZE, map + table[i].offset, table[i].size) == CHECKPOINT_BLOCK_SIZE;
+      else if ((result = (table[i].size == CHECKPOINT_BLOCK_SIZE)))
+         memcpy (Staging, map + table[i].offset, CHECKPOINT_BLOCK_SIZE);
+      if (result)
+      {
+         Current += used;
+         if (used == CHECKPOINT_BLOCK_SIZE)
+            Commit_Block (i, used);
+      }
+   }
+   for (i = 0; i < (int)header.n_fields && result; i++)
+      result = fields[i].model < header.pool_size && fields[i].field < header.pool_size && fields[i].offset <= header.image_size && fields[i].size <= header.image_size - fields[i].offset;
+   if (!result)
+   {
+      GenericObject::Log_Error("CMemoryExport::Read_File: \"%s\" is corrupted\n", file_name);
+      Abort ();
+      munmap ((void*)map, status.st_size);
+      return false;
+   }
+
+// Fields index of the new checkpoint
+   N_Fields  = 0;
+   Pool_Size = 0;
+   if ((int)header.n_fields > Fields_Capacity)
+   {
+      Fields          = Grow (Fields, 0, header.n_fields);
+      Fields_Capacity = header.n_fields;
+   }
+   if ((int)header.pool_size > Pool_Capacity)
+   {
+      Pool          = Grow (Pool, 0, header.pool_size);
+      Pool_Capacity = header.pool_size;
+   }
+   memcpy (Fields, fields, header.n_fields*sizeof(typ_field));
+   memcpy (Pool, map + pool_start, header.pool_size);
+   N_Fields  = header.n_fields;
+   Pool_Size = header.pool_size;
+   munmap ((void*)map, status.st_size);
+   return Checkpoint () >= 0;
+}
+
+//-------------------------------------------------------------------------------
+bool CMemoryExport::Locate_Field (const char* model_name, const char* description)
+//-------------------------------------------------------------------------------
+{
+   int   i;
+
+   if (!Writing)
+      for (i = 0; i < N_Fields; i++)
+         if (!strcmp (Pool + Fields[i].model, model_name) && !strcmp (Pool + Fields[i].field, description))
+         {
+            Current = Fields[i].offset;
+            return true;
+         }
+   GenericObject::Log_Warning("CMemoryExport::Locate_Field: field \"%s\" of \"%s\" not found\n", description, model_name);
+   return false;
+}
+
 #include <stdarg.h>
 
 //-------------------------------------------------------------------------
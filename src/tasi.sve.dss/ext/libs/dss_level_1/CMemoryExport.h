@@ -13,6 +13,14 @@
         Such machinery allows saving and restore of models with dynamic
         variables
 
+        The saved data are kept as a chain of checkpoints: the first one
+        (base) holds the whole image, split in blocks of
+        CHECKPOINT_BLOCK_SIZE bytes, each following one holds only the
+        blocks whose hash differs from the previous checkpoint ones (delta).
+        The unchanged blocks are shared, so the RAM and the copy cost of a
+        checkpoint grow with the changed data, not with the whole state,
+        and the image size is not limited.
+
     HOW TO USE
     ========
         In Level2:
@@ -25,15 +33,46 @@
                   output in a binary file
 
        In Level3:
-                * Publish variable DataStorage before PublishAllData method is
-                  called, e.g. :
-                      Publish(DataStorage,DataSize, PublicName, "bytes" );
-                   -Publish is a protected method and cannot be used within
-                    CMemoryExport class -
+                * on the "SAVE" event call Reset, the Save methods and then
+                  Checkpoint (returning the checkpoint number)
+                * on the "RESTORE" event call Select_Checkpoint (-1 for the
+                  last one) and then the Restore methods
+                * DataStorage shall NOT be published: it is NULL until the
+                  first Flatten and it is reallocated when the image grows.
+                  To keep the image outside the checkpoint chain, call Flatten
+                  after the "SAVE" event and copy DataSize bytes of
+                  DataStorage, then give the copy to Load_Image before the
+                  "RESTORE" one
+                * call Set_Model_Name before the Save method of each model, so
+                  that the fields index says which model each field belongs to
+                * Write_File hands the last checkpoint to a background thread
+                  writing it in a file (returning at once), Wait_File waits for
+                  it; Read_File loads a file as a new checkpoint, to be read by
+                  the Restore methods (Locate_Field moves to a field by name)
+
+    CHECKPOINT FILE
+    ========
+        Header (typ_file_header), blocks table (typ_file_block, one per
+        image block), fields index (typ_field), names pool and blocks data,
+        each block LZ compressed (see LZCodec) or raw when not compressible.
+        The file is written through a shared mapping into "<name>.tmp", then
+        renamed, so an existing checkpoint file is replaced only when the
+        new one is complete.
 
     CHANGE LOG
 
     ==========
+   DSS Team       2026/10/19  Replaced the fixed 8 MB sequential buffer with the chunked checkpoint storage: the image is
+                              split in blocks hashed while they are written, "Checkpoint" keeps only the changed blocks
+                              (delta of the previous checkpoint) and "Select_Checkpoint" rebuilds any checkpoint from the
+                              base and the deltas. "Reset" commits the pending save, so the old Reset/ExportData/Reset/
+                              ImportData sequence still works. DataStorage is now filled on demand ("Flatten") and it is
+                              no more published: Level3 copies it after "Flatten" and gives it back to "Load_Image".
+   DSS Team       2026/10/19  Added the checkpoint files: "Write_File" snapshots the block table of the last checkpoint
+                              (the blocks are shared, not copied) and a background thread writes the memory mapped file,
+                              with the (model, field, offset) index and the blocks optionally compressed by LZCodec;
+                              "Read_File" maps the file and decodes the blocks straight into the checkpoint storage.
+                              The save_debug trace is written with one call per field and flushed at "Checkpoint".
 
 ******************************************************************************/
 
@@ -41,10 +80,14 @@
 #define _CMemoryExport_H
 
 #include <stdio.h>
+#include <pthread.h>
 #include "stdint.h"             // includes uint8_t
 #include "GenericObject.h"      // used for Log messages
 
-#define MAX_SIZE_SAVE_BUFFER     0x800000
+#define CHECKPOINT_BLOCK_SIZE    0x1000                  //!< Size [byte] of the <b>blocks</b> compared and shared by the checkpoints
+#define CHECKPOINT_INITIAL_SIZE  64                      //!< Initial number of the entries of the growable arrays
+#define CHECKPOINT_FILE_MAGIC    "DSSCKPT"               //!< Checkpoint file <b>identifier</b> (with the terminator, 8 bytes)
+#define CHECKPOINT_FILE_VERSION  1                       //!< Checkpoint file <b>format version</b>
 
 /** Global utility to write & flush a User message on a User provided file */
 void fprintfile (FILE* f /*! User file */, const char *format, ...);
@@ -52,6 +95,60 @@ void fprintfile (FILE* f /*! User file */, const char *format, ...);
 class CMemoryExport
 {
 
+/*-------------------------------------------------------------------------
+   Data Type declarations
+-------------------------------------------------------------------------*/
+
+private:
+
+   struct typ_checkpoint      /** Data structure of a <b>checkpoint</b>: the blocks changed since the previous one (all for the base)*/
+   {
+      int               size;                //!< Size [byte] of the whole image
+      int               n_blocks;            //!< Number of the <b>changed blocks</b>
+      int*              block_index;         //!< Position of each changed block in the image
+      uint8_t**         block_data;          //!< Content of each changed block (owned)
+   };
+
+   struct typ_field           /** Data structure of a <b>fields index</b> entry (also the checkpoint file layout)*/
+   {
+      uint32_t          model;               //!< <b>Model name</b> position in the names pool
+      uint32_t          field;               //!< <b>Field description</b> position in the names pool
+      uint32_t          offset;              //!< Position [byte] of the field in the image
+      uint32_t          size;                //!< Size [byte] of the field
+   };
+
+   struct typ_file_header     /** Data structure of the <b>checkpoint file header</b>*/
+   {
+      char              magic[8];            //!< CHECKPOINT_FILE_MAGIC
+      uint32_t          version;             //!< CHECKPOINT_FILE_VERSION
+      uint32_t          block_size;          //!< CHECKPOINT_BLOCK_SIZE of the writer
+      uint32_t          n_blocks;            //!< Number of the <b>blocks</b>
+      uint32_t          n_fields;            //!< Number of the <b>fields index</b> entries
+      uint32_t          pool_size;           //!< Size [byte] of the <b>names pool</b>
+      uint32_t          image_size;          //!< Size [byte] of the <b>image</b>
+   };
+
+   struct typ_file_block      /** Data structure of a <b>checkpoint file block</b> table entry*/
+   {
+      uint64_t          offset;              //!< Position [byte] of the block data in the file
+      uint32_t          size;                //!< Size [byte] of the stored block data
+      uint32_t          compressed;          //!< 1 if LZ compressed, 0 if raw
+   };
+
+   struct typ_file_job        /** Data structure of a checkpoint file being written by the <b>background thread</b>*/
+   {
+      char*             file_name;           //!< <b>File name</b>
+      bool              compress;            //!< Flag to compress the blocks
+      bool              result;              //!< <b>true</b> if the file has been written
+      int               size;                //!< Size [byte] of the image
+      int               n_blocks;            //!< Number of the blocks
+      uint8_t**         blocks;              //!< Snapshot of the image <b>block table</b> (the blocks are shared)
+      typ_field*        fields;              //!< Copy of the <b>fields index</b>
+      int               n_fields;            //!< Number of the fields index entries
+      char*             pool;                //!< Copy of the <b>names pool</b>
+      int               pool_size;           //!< Size [byte] of the names pool
+   };
+
 /*-------------------------------------------------------------------------
    Data declarations
 -------------------------------------------------------------------------*/
@@ -61,12 +158,48 @@ public:
    static FILE*       save_debug;
    static FILE*       restore_debug;
 
-   static uint8_t*    DataStorage;         //!< Public static RAM buffer for binary sequential data saving (it shall be public for publishing purposes)
+   static uint8_t*    DataStorage;         //!< Public static RAM buffer with the flat copy of the checkpoint image, filled by "Flatten" (NULL before, moved when the image grows: not to be published)
+   static int         DataSize;            //!< Public static size [byte] of the flat copy in DataStorage
    static int         NestingLevel;        //!< Public static counter to trace the nesting level in the serial data management
 
 private:
 
-   static uint8_t*    pCurrent;            //!< Private static pointer to the current position for sequential buffer access
+   static int              Current;             //!< Private static offset of the current position for sequential image access
+   static bool             Writing;             //!< Private static flag of a save in progress (not committed by "Checkpoint" yet)
+   static uint8_t*         Staging;             //!< Private static buffer of the block being written, compared when complete
+
+   static typ_checkpoint*  Checkpoints;         //!< Private static chain of the <b>checkpoints</b> (base first)
+   static int              N_Checkpoints;       //!< Private static number of the checkpoints
+   static int              Checkpoints_Capacity;//!< Private static number of the allocated checkpoints
+
+   static uint8_t**        Last_Data;           //!< Private static blocks of the <b>last checkpoint</b> image (shared with the checkpoints)
+   static uint64_t*        Last_Hash;           //!< Private static hash of each block of the last checkpoint image
+   static int              Last_Blocks;         //!< Private static number of the blocks in the last image tables
+   static int              Last_Capacity;       //!< Private static number of the allocated entries of the last image tables
+
+   static int*             Pending_Index;       //!< Private static position of the changed blocks of the save in progress
+   static uint8_t**        Pending_Data;        //!< Private static content of the changed blocks of the save in progress
+   static uint64_t*        Pending_Hash;        //!< Private static hash of the changed blocks of the save in progress
+   static int              N_Pending;           //!< Private static number of the changed blocks of the save in progress
+   static int              Pending_Capacity;    //!< Private static number of the allocated entries of the pending tables
+
+   static int              Selected;            //!< Private static checkpoint read by "ImportData" (-1 for the last one)
+   static uint8_t**        Selected_Data;       //!< Private static blocks of the selected checkpoint image, rebuilt by "Select_Checkpoint"
+   static int              Selected_Capacity;   //!< Private static number of the allocated entries of the selected image table
+
+   static int              DataCapacity;        //!< Private static allocated size [byte] of DataStorage
+
+   static typ_field*       Fields;              //!< Private static <b>fields index</b> of the last checkpoint (or of the save in progress)
+   static int              N_Fields;            //!< Private static number of the fields index entries
+   static int              Fields_Capacity;     //!< Private static number of the allocated fields index entries
+   static char*            Pool;                //!< Private static <b>names pool</b> of the fields index
+   static int              Pool_Size;           //!< Private static size [byte] of the names pool
+   static int              Pool_Capacity;       //!< Private static allocated size [byte] of the names pool
+   static const char*      Model_Name;          //!< Private static name of the model being saved (Set_Model_Name)
+   static int              Model_Pool;          //!< Private static position of the model name in the names pool (-1 if not stored yet)
+
+   static typ_file_job*    File_Job;            //!< Private static checkpoint file being written (NULL if none)
+   static pthread_t        File_Writer;         //!< Private static <b>background thread</b> writing the checkpoint file
 
 /*-------------------------------------------------------------------------
    Function declarations
@@ -74,18 +207,54 @@ private:
 
 public:
 
-/** Class <b>Constructor</b> (unique), allocates the <b>static RAM buffer</b> if it has not been allocated yet */
+/** Class <b>Constructor</b> (unique), allocates the <b>static staging block</b> if it has not been allocated yet */
    CMemoryExport (int MaxDataSize = 0 /*! Optional parameter is unused, it has been kept only for compatibility with the previous version */);
 
-/** Public Static Method to <b>rewind</b> the RAM buffer, i.e. to move the <b>current pointer</b> on the top of the RAM buffer */
-   static void Reset (bool clear_flag = false /*! Optional flag allows <b>clearing</b> the content of the wwhole RAM buffer too */);
+/** Public Static Method to <b>rewind</b> the image, i.e. to move the <b>current position</b> on the top of it. A save in progress is committed as a new checkpoint first */
+   static void Reset (bool clear_flag = false /*! Optional flag allows <b>releasing all the checkpoints</b> too (the next save is a new base) */);
 
-/** Public Static Method for <b>sequentially writing</b> the user data into the RAM buffer. It returns <b>true</b> if the operation is succesfully completed */
+/** Public Static Method for <b>sequentially writing</b> the user data into the image being saved. It returns <b>true</b> if the operation is succesfully completed */
    static bool ExportData (void* ptrData /*! Pointer to the user data to be written out */, int sizeofData /*! Size [byte] of the user data to be written */, const char* description = NULL /*! Field description text */);
 
-/** Public Static Method for <b>sequentially reading</b> the user data from the RAM buffer. It returns <b>true</b> if the operation is succesfully completed */
+/** Public Static Method for <b>sequentially reading</b> the user data from the selected checkpoint image. It returns <b>true</b> if the operation is succesfully completed */
    static bool ImportData (void* ptrData /*! Pointer to the user buffer where the read data will be stored */, int sizeofData /*! Size [byte] of the user data to be read */, const char* description = NULL /*! Field description text */);
 
+/** Public Static Method to <b>commit the save</b> in progress as a new checkpoint, storing only the changed blocks. It returns the <b>checkpoint number</b> (0 for the base) or -1 if there is nothing to commit */
+   static int  Checkpoint ();
+
+/** Public Static Method to <b>select the checkpoint</b> read by the following ImportData calls (rebuilt from the base and the deltas) and to rewind the image. It returns <b>true</b> if the checkpoint exists */
+   static bool Select_Checkpoint (int checkpoint /*! <b>Checkpoint number</b>, -1 for the last one */);
+
+/** Public Static Method returning the <b>number of the checkpoints</b> */
+   static int  Get_Checkpoints_Number () { return N_Checkpoints; };
+
+/** Public Static Method returning the <b>size [byte]</b> of the selected checkpoint image (0 if none) */
+   static int  Get_Image_Size ();
+
+/** Public Static Method returning the <b>number of the blocks</b> stored by a checkpoint, i.e. the changed ones */
+   static int  Get_Checkpoint_Blocks (int checkpoint /*! <b>Checkpoint number</b> */) { return (checkpoint >= 0 && checkpoint < N_Checkpoints) ? Checkpoints[checkpoint].n_blocks : 0; };
+
+/** Public Static Method to copy the selected checkpoint image into <b>DataStorage</b> (grown as needed, so it may move), DataSize is its size. It returns <b>true</b> if the operation is succesfully completed */
+   static bool Flatten ();
+
+/** Public Static Method to <b>load a flat image</b> (e.g. DataStorage restored by Level3) as a new checkpoint, selected for the following ImportData calls. It returns <b>true</b> if the operation is succesfully completed */
+   static bool Load_Image (const uint8_t* image /*! Flat <b>image</b> */, int size /*! Image <b>size</b> [byte] */);
+
+/** Public Static Method to set the <b>model name</b> of the following ExportData fields in the fields index (the string shall persist until the save is committed) */
+   static void Set_Model_Name (const char* model_name /*! <b>Model name</b>, NULL for none */) { Model_Name = model_name; Model_Pool = -1; };
+
+/** Public Static Method to <b>write the last checkpoint</b> in a file by the background thread, after the previous file (if any) has been completed. It returns <b>true</b> if the writing has been started */
+   static bool Write_File (const char* file_name /*! Checkpoint <b>file name</b> */, bool compress = true /*! Flag to <b>LZ compress</b> the blocks */);
+
+/** Public Static Method to <b>wait for the checkpoint file</b> being written, if any. It returns <b>false</b> if the last file could not be written */
+   static bool Wait_File ();
+
+/** Public Static Method to <b>read a checkpoint file</b> as a new checkpoint, selected for the following ImportData calls. It returns <b>true</b> if the operation is succesfully completed */
+   static bool Read_File (const char* file_name /*! Checkpoint <b>file name</b> */);
+
+/** Public Static Method to move the current position to a <b>field</b> of the last checkpoint, found in the fields index. It returns <b>true</b> if the field exists */
+   static bool Locate_Field (const char* model_name /*! <b>Model name</b> */, const char* description /*! <b>Field description</b> */);
+
 protected:
 
 /** <b>Virtual</b> Protected Method to be called by Level3 on the occurence of the "SAVE" event */
@@ -94,6 +263,38 @@ protected:
 /** <b>Virtual</b> Protected Method to be called by Level3 on the occurence of the "RESTORE" event */
    virtual bool Restore() { return true; };
 
+private:
+
+/** Private Static Method appending bytes to the image being saved, block by block */
+   static void Write (const uint8_t* data, int size);
+
+/** Private Static Method comparing the complete (or last) staging block with the last checkpoint one, kept as pending if changed */
+   static void Commit_Block (int index, int used);
+
+/** Private Static Method releasing all the checkpoints and the save in progress */
+   static void Release ();
+
+/** Private Static Method discarding the save in progress */
+   static void Abort ();
+
+/** Private Static Method adding a field to the fields index */
+   static void Add_Field (int offset, int size, const char* description);
+
+/** Private Static Method adding a name to the names pool, returning its position */
+   static int  Add_Name (const char* name);
+
+/** Private Static Method writing a trace line of the data saved or restored on a debug file */
+   static void Trace_Data (FILE* f, const void* ptrData, int sizeofData, const char* description);
+
+/** Private Static Method implementing the <b>background thread</b> writing a checkpoint file */
+   static void* File_Writer_Thread (void* job);
+
+/** Private Static Method writing a checkpoint file through a shared memory mapping */
+   static bool Write_Mapped_File (typ_file_job* job);
+
+/** Private Static Method returning the <b>hash</b> of a block */
+   static uint64_t Hash_Block (const uint8_t* block);
+
 };
 
 #endif
@@ -0,0 +1,160 @@
+/******************************************************************************
+
+    PROJECT:      DSS - S/C Dynamics Simulation Software
+    FILE:         CommandIngestQueue.cpp
+    RELEASE:      0.01
+    AUTHOR:       DSS Team
+    DATE:         2026/10/19
+
+    OVERVIEW
+    ========
+    Source Code for the thread-safe Commands Ingestion Queue
+
+    CHANGE LOG
+    ==========
+
+******************************************************************************/
+
+#include "CommandIngestQueue.h"
+
+//-------------------------------------------------------------------------
+CommandTicket::CommandTicket (unsigned long posting_sequence)
+//-------------------------------------------------------------------------
+{
+   sequence   = posting_sequence;
+   completed  = 0;
+   result     = Error;
+   references = 2;
+   pthread_mutex_init (&mutex, NULL);
+   pthread_cond_init  (&condition, NULL);
+}
+
+//-------------------------------------------------------------------------
+CommandTicket::~CommandTicket ()
+//-------------------------------------------------------------------------
+{
+   pthread_cond_destroy  (&condition);
+   pthread_mutex_destroy (&mutex);
+}
+
+//-------------------------------------------------------------------------
+typ_return CommandTicket::Wait ()
+//-------------------------------------------------------------------------
+{
+   pthread_mutex_lock (&mutex);
+   while (!completed)
+      pthread_cond_wait (&condition, &mutex);
+   pthread_mutex_unlock (&mutex);
+   return result;
+}
+
+//-------------------------------------------------------------------------
+void CommandTicket::Complete (typ_return command_result)
+//-------------------------------------------------------------------------
+{
+   pthread_mutex_lock (&mutex);
+   if (!completed)
+   {
+      result = command_result;
+      __atomic_store_n (&completed, 1, __ATOMIC_RELEASE);
+      pthread_cond_broadcast (&condition);
+   }
+   pthread_mutex_unlock (&mutex);
+}
+
+//-------------------------------------------------------------------------
+void CommandTicket::Release ()
+//-------------------------------------------------------------------------
+{
+   if (__atomic_sub_fetch (&references, 1, __ATOMIC_ACQ_REL) == 0)
+      delete this;
+}
+
+//-------------------------------------------------------------------------
+CommandIngestQueue::CommandIngestQueue ()
+//-------------------------------------------------------------------------
+{
+   memset (&stub, '\0', sizeof(stub));
+   head          = &stub;
+   tail          = &stub;
+   next_sequence = 0;
+}
+
+//-------------------------------------------------------------------------
+CommandIngestQueue::~CommandIngestQueue ()
+//-------------------------------------------------------------------------
+{
+   typ_Posted  *node;
+
+   while ((node = Pop ()))
+   {
+      CommandQueue::Delete (node->command);
+      delete node;
+   }
+}
+
+//-------------------------------------------------------------------------
+unsigned long CommandIngestQueue::Post (CommandQueue::typ_Command *command, bool immediate, CommandTicket **ticket)
+//-------------------------------------------------------------------------
+{
+   typ_Posted     *node;
+   unsigned long  sequence;
+
+   sequence = __atomic_fetch_add (&next_sequence, 1, __ATOMIC_RELAXED);
+   if (ticket)
+      *ticket = command->ticket = new CommandTicket (sequence);
+
+   node = new typ_Posted;
+   node->next      = NULL;
+   node->command   = command;
+   node->immediate = immediate;
+   Push (node);
+   return sequence;
+}
+
+//-------------------------------------------------------------------------
+void CommandIngestQueue::Push (typ_Posted *node)
+//-------------------------------------------------------------------------
+{
+   typ_Posted  *previous;
+
+   __atomic_store_n (&node->next, (typ_Posted*)NULL, __ATOMIC_RELAXED);
+   previous = __atomic_exchange_n (&head, node, __ATOMIC_ACQ_REL);   // Serialization point among the producers
+   __atomic_store_n (&previous->next, node, __ATOMIC_RELEASE);      // Make the node visible to the consumer
+}
+
+//-------------------------------------------------------------------------
+CommandIngestQueue::typ_Posted* CommandIngestQueue::Pop ()
+//-------------------------------------------------------------------------
+{
+   typ_Posted  *node = tail;
+   typ_Posted  *next = __atomic_load_n (&node->next, __ATOMIC_ACQUIRE);
+
+// Skip the stub node
+   if (node == &stub)
+   {
+      if (!next)
+         return NULL; // Empty queue
+      tail = node = next;
+      next = __atomic_load_n (&node->next, __ATOMIC_ACQUIRE);
+   }
+   if (next)
+   {
+      tail = next;
+      return node;
+   }
+
+// The node is the last one: if a producer is linking a new node, retry at the next drain
+   if (node != __atomic_load_n (&head, __ATOMIC_ACQUIRE))
+      return NULL;
+
+// Re-insert the stub node to be able to detach the last one
+   Push (&stub);
+   next = __atomic_load_n (&node->next, __ATOMIC_ACQUIRE);
+   if (next)
+   {
+      tail = next;
+      return node;
+   }
+   return NULL;
+}
@@ -0,0 +1,137 @@
+#if !defined(__CommandIngestQueue_h) // Use file only if it's not already included.
+#define __CommandIngestQueue_h
+
+/******************************************************************************
+
+    PROJECT:      DSS - S/C Dynamics Simulation Software
+    FILE:         CommandIngestQueue.h
+    RELEASE:      0.01
+    AUTHOR:       DSS Team
+    DATE:         2026/10/19
+
+    OVERVIEW
+    ========
+    Header file for the thread-safe Commands Ingestion Queue.
+    Any thread (e.g. external tools, ground segment links, parallel model
+    updates) can post commands, which are parsed on the posting thread and
+    pushed into a lock-free multiple-producers/single-consumer queue
+    (intrusive Vyukov MPSC list, one atomic exchange per push).
+    The simulation kernel drains the whole queue in one batch at a defined
+    point of the step (see GenericObject::Dispatch_Commands), so that the
+    commands are never executed concurrently with the models.
+    Each posted command gets a sequence number and, on request, a
+    completion ticket the posting thread can wait on.
+
+    CHANGE LOG
+    ==========
+
+******************************************************************************/
+
+#include <pthread.h>
+#include "CommandQueue.h"
+
+/**
+* Class definition for the <b>posted Command completion ticket</b> (future).
+* It is shared by the posting thread and by the queued command record; it is deleted when both have released it.
+*/
+
+class CommandTicket
+{
+
+/*-------------------------------------------------------------------------
+   Data declarations
+-------------------------------------------------------------------------*/
+
+private:
+
+   unsigned long              sequence;                        //!<  Posting <b>sequence number</b> of the command
+   volatile int               completed;                       //!<  Flag to say the command has been <b>executed</b> (or discarded)
+   typ_return                 result;                          //!<  Command execution <b>Return code</b>
+   int                        references;                      //!<  Number of the owners (posting thread and command record)
+   pthread_mutex_t            mutex;                           //!<  Mutex protecting the completion notification
+   pthread_cond_t             condition;                       //!<  Condition variable signalled at completion
+
+/*-------------------------------------------------------------------------
+   Function declarations
+-------------------------------------------------------------------------*/
+
+public:
+
+/** Class <b>Constructor</b>, the ticket is owned by the posting thread and by the command record*/
+   CommandTicket (unsigned long posting_sequence /*! Posting <b>sequence number</b> of the command*/);
+
+/** Public Method to return the posting <b>sequence number</b> of the command*/
+   inline unsigned long          Get_Sequence ()   {return sequence;};
+/** Public Method to say whether the command has been <b>executed</b> (or discarded), without blocking*/
+   inline bool                   Is_Completed ()   {return __atomic_load_n (&completed, __ATOMIC_ACQUIRE) != 0;};
+/** Public Method to return the command execution <b>Return code</b> (Error if not completed yet)*/
+   inline typ_return             Get_Result ()     {return Is_Completed () ? result : Error;};
+/** Public Method to <b>wait for the command execution</b> and return its <b>Return code</b>. It shall not be called by the simulation thread*/
+   typ_return                    Wait ();
+/** Public Method to notify the <b>command completion</b> (used by the kernel, only the first notification is taken into account)*/
+   void                          Complete (typ_return command_result /*! Command execution <b>Return code</b>*/);
+/** Public Method to <b>release the ticket</b>; the ticket shall not be used by the caller anymore*/
+   void                          Release ();
+
+private:
+
+/** Class <b>Destructor</b>, called by the last Release*/
+   ~CommandTicket ();
+
+};
+
+/**
+* Class definition for the <b>lock-free multiple-producers/single-consumer Commands Ingestion Queue</b>.
+*/
+
+class CommandIngestQueue
+{
+
+/*-------------------------------------------------------------------------
+   Data Type declarations
+-------------------------------------------------------------------------*/
+
+public:
+
+   struct typ_Posted    /** Data structure type to store a <b>posted command</b> (queue node)*/
+   {
+      typ_Posted                 *next;               //!< Next posted command (queue link)
+      CommandQueue::typ_Command  *command;            //!< Pre-parsed <b>command record</b>
+      bool                       immediate;           //!< Flag to say the command shall be executed when drained, rather than scheduled at its dispatching time
+   };
+
+/*-------------------------------------------------------------------------
+   Data declarations
+-------------------------------------------------------------------------*/
+
+private:
+
+   typ_Posted                 *head;                           //!<  Last pushed node (producers side)
+   typ_Posted                 *tail;                           //!<  Next node to be popped (consumer side)
+   typ_Posted                 stub;                            //!<  Stub node, never carrying a command
+   unsigned long              next_sequence;                   //!<  Sequence number to be assigned to the next posted command
+
+/*-------------------------------------------------------------------------
+   Function declarations
+-------------------------------------------------------------------------*/
+
+public:
+
+/** Class <b>Constructor</b>*/
+   CommandIngestQueue ();
+/** Class <b>Destructor</b>, it discards the commands not drained yet*/
+   ~CommandIngestQueue ();
+
+/** Public Method (thread-safe) to <b>post a command record</b>; the queue takes the ownership of the record. Returns the command sequence number*/
+   unsigned long                 Post (CommandQueue::typ_Command *command /*! Command record built by <b>CommandQueue::Create</b>*/, bool immediate /*! Flag to execute the command when drained, rather than at its dispatching time*/, CommandTicket **ticket = NULL /*! Optional output: <b>completion ticket</b>, to be released by the caller*/);
+/** Public Method (consumer thread only) to remove the <b>oldest posted command</b>; returns NULL if the queue is empty (or a producer is still linking its node). The caller takes the ownership of the node*/
+   typ_Posted*                   Pop ();
+
+private:
+
+/** Private Method (thread-safe) to link a node at the end of the queue*/
+   void                          Push (typ_Posted *node);
+
+};
+
+#endif // __CommandIngestQueue_h end
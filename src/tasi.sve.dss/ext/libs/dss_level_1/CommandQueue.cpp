@@ -0,0 +1,257 @@
+/******************************************************************************
+
+    PROJECT:      DSS - S/C Dynamics Simulation Software
+    FILE:         CommandQueue.cpp
+    RELEASE:      0.01
+    AUTHOR:       DSS Team
+    DATE:         2026/10/19
+
+    OVERVIEW
+    ========
+    Source Code for the time-ordered Commands Queue
+
+    CHANGE LOG
+    ==========
+   DSS Team       2026/10/19  "Delete" releases the typed arguments of the command record; "Forget_Target" also resets the
+                              identification of the Model class commands, to be done again on the Model resolved when dispatched
+   DSS Team       2026/10/19  "Delete" completes (with Error, if not done yet) and releases the command completion ticket
+
+******************************************************************************/
+
+#include "CommandQueue.h"
+#include "CommandIngestQueue.h"
+
+//-------------------------------------------------------------------------
+CommandQueue::CommandQueue ()
+//-------------------------------------------------------------------------
+{
+   heap          = NULL;
+   n_commands    = 0;
+   capacity      = 0;
+   next_sequence = 0;
+}
+
+//-------------------------------------------------------------------------
+CommandQueue::~CommandQueue ()
+//-------------------------------------------------------------------------
+{
+   Clear ();
+   if (heap)
+      delete [] heap;
+   heap     = NULL;
+   capacity = 0;
+}
+
+//-------------------------------------------------------------------------
+typ_return CommandQueue::Push (typ_Command *command)
+//-------------------------------------------------------------------------
+{
+   typ_Command    **old_heap;
+
+   if (!command)
+      return Error;
+
+// Grow the heap by doubling its size when it is full
+   if (n_commands == capacity)
+   {
+      old_heap = heap;
+      heap     = new typ_Command*[capacity ? 2*capacity : COMMAND_QUEUE_INITIAL_SIZE];
+      if (!heap)
+      {
+         heap = old_heap;
+         return Error;
+      }
+      if (old_heap)
+      {
+         memcpy (heap, old_heap, n_commands*sizeof(typ_Command*));
+         delete [] old_heap;
+      }
+      capacity = capacity ? 2*capacity : COMMAND_QUEUE_INITIAL_SIZE;
+   }
+
+// Insert the new record as last leaf and restore the heap order
+   command->sequence  = next_sequence++;
+   heap[n_commands++] = command;
+   SiftUp (n_commands-1);
+   return Nominal;
+}
+
+//-------------------------------------------------------------------------
+CommandQueue::typ_Command* CommandQueue::Pop ()
+//-------------------------------------------------------------------------
+{
+   typ_Command    *command;
+
+   if (!n_commands)
+      return NULL;
+
+   command = heap[0];
+   heap[0] = heap[--n_commands];
+   heap[n_commands] = NULL;
+   if (n_commands > 1)
+      SiftDown (0);
+   return command;
+}
+
+//-------------------------------------------------------------------------
+void CommandQueue::Clear ()
+//-------------------------------------------------------------------------
+{
+   int   i;
+
+   for (i = 0; i < n_commands; i++)
+      Delete (heap[i]);
+   n_commands = 0;
+}
+
+//-------------------------------------------------------------------------
+void CommandQueue::Forget_Target (GenericObject *pTarget)
+//-------------------------------------------------------------------------
+{
+   int   i;
+
+   for (i = 0; i < n_commands; i++)
+      if (heap[i]->pTarget == pTarget)
+      {
+         heap[i]->pTarget = NULL;
+         if (heap[i]->handler == Class_Handler || heap[i]->handler == Text_Parser)
+            heap[i]->handler = Not_Compiled;
+      }
+}
+
+//-------------------------------------------------------------------------
+void CommandQueue::SiftUp (int i)
+//-------------------------------------------------------------------------
+{
+   int            parent;
+   typ_Command    *command = heap[i];
+
+   while (i > 0)
+   {
+      parent = (i-1) / 2;
+      if (!Precedes (command, heap[parent]))
+         break;
+      heap[i] = heap[parent];
+      i       = parent;
+   }
+   heap[i] = command;
+}
+
+//-------------------------------------------------------------------------
+void CommandQueue::SiftDown (int i)
+//-------------------------------------------------------------------------
+{
+   int            child;
+   typ_Command    *command = heap[i];
+
+   while ((child = 2*i+1) < n_commands)
+   {
+      if (child+1 < n_commands && Precedes (heap[child+1], heap[child]))
+         child++;
+      if (!Precedes (heap[child], command))
+         break;
+      heap[i] = heap[child];
+      i       = child;
+   }
+   heap[i] = command;
+}
+
+//-------------------------------------------------------------------------
+CommandQueue::typ_Command* CommandQueue::Create (const char *command_string, double elapsed_time)
+//-------------------------------------------------------------------------
+{
+   typ_Command    *command;
+   char           *c, *end, *dot;
+   int            length, i;
+
+   if (!command_string)
+      return NULL;
+
+// Skip the leading blanks and the trailing blanks/new-lines
+   command_string += strspn (command_string, " \t");
+   length = strlen (command_string);
+   while (length > 0 && strchr (" \t\r\n", command_string[length-1]))
+      length--;
+   if (!length)
+      return NULL;
+
+   command = new typ_Command;
+   if (!command)
+      return NULL;
+   memset (command, '\0', sizeof(typ_Command));
+   command->elapsed_time = elapsed_time;
+
+// Keep a copy of the original text and a working copy to be tokenized
+   command->text    = new char [length+1];
+   command->storage = new char [length+1];
+   if (!command->text || !command->storage)
+   {
+      Delete (command);
+      return NULL;
+   }
+   memcpy (command->text,    command_string, length);
+   memcpy (command->storage, command_string, length);
+   command->text   [length] = '\0';
+   command->storage[length] = '\0';
+
+// The command is addressed to a Model if a dot precedes the first comma: ModelName.CommandName,param1,parm2,....
+   end = strchr (command->storage, ',');
+   dot = strchr (command->storage, '.');
+   if (dot && (!end || dot < end))
+   {
+      *dot                  = '\0';
+      command->model_name   = command->storage;
+      command->command_name = dot + 1;
+   }
+   else // Static command: CommandName,param1,parm2,....
+      command->command_name = command->storage;
+
+// Count the parameters (empty tokens are skipped, as "strtok" does)
+   command->n_parameters = 0;
+   for (c = end; c; c = strchr (c+1, ','))
+      if (c[1] && c[1] != ',')
+         command->n_parameters++;
+
+   command->parameters = new char* [command->n_parameters+1];
+   if (!command->parameters)
+   {
+      Delete (command);
+      return NULL;
+   }
+
+// Split the parameters in place
+   i = 0;
+   for (c = end; c; c = end)
+   {
+      *c  = '\0';
+      end = strchr (c+1, ',');
+      if (c[1] && c[1] != ',')
+         command->parameters[i++] = c + 1;
+   }
+   command->parameters[i] = NULL;
+
+   return command;
+}
+
+//-------------------------------------------------------------------------
+void CommandQueue::Delete (typ_Command *&command)
+//-------------------------------------------------------------------------
+{
+   if (!command)
+      return;
+   if (command->ticket)
+   {
+      command->ticket->Complete (Error); // Discarded command, if not executed
+      command->ticket->Release ();
+   }
+   if (command->args)
+      delete [] command->args;
+   if (command->parameters)
+      delete [] command->parameters;
+   if (command->storage)
+      delete [] command->storage;
+   if (command->text)
+      delete [] command->text;
+   delete command;
+   command = NULL;
+}
@@ -0,0 +1,131 @@
+#if !defined(__CommandQueue_h) // Use file only if it's not already included.
+#define __CommandQueue_h
+
+/******************************************************************************
+
+    PROJECT:      DSS - S/C Dynamics Simulation Software
+    FILE:         CommandQueue.h
+    RELEASE:      0.01
+    AUTHOR:       DSS Team
+    DATE:         2026/10/19
+
+    OVERVIEW
+    ========
+    Header file for the time-ordered Commands Queue used by the GenericObject
+    kernel to schedule the "MODEL_COMMAND_STACK" entries and the commands
+    inserted at run-time.
+    The command strings are parsed once, when queued, into command records
+    (dispatching time, target model, command name and parameter tokens) kept
+    in a binary min-heap ordered by dispatching time and insertion order.
+
+    CHANGE LOG
+    ==========
+   DSS Team       2026/10/19  Added to the command records the schema of the identified command and the typed arguments
+                              converted when the command is queued (see "CommandTable").
+   DSS Team       2026/10/19  Added to the command records the optional completion ticket of the posted commands.
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "GenericTypes.h"
+#include "CommandTable.h"
+
+class GenericObject;
+class CommandTicket;
+
+#define  COMMAND_QUEUE_INITIAL_SIZE       64                            //!< Initial number of command records allocated by the <b>Commands Queue</b> (it grows by doubling)
+
+/**
+* Class definition for the <b>time-ordered Commands Queue</b>.
+* It stores pre-parsed command records in a binary min-heap, keyed by the dispatching time and, for equal times, by the insertion order.
+*/
+
+class CommandQueue
+{
+
+/*-------------------------------------------------------------------------
+   Data Type declarations
+-------------------------------------------------------------------------*/
+
+public:
+
+   enum typ_Handler     /** <b>Command handler</b> type, identified when the command record is compiled */
+   {
+      Not_Compiled,                          //!< Command not identified yet (e.g. target Model not registered yet when queued)
+      Generic_Handler,                       //!< Command declared in the <b>GenericObject commands table</b>
+      Class_Handler,                         //!< Command declared in the <b>Model class commands table</b>
+      Static_Handler,                        //!< Command declared in the <b>static commands table</b>
+      Text_Parser                            //!< Command not declared in any table, it is passed as text to the Model <b>Local_Parser</b>
+   };
+
+   struct typ_Command   /** Data structure type to store a <b>pre-parsed command record</b> */
+   {
+      double            elapsed_time;        //!< Command dispatching <b>Time from Simulation Beginning</b> [s]
+      unsigned long     sequence;            //!< Insertion <b>sequence number</b>, used to keep the queueing order among commands having the same dispatching time
+      GenericObject     *pTarget;            //!< Pointer to the <b>target Model</b> (NULL for static commands or when not resolved yet)
+      char              *model_name;         //!< <b>Target Model name</b> (NULL for static commands)
+      char              *command_name;       //!< <b>Command name</b> (model specific or static)
+      int               n_parameters;        //!< Number of the <b>Text-Parameters</b> following the command name
+      char              **parameters;        //!< Array of pointers to the <b>Text-Parameters</b> (NULL terminated)
+      char              *text;               //!< Copy of the original <b>Command String</b>, used for logging purposes
+      char              *storage;            //!< RAM buffer storing the tokenized command string
+      typ_Handler       handler;             //!< <b>Command handler</b> type
+      const CommandTable::typ_CommandSchema  *schema;   //!< Schema of the identified command (NULL if not declared in any table)
+      CommandTable::typ_CommandArg           *args;     //!< Array of the <b>typed arguments</b> converted from the Text-Parameters (NULL if not declared in any table)
+      CommandTicket     *ticket;             //!< <b>Completion ticket</b> of a posted command (NULL if not requested)
+   };
+
+/*-------------------------------------------------------------------------
+   Data declarations
+-------------------------------------------------------------------------*/
+
+private:
+
+   typ_Command                **heap;                          //!<  Binary min-heap of the queued command records
+   int                        n_commands;                      //!<  Number of the queued command records
+   int                        capacity;                        //!<  Number of the allocated heap entries
+   unsigned long              next_sequence;                   //!<  Sequence number to be assigned to the next queued command
+
+/*-------------------------------------------------------------------------
+   Function declarations
+-------------------------------------------------------------------------*/
+
+public:
+
+/** Class <b>Constructor</b>*/
+   CommandQueue ();
+/** Class <b>Destructor</b>, it deletes all the queued command records*/
+   ~CommandQueue ();
+
+/** Public Method to <b>queue a command record</b>; the queue takes the ownership of the record*/
+   typ_return                    Push (typ_Command *command /*! Command record to be queued, built by <b>Create</b>*/);
+/** Public Method to return the <b>earliest queued command record</b> without removing it (NULL if the queue is empty)*/
+   inline typ_Command*           Top ()      {return n_commands ? heap[0] : NULL;};
+/** Public Method to remove from the queue and return the <b>earliest queued command record</b> (NULL if the queue is empty); the caller takes the ownership of the record*/
+   typ_Command*                  Pop ();
+/** Public Method to return the <b>number of the queued command records</b>*/
+   inline int                    Size ()     {return n_commands;};
+/** Public Method to delete all the queued command records*/
+   void                          Clear ();
+/** Public Method to <b>unlink a Model</b> from the queued command records targeting it (the Model name is kept to resolve it again, and to identify again its Model class commands, at dispatching time)*/
+   void                          Forget_Target (GenericObject *pTarget /*! Pointer to the Model going to be destroyed*/);
+
+/** Static Public Method to <b>parse a Command String</b> (format: <b>ModelName.CommandName,param1,param2,__.</b> or <b>CommandName,param1,param2,__.</b>) into a new command record. Returns NULL if the command string is empty*/
+   static typ_Command*           Create (const char *command_string /*! Text String of the command to be parsed*/, double elapsed_time /*! Command dispatching <b>Time from Simulation Beginning</b> [s]*/);
+/** Static Public Method to <b>delete a command record</b> built by <b>Create</b>; a completion ticket not notified yet is completed with Error*/
+   static void                   Delete (typ_Command *&command /*! Command record to be deleted, it is set to NULL*/);
+
+private:
+
+/** Static Private Method to say whether the command record "a" shall be dispatched before the command record "b"*/
+   static inline bool            Precedes (const typ_Command *a, const typ_Command *b)
+      {return (a->elapsed_time < b->elapsed_time) || (a->elapsed_time == b->elapsed_time && a->sequence < b->sequence);};
+/** Private Method to move up the heap entry "i" until the heap order is restored*/
+   void                          SiftUp (int i);
+/** Private Method to move down the heap entry "i" until the heap order is restored*/
+   void                          SiftDown (int i);
+
+};
+
+#endif // __CommandQueue_h end
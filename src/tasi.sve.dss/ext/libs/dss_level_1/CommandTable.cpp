@@ -0,0 +1,214 @@
+/******************************************************************************
+
+    PROJECT:      DSS - S/C Dynamics Simulation Software
+    FILE:         CommandTable.cpp
+    RELEASE:      0.01
+    AUTHOR:       DSS Team
+    DATE:         2026/10/19
+
+    OVERVIEW
+    ========
+    Source Code for the per-class perfect-hash Commands Table
+
+    CHANGE LOG
+    ==========
+   DSS Team       2026/10/19  A command name declared twice is logged as an error and its second declaration is
+                              ignored, instead of making the seed search grow the table forever.
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "CommandTable.h"
+#include "GenericObject.h"
+
+//-------------------------------------------------------------------------
+CommandTable::CommandTable (const typ_CommandSchema schemas[], const CommandTable *parent_table)
+//-------------------------------------------------------------------------
+{
+   int            i, j;
+   unsigned int   size, h, *name_hash;
+   bool           collision, *duplicate;
+
+   schema   = schemas;
+   parent   = parent_table;
+   n_schema = 0;
+   while (schema && schema[n_schema].name)
+      n_schema++;
+
+// Command names declared twice (same hash whatever the seed): the first declaration is kept
+   name_hash = new unsigned int [n_schema + 1];
+   duplicate = new bool [n_schema + 1];
+   for (i = 0; i < n_schema; i++)
+   {
+      name_hash[i] = Hash (schema[i].name, 0);
+      duplicate[i] = false;
+      for (j = 0; j < i && !duplicate[i]; j++)
+         duplicate[i] = (name_hash[j] == name_hash[i] && !strcmp (schema[j].name, schema[i].name));
+      if (duplicate[i])
+         GenericObject::Log_Error ("Command \"%s\" is declared twice, its second declaration is ignored", schema[i].name);
+   }
+
+// Table size: power of two not lower than twice the number of commands
+   for (size = 4; size < 2*(unsigned int)n_schema; size *= 2)
+      ;
+
+// Look for a seed giving no collision, doubling the table size after too many attempts
+   slot = NULL;
+   seed = 0;
+   do
+   {
+      if (!slot || seed % 256 == 255)
+      {
+         if (slot)
+         {
+            delete [] slot;
+            size *= 2;
+         }
+         slot = new int [size];
+         mask = size - 1;
+      }
+      seed++;
+      for (i = 0; i < int(size); i++)
+         slot[i] = -1;
+      collision = false;
+      for (i = 0; i < n_schema && !collision; i++)
+      {
+         if (duplicate[i])
+            continue;
+         h = Hash (schema[i].name, seed) & mask;
+         if (slot[h] >= 0)
+            collision = true;
+         else
+            slot[h] = i;
+      }
+   }
+   while (collision);
+   delete [] name_hash;
+   delete [] duplicate;
+}
+
+//-------------------------------------------------------------------------
+CommandTable::~CommandTable ()
+//-------------------------------------------------------------------------
+{
+   if (slot)
+      delete [] slot;
+   slot = NULL;
+}
+
+//-------------------------------------------------------------------------
+unsigned int CommandTable::Hash (const char *name, unsigned int hash_seed)
+//-------------------------------------------------------------------------
+{
+   unsigned int   h = 2166136261u ^ (hash_seed * 0x9E3779B9u);
+
+// FNV-1a hashing followed by a final avalanche mixing
+   while (*name)
+   {
+      h ^= (unsigned char)*name++;
+      h *= 16777619u;
+   }
+   h ^= h >> 16;
+   h *= 0x85EBCA6Bu;
+   h ^= h >> 13;
+   return h;
+}
+
+//-------------------------------------------------------------------------
+const CommandTable::typ_CommandSchema* CommandTable::Find (const char *command_name) const
+//-------------------------------------------------------------------------
+{
+   int   i;
+
+   if (!command_name)
+      return NULL;
+   if (n_schema)
+   {
+      i = slot[Hash (command_name, seed) & mask];
+      if (i >= 0 && !strcmp (command_name, schema[i].name))
+         return schema + i;
+   }
+   return parent ? parent->Find (command_name) : NULL;
+}
+
+//-------------------------------------------------------------------------
+typ_return CommandTable::Convert (const typ_CommandSchema *command_schema, int n_parameters, char *parameters[], typ_CommandArg args[])
+//-------------------------------------------------------------------------
+{
+   const char  *type, *repeated;
+   char        *c, *end;
+   int         i, n_fixed, n_min, n_max;
+   bool        valid;
+
+// Evaluate from the schema the allowed number of arguments
+   type     = command_schema->arguments ? command_schema->arguments : "";
+   n_fixed  = strlen (type);
+   repeated = NULL;
+   n_min    = n_max = n_fixed;
+   if (n_fixed > 1 && strchr ("?*+", type[n_fixed-1]))
+   {
+      n_fixed -= 2;
+      repeated = type + n_fixed;
+      n_min    = n_fixed + (type[n_fixed+1] == '+' ? 1 : 0);
+      n_max    = type[n_fixed+1] == '?' ? n_fixed + 1 : MAX_COMMAND_PARAMETERS_NUMBER;
+   }
+   if (n_parameters < n_min || n_parameters > n_max)
+   {
+      if (n_min == n_max)
+         GenericObject::Log_Warning ("Command \"%s\" requires %i parameters, \"%i\" have been found instead", command_schema->name, n_min, n_parameters);
+      else
+         GenericObject::Log_Warning ("Command \"%s\" requires at least %i parameters, \"%i\" have been found instead", command_schema->name, n_min, n_parameters);
+      return Error;
+   }
+
+// Convert each Text-Parameter as per its type
+   for (i = 0; i < n_parameters; i++)
+   {
+      memset (args+i, '\0', sizeof(typ_CommandArg));
+      args[i].kind = (i < n_fixed) ? type[i] : *repeated;
+      args[i].s    = parameters[i];
+      c            = parameters[i] + strspn (parameters[i], " \t");
+      valid        = (*c != '\0');
+
+      if ((args[i].kind == 'f' || args[i].kind == 'x') && (*c == '*' || *c == '=') && c[1 + strspn (c+1, " \t")] == '\0')
+         args[i].kind = *c; // Forcing special tokens
+      else switch (args[i].kind)
+      {
+         case 'i':
+            args[i].i = (int) strtol (c, &end, 10);
+            args[i].d = args[i].i;
+            valid     = valid && end != c;
+            break;
+         case 'w':
+         case 'x':
+            if (*c == '#')
+               args[i].i = (int) strtoul (c+1, &end, 16);
+            else
+               args[i].i = (int) strtol (c, &end, 10);
+            args[i].d = args[i].i;
+            valid     = valid && end != c && end != c+1 && args[i].i >= -32768 && args[i].i <= 0xFFFF;
+            break;
+         case 'd':
+         case 'f':
+            args[i].d = strtod (c, &end);
+            valid     = valid && end != c;
+            break;
+         case 'c':
+            args[i].i = (unsigned char) *c;
+            end       = c + 1;
+            break;
+         default: // 's' text string
+            end = c + strlen (c);
+            break;
+      }
+      if (valid && args[i].kind != '*' && args[i].kind != '=' && end[strspn (end, " \t")] != '\0')
+         valid = false;
+      if (!valid)
+      {
+         GenericObject::Log_Warning ("Command \"%s\" : parameter %i (\"%s\") does not match the expected '%c' type", command_schema->name, i+1, parameters[i], (i < n_fixed) ? type[i] : *repeated);
+         return Error;
+      }
+   }
+   return Nominal;
+}
@@ -0,0 +1,109 @@
+#if !defined(__CommandTable_h) // Use file only if it's not already included.
+#define __CommandTable_h
+
+/******************************************************************************
+
+    PROJECT:      DSS - S/C Dynamics Simulation Software
+    FILE:         CommandTable.h
+    RELEASE:      0.01
+    AUTHOR:       DSS Team
+    DATE:         2026/10/19
+
+    OVERVIEW
+    ========
+    Header file for the Model Commands Table.
+    Each Model class declares its commands as a static array of schemas
+    (command name, class identifier and typed arguments) from which a
+    per-class perfect-hash table is built once. The table is used to
+    identify a command with a single hashing and string comparison and to
+    convert its text parameters into typed arguments when the command is
+    queued, so that dispatching is table-driven and does not parse text.
+
+    ARGUMENTS SCHEMA
+    ================
+    The arguments schema is a text string having one character per argument:
+       'i'  integer
+       'd'  double floating
+       'w'  16-bit word (decimal or hexadecimal when prefixed by '#')
+       'c'  single character
+       's'  text string
+       'f'  forcing value: double floating, or '*' / '=' special tokens
+       'x'  forcing word: 16-bit word, or '*' / '=' special tokens
+    The last character can be followed by a repetition suffix:
+       '?'  zero or one occurrence
+       '*'  zero or more occurrences
+       '+'  one or more occurrences
+
+    CHANGE LOG
+    ==========
+
+******************************************************************************/
+
+#include "GenericTypes.h"
+
+/**
+* Class definition for the <b>per-class perfect-hash Commands Table</b>.
+*/
+
+class CommandTable
+{
+
+/*-------------------------------------------------------------------------
+   Data Type declarations
+-------------------------------------------------------------------------*/
+
+public:
+
+   struct typ_CommandSchema   /** Data structure type to declare a <b>Model command</b> (the schemas array shall be terminated by a NULL name entry)*/
+   {
+      const char        *name;               //!< <b>Command name</b> (case sensitive)
+      int               id;                  //!< Class-defined <b>command identifier</b> passed to the command handler
+      const char        *arguments;          //!< <b>Arguments schema</b> (see the file overview)
+   };
+
+   struct typ_CommandArg   /** Data structure type to store a <b>typed command argument</b> */
+   {
+      char              kind;                //!< Argument <b>schema type</b>; for the forcing types it is '*' or '=' when the special token has been provided
+      int               i;                   //!< <b>Integer</b> value ('i', 'w', 'x' and 'c' types)
+      double            d;                   //!< <b>Double floating</b> value ('d' and 'f' types, and the numeric value of 'i' and 'w' types)
+      char              *s;                  //!< Pointer to the original <b>Text-Parameter</b>
+   };
+
+/*-------------------------------------------------------------------------
+   Data declarations
+-------------------------------------------------------------------------*/
+
+private:
+
+   const typ_CommandSchema    *schema;                         //!<  Declared commands schemas array
+   const CommandTable         *parent;                         //!<  Commands Table of the parent class, searched when a command is not declared by this one (NULL if none)
+   int                        n_schema;                        //!<  Number of the declared commands
+   int                        *slot;                           //!<  Perfect-hash table slots: index of the schema in the declared array, -1 if empty
+   unsigned int               mask;                            //!<  Perfect-hash table size minus one (the size is a power of two)
+   unsigned int               seed;                            //!<  Hashing seed found to avoid any collision among the declared commands
+
+/*-------------------------------------------------------------------------
+   Function declarations
+-------------------------------------------------------------------------*/
+
+public:
+
+/** Class <b>Constructor</b>, it builds the perfect-hash table for the provided commands schemas*/
+   CommandTable (const typ_CommandSchema schemas[] /*! Commands schemas array, terminated by a NULL name entry*/, const CommandTable *parent_table = NULL /*! Optional Commands Table of the parent class*/);
+/** Class <b>Destructor</b>*/
+   ~CommandTable ();
+
+/** Public Method to return the <b>schema of the named command</b>, looking also in the parent tables. Returns NULL if the command has not been declared*/
+   const typ_CommandSchema*      Find (const char *command_name /*! <b>Command name</b> to be identified*/) const;
+
+/** Static Public Method to <b>check and convert the Text-Parameters</b> of a command into typed arguments, as per the command schema. Returns Error (and logs the reason) if the parameters do not match the schema*/
+   static typ_return             Convert (const typ_CommandSchema *command_schema /*! Schema of the command*/, int n_parameters /*! Number of the <b>Text-Parameters</b>*/, char *parameters[] /*! Array of <b>Pointers to the Text-Parameters</b>*/, typ_CommandArg args[] /*! Typed arguments array (at least "n_parameters" items)*/);
+
+private:
+
+/** Static Private Method to compute the seeded <b>hash of a command name</b>*/
+   static unsigned int           Hash (const char *name, unsigned int hash_seed);
+
+};
+
+#endif // __CommandTable_h end
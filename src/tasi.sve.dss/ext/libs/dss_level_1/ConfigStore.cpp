@@ -0,0 +1,334 @@
+/******************************************************************************
+
+    PROJECT:      DSS - S/C Dynamics Simulation Software
+    FILE:         ConfigStore.cpp
+    RELEASE:      0.01
+    AUTHOR:       DSS Team
+    DATE:         2026/10/19
+
+    OVERVIEW
+    ========
+    Source Code for the Configuration Store (immutable, reference-counted
+    image of a Models Input Text File)
+
+    CHANGE LOG
+    ==========
+   DSS Team       2026/10/19  "Build" hashes the instruction value of each symbol, "Compare" lists the symbols whose
+                              value differs from another store. The lines of an array value are not indexed.
+   DSS Team       2026/10/19  "Load" compares the modification time to the nanosecond, and shares a loaded store only
+                              if its mapped content still has the same hash (file rewritten within the time resolution).
+
+******************************************************************************/
+
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "ConfigStore.h"
+#include "GenericObject.h"
+
+#define  FNV_OFFSET_BASIS   14695981039346656037ULL    // FNV-1a (64 bits) offset basis
+
+// Static Data Initialization
+
+ConfigStore*      ConfigStore::Loaded       = NULL;
+pthread_mutex_t   ConfigStore::Loaded_Mutex = PTHREAD_MUTEX_INITIALIZER;
+
+//-------------------------------------------------------------------------
+ConfigStore::ConfigStore ()
+//-------------------------------------------------------------------------
+{
+   memset (this, '\0', sizeof(ConfigStore));
+   references = 1;
+}
+
+//-------------------------------------------------------------------------
+ConfigStore::~ConfigStore ()
+//-------------------------------------------------------------------------
+{
+   if (mapped)
+      munmap ((void*) text, text_size);
+   delete [] text_copy;
+   delete [] index;
+   delete [] symbol_pool;
+   if (base)
+      base->Release ();
+}
+
+//-------------------------------------------------------------------------
+ConfigStore* ConfigStore::Load (const char *file_name, ConfigStore *base_store)
+//-------------------------------------------------------------------------
+{
+   ConfigStore    *store;
+   struct stat    status;
+   void           *map;
+   int            fd;
+
+   if (!file_name)
+      file_name = INPUTFILE_DEFAULT;
+   if (strlen (file_name) >= LINE_SIZE)
+      return NULL;
+   fd = open (file_name, O_RDONLY);
+   if (fd < 0)
+      return NULL;
+   if (fstat (fd, &status))
+   {
+      close (fd);
+      return NULL;
+   }
+
+// Shared store of the same (unchanged) file, if already loaded: same status, to the nanosecond, and same content
+// (the pages of the private mapping not written show the file rewritten in place)
+   pthread_mutex_lock (&Loaded_Mutex);
+   for (store = base_store ? NULL : Loaded; store; store = store->next_loaded)
+      if (!strcmp (store->name, file_name) && store->file_device == status.st_dev && store->file_inode == status.st_ino
+       && store->file_time.tv_sec == status.st_mtim.tv_sec && store->file_time.tv_nsec == status.st_mtim.tv_nsec
+       && store->text_size == (unsigned long) status.st_size && Content_Hash (store->text, store->text_size, FNV_OFFSET_BASIS) == store->hash)
+      {
+         __atomic_add_fetch (&store->references, 1, __ATOMIC_RELAXED);
+         break;
+      }
+
+// Map the file in memory (an empty file is mapped on an empty string) and index it
+   if (!store)
+   {
+      map = (status.st_size > 0) ? mmap (NULL, status.st_size, PROT_READ, MAP_PRIVATE, fd, 0) : (void*) "";
+      if (map != MAP_FAILED)
+      {
+         if (status.st_size > 0)
+            madvise (map, status.st_size, MADV_SEQUENTIAL);
+         store = new ConfigStore;
+         strcpy (store->name, file_name);
+         store->text        = (const char*) map;
+         store->text_size   = status.st_size;
+         store->mapped      = (status.st_size > 0);
+         store->file_device = status.st_dev;
+         store->file_inode  = status.st_ino;
+         store->file_time   = status.st_mtim;
+         store->Build (base_store);
+         if (!base_store)
+         {
+            store->next_loaded = Loaded;
+            Loaded             = store;
+         }
+      }
+   }
+   pthread_mutex_unlock (&Loaded_Mutex);
+   close (fd);
+   return store;
+}
+
+//-------------------------------------------------------------------------
+ConfigStore* ConfigStore::Create (const char *store_text, const char *store_name, ConfigStore *base_store)
+//-------------------------------------------------------------------------
+{
+   ConfigStore    *store = new ConfigStore;
+
+   strncpy (store->name, store_name ? store_name : "", LINE_SIZE-1);
+   store->text_size = strlen (store_text);
+   store->text_copy = new char[store->text_size + 1];
+   memcpy (store->text_copy, store_text, store->text_size + 1);
+   store->text      = store->text_copy;
+   store->Build (base_store);
+   return store;
+}
+
+//-------------------------------------------------------------------------
+void ConfigStore::Acquire ()
+//-------------------------------------------------------------------------
+{
+   __atomic_add_fetch (&references, 1, __ATOMIC_RELAXED);
+}
+
+//-------------------------------------------------------------------------
+void ConfigStore::Release ()
+//-------------------------------------------------------------------------
+{
+   ConfigStore    **link;
+   bool           last;
+
+// The shared stores list is locked, so that "Load" never shares a store being deleted
+   pthread_mutex_lock (&Loaded_Mutex);
+   last = (__atomic_sub_fetch (&references, 1, __ATOMIC_ACQ_REL) == 0);
+   if (last)
+      for (link = &Loaded; *link; link = &(*link)->next_loaded)
+         if (*link == this)
+         {
+            *link = next_loaded;
+            break;
+         }
+   pthread_mutex_unlock (&Loaded_Mutex);
+   if (last)
+      delete this;
+}
+
+//-------------------------------------------------------------------------
+const ConfigStore::typ_Symbol* ConfigStore::Find (const char *symbol, const ConfigStore* &layer) const
+//-------------------------------------------------------------------------
+{
+   unsigned int   symbol_hash = Hash (symbol);
+   unsigned long  i;
+
+   for (layer = this; layer; layer = layer->base)
+      for (i = symbol_hash & (layer->index_size-1); layer->index[i].name; i = (i+1) & (layer->index_size-1))
+         if (layer->index[i].hash == symbol_hash && !strcmp (layer->index[i].name, symbol))
+            return &layer->index[i];
+   return NULL;
+}
+
+//-------------------------------------------------------------------------
+int ConfigStore::Compare (const ConfigStore *previous, const char *changed[]) const
+//-------------------------------------------------------------------------
+{
+   const ConfigStore *layer, *found_layer;
+   const typ_Symbol  *symbol, *other;
+   unsigned long     i;
+   int               n_changed = 0;
+
+// Symbols read from this store (in the highest layer defining each one) having a new value, or not defined by the previous store
+   for (layer = this; layer; layer = layer->base)
+      for (i = 0; i < layer->index_size; i++)
+      {
+         symbol = &layer->index[i];
+         if (!symbol->name || Find (symbol->name, found_layer) != symbol)
+            continue;
+         other = previous ? previous->Find (symbol->name, found_layer) : NULL;
+         if (!other || other->value_hash != symbol->value_hash)
+            changed[n_changed++] = symbol->name;
+      }
+
+// Symbols of the previous store no more defined
+   for (layer = previous; layer; layer = layer->base)
+      for (i = 0; i < layer->index_size; i++)
+      {
+         symbol = &layer->index[i];
+         if (symbol->name && previous->Find (symbol->name, found_layer) == symbol && !Find (symbol->name, found_layer))
+            changed[n_changed++] = symbol->name;
+      }
+   return n_changed;
+}
+
+//-------------------------------------------------------------------------
+int ConfigStore::Get_N_Symbols () const
+//-------------------------------------------------------------------------
+{
+   const ConfigStore *layer;
+   int               n = 0;
+
+   for (layer = this; layer; layer = layer->base)
+      n += layer->n_symbols;
+   return n;
+}
+
+//-------------------------------------------------------------------------
+unsigned int ConfigStore::Hash (const char *symbol)
+//-------------------------------------------------------------------------
+{
+   unsigned int   symbol_hash = 2166136261u; // FNV-1a
+
+   for (; *symbol; symbol++)
+      symbol_hash = (symbol_hash ^ (unsigned char) *symbol) * 16777619u;
+   return symbol_hash;
+}
+
+//-------------------------------------------------------------------------
+unsigned long long ConfigStore::Content_Hash (const char *content, unsigned long size, unsigned long long base_hash)
+//-------------------------------------------------------------------------
+{
+   unsigned long  i;
+
+   for (i = 0; i < size; i++)
+      base_hash = (base_hash ^ (unsigned char) content[i]) * 1099511628211ULL;
+   return base_hash;
+}
+
+//-------------------------------------------------------------------------
+void ConfigStore::Build (ConfigStore *base_store)
+//-------------------------------------------------------------------------
+{
+   InputFile      reader;
+   typ_Symbol     *entry, *value_entry = NULL;
+   unsigned long  i, lines = 1, start, pool_size = 0;
+   unsigned int   symbol_hash;
+   int            start_line;
+   char           *c, *next, *token_state;
+   bool           open_array = false;
+
+// Content hash (FNV-1a, 64 bits) chained to the base layers one
+   if (base_store)
+      base_store->Acquire ();
+   base = base_store;
+   hash = Content_Hash (text, text_size, base ? base->hash : FNV_OFFSET_BASIS);
+
+// Hash table sized for at least twice the number of the lines
+   for (i = 0; i < text_size; i++)
+      if (text[i] == '\n')
+         lines++;
+   for (index_size = 16; index_size < 2*lines; index_size <<= 1)
+      ;
+   index = new typ_Symbol[index_size];
+   memset (index, '\0', index_size * sizeof(typ_Symbol));
+   symbol_pool = new char[text_size + 1]; // The symbols are line substrings separated by at least one character
+
+// Read the lines as "InputFile::readSymbol" does, indexing the first occurrence of each first token
+   reader.text      = text;
+   reader.text_size = text_size;
+   while (!reader.end_of_file)
+   {
+      start      = reader.position;
+      start_line = reader.iline;
+      reader.ReadLine ();
+
+// A line of a not closed array belongs to its value, unless it looks like a new instruction ("symbol = ...")
+      if (open_array)
+      {
+         next  = reader.line + strspn (reader.line, SEPARATORS);
+         next += strcspn (next, SEPARATORS);
+         next += strspn (next, SEPARATORS);
+         open_array = !(next[0] == '=' && next[1] == ' ');
+      }
+      c = strtok_r (reader.line, SEPARATORS, &token_state);
+      if (!c)
+         continue;
+      if (!open_array)
+      {
+         value_entry = NULL;
+         symbol_hash = Hash (c);
+         for (i = symbol_hash & (index_size-1); index[i].name; i = (i+1) & (index_size-1))
+            if (index[i].hash == symbol_hash && !strcmp (index[i].name, c))
+               break;
+         entry = &index[i];
+         if (!entry->name)
+         {
+            entry->name       = strcpy (symbol_pool + pool_size, c);
+            entry->hash       = symbol_hash;
+            entry->line       = start_line;
+            entry->position   = start;
+            entry->value_hash = 14695981039346656037ULL;
+            pool_size        += strlen (c) + 1;
+            n_symbols++;
+            value_entry = entry;
+         }
+         c = strtok_r (NULL, SEPARATORS, &token_state);
+      }
+
+// Value hash (FNV-1a, 64 bits) of the tokens, the lines of an array value included
+      for (; c; c = strtok_r (NULL, SEPARATORS, &token_state))
+      {
+         if (!strcmp (c, "["))
+            open_array = true;
+         else if (!strcmp (c, "]"))
+            open_array = false;
+         if (value_entry)
+         {
+            for (next = c; *next; next++)
+               value_entry->value_hash = (value_entry->value_hash ^ (unsigned char) *next) * 1099511628211ULL;
+            value_entry->value_hash = (value_entry->value_hash ^ ' ') * 1099511628211ULL;
+         }
+      }
+   }
+   n_lines     = reader.iline;
+   reader.text = NULL; // The reader does not own the text
+   GenericObject::Log_Write ("Configuration \"%s\" : %d symbols indexed over %d lines\n", name, n_symbols, n_lines);
+}
@@ -0,0 +1,152 @@
+#if !defined(__ConfigStore_h) // Use file only if it's not already included.
+#define __ConfigStore_h
+
+/******************************************************************************
+
+    PROJECT:      DSS - S/C Dynamics Simulation Software
+    FILE:         ConfigStore.h
+    RELEASE:      0.01
+    AUTHOR:       DSS Team
+    DATE:         2026/10/19
+
+    OVERVIEW
+    ========
+    Header file for the Configuration Store: immutable, reference-counted
+    image of a Models Input Text File (set file), i.e. its memory-mapped
+    text and the index of its symbols, built once and then only read.
+    Any number of "InputFile" readers, owned by different threads or by
+    different simulation instances, can query the same store at the same
+    time: all the reading state (current line, tokens buffer) belongs to
+    the readers.
+    The stores loaded from the same file are shared ("Load" returns the
+    already loaded store while the file is unchanged).
+    A store may be layered on top of a base store ("overlay"), e.g. to
+    override some parameters of a batch run:
+
+       ConfigStore *base = ConfigStore::Load ("dss.set");
+       ConfigStore *run  = ConfigStore::Create ("GYRO1.BIAS = 0.1\n", "run 17", base);
+       GenericObject::Initialize_All (run, result);
+       run->Release ();
+       base->Release ();
+
+    A symbol is read from the highest layer defining it, so the whole
+    instruction (e.g. a multi-line array) shall be given in that layer.
+
+    CHANGE LOG
+    ==========
+   DSS Team       2026/10/19  Added the hash of the instruction value of each symbol ("value_hash") and "Compare",
+                              listing the symbols whose value differs between two stores (live configuration reload).
+                              The lines of a multi-line array value are no more indexed as symbols.
+   DSS Team       2026/10/19  The modification time of a shared store is kept to the nanosecond, and its content is
+                              hashed again before sharing it ("Content_Hash").
+
+******************************************************************************/
+
+#include <pthread.h>
+#include <time.h>
+#include <sys/types.h>
+#include "GenericTypes.h"
+#include "Input_file.h"
+
+/**
+* Class definition for the immutable <b>Configuration Store</b>.
+*/
+
+class ConfigStore
+{
+
+/*-------------------------------------------------------------------------
+   Data Type declarations
+-------------------------------------------------------------------------*/
+
+public:
+
+   struct typ_Symbol    /** <b>Symbol index</b> entry: first token of an instruction line */
+   {
+      const char        *name;               //!< <b>Symbol</b> (NULL if the entry is empty)
+      unsigned int      hash;                //!< Hash code of the symbol
+      int               line;                //!< Line identifier [iline] before the symbol line
+      unsigned long     position;            //!< Position in the text of the symbol line
+      unsigned long long value_hash;         //!< Hash of the instruction <b>value</b>: tokens after the symbol, up to the closing bracket of an array
+   };
+
+/*-------------------------------------------------------------------------
+   Data declarations
+-------------------------------------------------------------------------*/
+
+private:
+
+   char                       name[LINE_SIZE];                 //!<  <b>Name</b> of the layer (input file name, or the provided name)
+   const char                 *text;                           //!<  Layer <b>text</b> (memory-mapped file, or owned copy)
+   unsigned long              text_size;                       //!<  Layer text size [bytes]
+   bool                       mapped;                          //!<  Flag to say the text is a memory-mapped file
+   char                       *text_copy;                      //!<  Owned copy of the text ("Create"), NULL otherwise
+   unsigned long long         hash;                            //!<  <b>Hash of the content</b> of this layer and of its base layers
+   ConfigStore                *base;                           //!<  <b>Base</b> layer, NULL if this is the lowest layer
+   typ_Symbol                 *index;                          //!<  <b>Symbol index</b> of the layer (open addressing hash table)
+   unsigned long              index_size;                      //!<  Number of the symbol index entries (power of two)
+   char                       *symbol_pool;                    //!<  Storage of the indexed symbols
+   int                        n_symbols;                       //!<  Number of the indexed symbols
+   int                        n_lines;                         //!<  Number of the read instruction lines
+   dev_t                      file_device;                     //!<  Device of the loaded file (shared stores only)
+   ino_t                      file_inode;                      //!<  I-node of the loaded file (shared stores only)
+   struct timespec            file_time;                       //!<  Modification time of the loaded file, to the nanosecond (shared stores only)
+   volatile int               references;                      //!<  <b>Reference counter</b>
+   ConfigStore                *next_loaded;                    //!<  Next store of the shared stores list
+
+   static ConfigStore         *Loaded;                         //!<  List of the <b>shared stores</b> loaded from a file
+   static pthread_mutex_t     Loaded_Mutex;                    //!<  Mutex of the shared stores list and of the references release
+
+/*-------------------------------------------------------------------------
+   Function declarations
+-------------------------------------------------------------------------*/
+
+public:
+
+/** Static Public Method (thread-safe) returning the store of the provided <b>input file</b>, with one reference for the caller (NULL if the file cannot be read). Without base the store is shared with the other callers while the file is unchanged, otherwise it is a new overlay of the base*/
+   static ConfigStore*           Load (const char *file_name /*! <b>Input file name</b>, if not provided the default [dss.set] is used*/, ConfigStore *base_store = NULL /*! <b>Base</b> store, NULL for none*/);
+/** Static Public Method (thread-safe) returning a new store of the provided <b>text</b>, with one reference for the caller*/
+   static ConfigStore*           Create (const char *store_text /*! Set file <b>text</b>, copied*/, const char *store_name /*! <b>Name</b> of the store (log messages)*/, ConfigStore *base_store = NULL /*! <b>Base</b> store, NULL for none*/);
+
+/** Public Method (thread-safe) to <b>add a reference</b> to the store*/
+   void                          Acquire ();
+/** Public Method (thread-safe) to <b>release a reference</b> to the store, deleted when no more referenced*/
+   void                          Release ();
+
+/** Public Method (thread-safe) returning the index entry of the provided <b>Symbol</b> in the highest layer defining it, and the layer in "layer" (NULL if not found)*/
+   const typ_Symbol*             Find (const char *symbol /*! <b>Symbol</b>*/, const ConfigStore* &layer /*! <b>Layer</b> defining the symbol*/) const;
+
+/** Public Method (thread-safe) listing the symbols whose <b>value differs</b> from the "previous" store: changed, added or removed. It returns their number; the names belong to the two stores*/
+   int                           Compare (const ConfigStore *previous /*! <b>Previous</b> store, NULL for none (all the symbols are listed)*/, const char *changed[] /*! <b>Changed symbols</b>, at least Get_N_Symbols() of both the stores*/) const;
+/** Public Method returning the <b>number of the symbols</b> indexed by the layer and by its base layers*/
+   int                           Get_N_Symbols ()  const;
+
+/** Public Method returning the <b>name</b> of the layer*/
+   inline const char*            Get_Name ()       const {return name;};
+/** Public Method returning the <b>text</b> of the layer*/
+   inline const char*            Get_Text ()       const {return text;};
+/** Public Method returning the <b>text size</b> [bytes] of the layer*/
+   inline unsigned long          Get_Text_Size ()  const {return text_size;};
+/** Public Method returning the <b>hash of the content</b> of this layer and of its base layers*/
+   inline unsigned long long     Get_Hash ()       const {return hash;};
+/** Public Method returning the <b>base</b> layer (NULL if none)*/
+   inline const ConfigStore*     Get_Base ()       const {return base;};
+
+/** Static Public Method returning the <b>hash code</b> of a symbol*/
+   static unsigned int           Hash (const char *symbol);
+
+private:
+
+/** Class <b>Constructor</b>: stores are created by "Load" and "Create" only*/
+   ConfigStore ();
+/** Class <b>Destructor</b>: stores are deleted by "Release" only*/
+   ~ConfigStore ();
+
+/** Private Method to complete a new store: content hash and symbol index*/
+   void                          Build (ConfigStore *base_store);
+/** Static Private Method returning the <b>hash of a text</b> (FNV-1a, 64 bits) chained to the provided hash*/
+   static unsigned long long     Content_Hash (const char *content /*! <b>Text</b>*/, unsigned long size /*! Text size [bytes]*/, unsigned long long base_hash /*! Hash of the base layers, or the FNV offset basis*/);
+
+};
+
+#endif // __ConfigStore_h end
@@ -0,0 +1,243 @@
+/******************************************************************************
+
+    PROJECT:      DSS - S/C Dynamics Simulation Software
+    FILE:         ForcingEngine.cpp
+    RELEASE:      0.01
+    AUTHOR:       DSS Team
+    DATE:         2026/10/19
+
+    OVERVIEW
+    ========
+    Source Code for the sparse, time-profiled Forcing Engine
+
+    CHANGE LOG
+    ==========
+
+******************************************************************************/
+
+#include "ForcingEngine.h"
+#include "MathLib.h"
+
+//-------------------------------------------------------------------------
+ForcingEngine::ForcingEngine ()
+//-------------------------------------------------------------------------
+{
+   first                = NULL;
+   n_entries            = 0;
+   last_evaluation_time = -1.0e300;
+}
+
+//-------------------------------------------------------------------------
+ForcingEngine::~ForcingEngine ()
+//-------------------------------------------------------------------------
+{
+   while (first)
+      Delete_Entry (first);
+}
+
+//-------------------------------------------------------------------------
+typ_return ForcingEngine::Get_Profile (const char *name, typ_profile &profile)
+//-------------------------------------------------------------------------
+{
+   static const char *profile_name[] = {"CONSTANT", "RAMP", "STEP", "SINE", "TABLE"};
+   int   i;
+
+   name += strspn (name, " \t");
+   for (i = 0; i < 5; i++)
+      if (!strncmp (name, profile_name[i], strlen (profile_name[i])) && name[strlen (profile_name[i]) + strspn (name + strlen (profile_name[i]), " \t")] == '\0')
+      {
+         profile = (typ_profile) i;
+         return Nominal;
+      }
+   return Error;
+}
+
+//-------------------------------------------------------------------------
+typ_return ForcingEngine::Set (typ_Forcing *&port, double *pValue, int index, typ_profile profile, int n_points, const double points[])
+//-------------------------------------------------------------------------
+{
+   typ_Forcing    *entry, **link;
+   int            i;
+
+// Check the profile parameters consistency
+   switch (profile)
+   {
+      case Constant: if (n_points != 1) return Error; break;
+      case Ramp:     if (n_points != 4 || points[2] < points[0]) return Error; break;
+      case Sine:     if (n_points != 5) return Error; break;
+      default: // Step and Table: (time, value) pairs with increasing times
+         if (n_points < 2 || n_points % 2 || n_points > FORCING_MAX_PROFILE_POINTS)
+            return Error;
+         for (i = 2; i < n_points; i += 2)
+            if (points[i] <= points[i-2])
+               return Error;
+         break;
+   }
+
+// Replace the previous forcing of the same item
+   Remove (port, pValue);
+
+   entry = new typ_Forcing;
+   if (!entry)
+      return Error;
+   memset (entry, '\0', sizeof(typ_Forcing));
+   entry->points = new double [n_points];
+   if (!entry->points)
+   {
+      delete entry;
+      return Error;
+   }
+   memcpy (entry->points, points, n_points*sizeof(double));
+   entry->pValue          = pValue;
+   entry->index           = index;
+   entry->profile         = profile;
+   entry->n_points        = n_points;
+   entry->actual_value    = *pValue;
+   entry->evaluation_time = -1.0e300;
+
+// Link the entry in the Model port list, sorted by index, and at the head of the global list
+   for (link = &port; *link && (*link)->index < index; link = &(*link)->next)
+      ;
+   entry->next = *link;
+   *link       = entry;
+
+   entry->global_next = first;
+   if (first)
+      first->global_previous = entry;
+   first = entry;
+   n_entries++;
+   return Nominal;
+}
+
+//-------------------------------------------------------------------------
+void ForcingEngine::Remove (typ_Forcing *&port, double *pValue)
+//-------------------------------------------------------------------------
+{
+   typ_Forcing    **link, *entry;
+
+   for (link = &port; *link; link = &(*link)->next)
+      if ((*link)->pValue == pValue)
+      {
+         entry = *link;
+         *link = entry->next;
+         Delete_Entry (entry);
+         return;
+      }
+}
+
+//-------------------------------------------------------------------------
+void ForcingEngine::Clear (typ_Forcing *&port)
+//-------------------------------------------------------------------------
+{
+   typ_Forcing    *entry;
+
+   while ((entry = port))
+   {
+      port = entry->next;
+      Delete_Entry (entry);
+   }
+}
+
+//-------------------------------------------------------------------------
+void ForcingEngine::Delete_Entry (typ_Forcing *entry)
+//-------------------------------------------------------------------------
+{
+   if (entry->global_previous)
+      entry->global_previous->global_next = entry->global_next;
+   else
+      first = entry->global_next;
+   if (entry->global_next)
+      entry->global_next->global_previous = entry->global_previous;
+   n_entries--;
+
+   if (entry->points)
+      delete [] entry->points;
+   delete entry;
+}
+
+//-------------------------------------------------------------------------
+int ForcingEngine::Count (const typ_Forcing *port)
+//-------------------------------------------------------------------------
+{
+   int   n = 0;
+
+   for (; port; port = port->next)
+      n++;
+   return n;
+}
+
+//-------------------------------------------------------------------------
+void ForcingEngine::Evaluate (double time)
+//-------------------------------------------------------------------------
+{
+   typ_Forcing    *entry;
+
+   if (time == last_evaluation_time)
+      return;
+   last_evaluation_time = time;
+   for (entry = first; entry; entry = entry->global_next)
+      Evaluate_Entry (entry, time);
+}
+
+//-------------------------------------------------------------------------
+void ForcingEngine::Apply (typ_Forcing *port, double time)
+//-------------------------------------------------------------------------
+{
+   for (; port; port = port->next)
+   {
+      if (port->evaluation_time != time) // Not evaluated in the current batch (e.g. Model processed out of the kernel phases)
+         Evaluate_Entry (port, time);
+      port->actual_value = *port->pValue; // Store the actual value
+      if (port->active)
+         *port->pValue = port->value;     // Override the value when required
+   }
+}
+
+//-------------------------------------------------------------------------
+void ForcingEngine::Evaluate_Entry (typ_Forcing *entry, double time)
+//-------------------------------------------------------------------------
+{
+   const double   *p = entry->points;
+   int            i;
+
+   entry->evaluation_time = time;
+   entry->active          = true;
+   switch (entry->profile)
+   {
+      case Constant:
+         entry->value = p[0];
+         break;
+
+      case Ramp:
+         if (time < p[0])
+            entry->active = false;
+         else if (time >= p[2] || p[2] == p[0])
+            entry->value = p[3];
+         else
+            entry->value = p[1] + (p[3] - p[1]) * (time - p[0]) / (p[2] - p[0]);
+         break;
+
+      case Sine:
+         if (time < p[0])
+            entry->active = false;
+         else
+            entry->value = p[1] + p[2] * sin (2.0*PI*p[3]*(time - p[0]) + p[4]);
+         break;
+
+      case Step:
+      case Table:
+         if (time < p[0])
+         {
+            entry->active = false;
+            break;
+         }
+// Look for the profile segment containing the time
+         for (i = 2; i < entry->n_points && p[i] <= time; i += 2)
+            ;
+         if (i >= entry->n_points || entry->profile == Step)
+            entry->value = p[i-1];
+         else
+            entry->value = p[i-1] + (p[i+1] - p[i-1]) * (time - p[i-2]) / (p[i] - p[i-2]);
+         break;
+   }
+}
@@ -0,0 +1,126 @@
+#if !defined(__ForcingEngine_h) // Use file only if it's not already included.
+#define __ForcingEngine_h
+
+/******************************************************************************
+
+    PROJECT:      DSS - S/C Dynamics Simulation Software
+    FILE:         ForcingEngine.h
+    RELEASE:      0.01
+    AUTHOR:       DSS Team
+    DATE:         2026/10/19
+
+    OVERVIEW
+    ========
+    Header file for the sparse, time-profiled Forcing Engine.
+    Only the forced INPUT/OUTPUT data are recorded, as entries (pointer to
+    the forced double, time profile) kept both in a global list, evaluated
+    in one batch per kernel phase, and in per-Model port lists, applied by
+    the Model when its inputs are acquired or its outputs are built.
+    A Model having nothing forced pays a NULL pointer check only.
+
+    FORCING PROFILES
+    ================
+       CONSTANT   v                        constant value (starting immediately)
+       RAMP       t0,v0,t1,v1              v0 at t0, linear up to v1 at t1, then held
+       STEP       t1,v1,t2,v2,...          value vi from time ti on (increasing times)
+       SINE       t0,offset,ampl,freq,ph   offset + ampl*sin(2*PI*freq*(t-t0) + ph) [Hz, rad]
+       TABLE      t1,v1,t2,v2,...          linear interpolation, held after the last time
+    Before the first profile time the actual value is not overridden.
+
+    CHANGE LOG
+    ==========
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "GenericTypes.h"
+
+#define  FORCING_MAX_PROFILE_POINTS       256                           //!< Maximum allowed number of the <b>forcing profile parameters</b>
+
+/**
+* Class definition for the <b>sparse, time-profiled Forcing Engine</b>.
+*/
+
+class ForcingEngine
+{
+
+/*-------------------------------------------------------------------------
+   Data Type declarations
+-------------------------------------------------------------------------*/
+
+public:
+
+   enum typ_profile     /** <b>Forcing profile</b> type */
+   {
+      Constant = 0,                          //!< Constant value
+      Ramp,                                  //!< Linear ramp between two (time, value) points
+      Step,                                  //!< Step sequence of (time, value) points
+      Sine,                                  //!< Sinusoidal value
+      Table                                  //!< Linearly interpolated (time, value) table
+   };
+
+   struct typ_Forcing   /** Data structure type to store a <b>forced data entry</b> */
+   {
+      double            *pValue;             //!< Pointer to the <b>forced double</b> (Model INPUT or OUTPUT item)
+      int               index;               //!< Forced item <b>index</b> [1..n] in the Model INPUT or OUTPUT array
+      double            actual_value;        //!< Stored <b>actual value</b>, before being overridden
+      double            value;               //!< Forcing value evaluated at "evaluation_time"
+      double            evaluation_time;     //!< <b>Time</b> [s] of the last profile evaluation
+      bool              active;              //!< Flag to say the profile is started at "evaluation_time" (i.e. the value has to be overridden)
+      typ_profile       profile;             //!< <b>Forcing profile</b> type
+      int               n_points;            //!< Number of the <b>profile parameters</b>
+      double            *points;             //!< Array of the <b>profile parameters</b>
+      typ_Forcing       *next;               //!< Next entry forcing the same Model port
+      typ_Forcing       *global_next;        //!< Next entry in the global list
+      typ_Forcing       *global_previous;    //!< Previous entry in the global list
+   };
+
+/*-------------------------------------------------------------------------
+   Data declarations
+-------------------------------------------------------------------------*/
+
+private:
+
+   typ_Forcing                *first;                          //!<  First entry of the global list
+   int                        n_entries;                       //!<  Number of the entries in the global list
+   double                     last_evaluation_time;            //!<  <b>Time</b> [s] of the last batch evaluation
+
+/*-------------------------------------------------------------------------
+   Function declarations
+-------------------------------------------------------------------------*/
+
+public:
+
+/** Class <b>Constructor</b>*/
+   ForcingEngine ();
+/** Class <b>Destructor</b>; the entries shall have been cleared by their Models*/
+   ~ForcingEngine ();
+
+/** Public Method to <b>force a Model port item</b> with the given profile, replacing its previous forcing (if any). Returns Error if the profile parameters are inconsistent*/
+   typ_return                    Set (typ_Forcing *&port /*! Model port list (INPUT or OUTPUT)*/, double *pValue /*! Pointer to the <b>forced double</b>*/, int index /*! Forced item <b>index</b> [1..n]*/, typ_profile profile /*! <b>Forcing profile</b> type*/, int n_points /*! Number of the <b>profile parameters</b>*/, const double points[] /*! Array of the <b>profile parameters</b>*/);
+/** Public Method to <b>remove the forcing</b> of a Model port item (nothing is done if not forced)*/
+   void                          Remove (typ_Forcing *&port /*! Model port list (INPUT or OUTPUT)*/, double *pValue /*! Pointer to the <b>forced double</b>*/);
+/** Public Method to <b>remove all the forcings</b> of a Model port*/
+   void                          Clear (typ_Forcing *&port /*! Model port list (INPUT or OUTPUT)*/);
+/** Public Method to <b>evaluate in one batch</b> all the forcing profiles at the given time (nothing is done if already evaluated at that time)*/
+   void                          Evaluate (double time /*! <b>Time</b> [s] since Simulation Beginning*/);
+/** Public Method to <b>apply the forcings of a Model port</b>: the actual values are stored and the forced ones overridden*/
+   void                          Apply (typ_Forcing *port /*! Model port list (INPUT or OUTPUT)*/, double time /*! <b>Time</b> [s] since Simulation Beginning*/);
+/** Public Method to return the <b>number of the forced items</b> of a Model port*/
+   static int                    Count (const typ_Forcing *port /*! Model port list (INPUT or OUTPUT)*/);
+/** Public Method to return the <b>total number of the forced items</b>*/
+   inline int                    Size ()     {return n_entries;};
+/** Static Public Method to identify a <b>forcing profile by name</b> (CONSTANT, RAMP, STEP, SINE, TABLE). Returns Error if unknown*/
+   static typ_return             Get_Profile (const char *name /*! Profile name*/, typ_profile &profile /*! Output: profile type*/);
+
+private:
+
+/** Private Method to evaluate the profile of one entry*/
+   static void                   Evaluate_Entry (typ_Forcing *entry, double time);
+/** Private Method to unlink an entry from the global list and delete it*/
+   void                          Delete_Entry (typ_Forcing *entry);
+
+};
+
+#endif // __ForcingEngine_h end
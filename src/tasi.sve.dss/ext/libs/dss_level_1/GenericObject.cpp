@@ -83,6 +83,53 @@
    D.Andreetti    13/11/2017  Added public method to publish the Generic Object properties relevant for breakpoints
                               ( As public can be invoked from external classes such as SDVE_Level3Template)
    L.Galvagni     2018/01/20  Added static publig "Publish_All_Flag" boolean flag to allow disabling the automatic data publishing (enable by default)
+   DSS Team       2026/10/19  "MODEL_COMMAND_STACK" loaded by "Load_Command_Stack" into the time-ordered "CommandQueue" (binary heap)
+                              instead of the exchange-sorted text buffer. Commands are parsed once when queued; "Execute_Command"
+                              no more uses "strtok" (a dot identifies a Model command only when it precedes the first comma).
+                              Added "Insert_Command" and "Dispatch_Commands"; the expired commands are dispatched once per step
+                              by "Update_All_Dynamic", "Update_All_Static_in_Chain" and "Initialize_All" instead of "Update_Model".
+   DSS Team       2026/10/19  "Model_Local_Parser" and "Static_Local_Parser" replaced by the table-driven "Generic_Command" and
+                              "Static_Command" handlers: commands are identified by perfect hashing ("CommandTable") and their
+                              parameters are converted and validated by "Compile_Command" when queued (invalid commands are rejected
+                              by "Insert_Command"). Model class commands are dispatched to "Local_Command", the not declared ones to
+                              "Local_Parser". The "RT_" commands sent to a non Remote Terminal Model are passed to "Local_Parser" too.
+   DSS Team       2026/10/19  Added "Post_Command" and "Drain_Posted_Commands": commands posted by any thread are collected by a
+                              lock-free MPSC queue and applied by the sim thread in one batch at the beginning of "Dispatch_Commands".
+                              The completion tickets are notified with the execution return code.
+   DSS Team       2026/10/19  FORCE_*, FREEZE_* and UNFORCE_* commands use the sparse "ForcingEngine": only the forced items are
+                              recorded and processed by "Get_Model_Input" and "Update_Model", with profiles evaluated in one batch per
+                              kernel phase. Added FORCE_INPUT_PROFILE and FORCE_OUTPUT_PROFILE (CONSTANT, RAMP, STEP, SINE, TABLE).
+                              The per-item "GO.pU_Forced_*"/"GO.pY_Forced_*" data are published views of the forcing lists,
+                              refreshed for the forced items only ("Refresh_Forced_View") and reset by the UNFORCE_* commands
+                              ("Reset_Forced_View"), when the Model attributes are published.
+   DSS Team       2026/10/19  Added "Log_Set_Async": when enabled, "Log_Write", "Log_Message", "Log_Warning" and "Log_Error" queue the
+                              message into the "LogBackend" per-thread ring instead of calling fprintf/fflush; the WARNING and ERROR
+                              counters are incremented atomically. The backend is stopped (queue written) before closing the Log File.
+   DSS Team       2026/10/19  "Log_Debug" checks the Debug File before building the message.
+   DSS Team       2026/10/19  Added "Log_Limited", the rate-limited WARNING/ERROR logging used by the DSS_WARNING and DSS_ERROR macros.
+   DSS Team       2026/10/19  ENABLE_1553_LOG starts the binary "Bus1553Recorder" (memory-mapped "1553_dump_*.bin" file, optional RT and
+                              subaddress masks) instead of the "Log_1553_File" text dump; the mode commands and the RT handlers return
+                              codes are recorded too. The text dump is produced offline by the "bus1553_decode" tool.
+   DSS Team       2026/10/19  "Set_Rt1553_Address" keeps the Models in the "Rt1553_Table" dispatch table (one chain per RT address, sorted
+                              by Id); the "Bc1553_*" functions index it instead of scanning the Objects list. The broadcast address 31
+                              is dispatched to all the RT's for "Bc1553_ReceiveData" (each RT receiving its own copy of the data words)
+                              and "Bc1553_ReceiveModeCommand".
+   DSS Team       2026/10/19  "Initialize_All" loads (or shares) the "ConfigStore" of the input file and reads it through a per-thread
+                              "input_file" reader; the store is no more discarded after the initialization ("Config_Store"), it is
+                              released when the last Object is destroyed.
+   DSS Team       2026/10/19  "Initialize_All" runs the Models initialization on "Initialize_Threads" threads (one "input_file" reader
+                              per thread, the binary cache read only) and the first update in waves of Models of the same nesting
+                              level, for the Models declaring it safe ("Concurrent_Update_Flag"); the Models not allowed to run
+                              concurrently ("Concurrent_Initialization_Allowed") follow the others. "Set_Rt1553_Address",
+                              "Unlink_Rt1553" and "Insert_Command" lock "Registry_Mutex" ("Lock_Registry", recursive mutex created
+                              once through "pthread_once"). The WARNINGS/ERRORS counters and the rate-limited call sites counters
+                              are updated atomically.
+                              "Current_Epoch" is written only when it changes.
+   DSS Team       2026/10/19  Added "Reload_Config" (RELOAD_CONFIG static command) and "Reconfigure_Model": the symbols changed
+                              in the reloaded configuration ("ConfigStore::Compare") are applied to their Models only. A reload
+                              with reader errors fails and keeps the previous "Config_Store", so it is compared again next time.
+   DSS Team       2026/10/19  The Model "Random_Stream" is keyed by the Model name in the constructor and seeded at initialization
+                              ("Seed_Random_Stream"); a changed RANDOM_SEED of the Model restarts it ("Reconfigure_Model").
 
 ******************************************************************************/
 
@@ -93,23 +140,91 @@
 // Static Data Initialization
 
 bool              GenericObject::Publish_All_Flag     = true;
-InputFile*        GenericObject::input_file           = NULL;
+__thread InputFile* GenericObject::input_file         = NULL;
+ConfigStore*      GenericObject::Config_Store         = NULL;
 FILE*             GenericObject::Log_File             = NULL;
-FILE*             GenericObject::Log_1553_File        = NULL;
 unsigned long     GenericObject::N_Warnings           = 0;
 unsigned long     GenericObject::N_Errors             = 0;
+LogBackend*       GenericObject::Log_Backend          = NULL;
 double            GenericObject::Current_Epoch        = 0.0;
 unsigned long     GenericObject::Number_Of_Objects    = 0;
 GenericObject*    GenericObject::pFirst_Object        = NULL;
 GenericObject*    GenericObject::pLast_Object         = NULL;
 bool              GenericObject::topology_solved_flag = false;
 char              GenericObject::Path[GENERIC_OBJECT_LEN_LOG_FILE_NAME];
-char*             GenericObject::pCommandBuffer       = NULL;
-GenericObject::typ_CommandData*  GenericObject::pCommandQueueBuffer  = NULL;
-GenericObject::typ_CommandData*  GenericObject::pCurrentCommand      = NULL;
+CommandQueue*     GenericObject::Command_Queue        = NULL;
+GenericObject*    GenericObject::Rt1553_Table[32]     = {NULL};
+bool              GenericObject::Command_Stack_Loaded = false;
+int               GenericObject::Initialize_Threads   = 1;
+pthread_mutex_t   GenericObject::Registry_Mutex;
+pthread_once_t    GenericObject::Registry_Once        = PTHREAD_ONCE_INIT;
+
+const CommandTable::typ_CommandSchema GenericObject::Generic_Command_Schemas[] =
+{
+   {"DISABLE_DEBUG",          Cmd_Disable_Debug,         ""    },
+   {"ENABLE_DEBUG",           Cmd_Enable_Debug,          ""    },
+   {"FORCE_INPUT",            Cmd_Force_Input,           "if+" },
+   {"FORCE_OUTPUT",           Cmd_Force_Output,          "if+" },
+   {"FREEZE_INPUT",           Cmd_Freeze_Input,          ""    },
+   {"FREEZE_OUTPUT",          Cmd_Freeze_Output,         ""    },
+   {"RT_SET_STATUS",          Cmd_Rt_Set_Status,         "i"   },
+   {"RT_SET_SA_STATUS",       Cmd_Rt_Set_SA_Status,      "ici" },
+   {"RT_SET_MC_STATUS",       Cmd_Rt_Set_MC_Status,      "ii"  },
+   {"RT_FORCE_SA_TX_BUFFER",  Cmd_Rt_Force_SA_Tx_Buffer, "ix*" },
+   {"RT_FORCE_SA_RX_BUFFER",  Cmd_Rt_Force_SA_Rx_Buffer, "ix*" },
+   {"RT_FORCE_MC_BUFFER",     Cmd_Rt_Force_MC_Buffer,    "ix?" },
+   {"SWITCH_ON",              Cmd_Switch_On,             ""    },
+   {"SWITCH_OFF",             Cmd_Switch_Off,            ""    },
+   {"SET_POWER_LOAD",         Cmd_Set_Power_Load,        "d"   },
+   {"SET_VALUE",              Cmd_Set_Value,             "sd"  },
+   {"SET_COMPONENTS",         Cmd_Set_Components,        "sid+"},
+   {"UNFORCE_INPUT",          Cmd_Unforce_Input,         ""    },
+   {"UNFORCE_OUTPUT",         Cmd_Unforce_Output,        ""    },
+   {"FORCE_INPUT_PROFILE",    Cmd_Force_Input_Profile,   "isd*"},
+   {"FORCE_OUTPUT_PROFILE",   Cmd_Force_Output_Profile,  "isd*"},
+   {NULL,                     0,                         NULL  }
+};
+const CommandTable::typ_CommandSchema GenericObject::Static_Command_Schemas[] =
+{
+   {"ENABLE_1553_LOG",        Cmd_Enable_1553_Log,       "s*"  },
+   {"DISABLE_1553_LOG",       Cmd_Disable_1553_Log,      ""    },
+   {"DUMP_BUS_STATS",         Cmd_Dump_Bus_Stats,        "s?"  },
+   {"RELOAD_CONFIG",          Cmd_Reload_Config,         "s"   },
+   {NULL,                     0,                         NULL  }
+};
+const CommandTable      GenericObject::Generic_Commands (Generic_Command_Schemas);
+const CommandTable      GenericObject::Static_Commands  (Static_Command_Schemas);
+CommandIngestQueue      GenericObject::Posted_Commands;
+ForcingEngine           GenericObject::Forcing_Engine;
+Bus1553Recorder         GenericObject::Bus_Recorder;
 
 void (*GenericObject::User_Message) (const char *message, const char *source) = NULL;
 
+struct typ_stats_rank   // RT Object ranking item of "Dump_Bus_Stats"
+{
+   double            handler_time;
+   GenericObject     *model;
+};
+
+//-------------------------------------------------------------------------
+static int Compare_Stats_Rank (const void *a, const void *b)
+//-------------------------------------------------------------------------
+{
+   double   difference = ((const typ_stats_rank*)b)->handler_time - ((const typ_stats_rank*)a)->handler_time;
+
+   return (difference > 0.0) - (difference < 0.0); // Decreasing handler time
+}
+
+//-------------------------------------------------------------------------
+static inline double Stats_Clock ()
+//-------------------------------------------------------------------------
+{
+   struct timespec   now;
+
+   clock_gettime (CLOCK_MONOTONIC, &now); // Handler time measurement for the BUS 1553 and Serial Links statistics
+   return now.tv_sec + 1.0e-9 * now.tv_nsec;
+}
+
 //-------------------------------------------------------------------------
 GenericObject::GenericObject (const char*    UniqueName,    // Text string Unique Object Name identifier, to be used for logging, reporting and data/commands assignement (shall not contain blanks or dots, max length 63 characters)
                               const int      ClassSizeof,   // Sizeof (in bytes) of the derived class, used to reset the whole RAM allocated for it
@@ -168,6 +283,7 @@ GenericObject::GenericObject (const char*    UniqueName,    // Text string Uniqu
 
 // Store the instance name and numerical identifier
    strncpy (Name, UniqueName, STD_SHORT_STRING_SIZE); // Store the instance Name
+   Random_Stream.Seed (ConfigStore::Hash (Name), 0);  // Default random stream, seeded again at initialization
 
 // Store the Dynamics Model properties, size and pointers passed by the Level 2 derived class
    nx    = StatusSizeof / sizeof(double);    // Dynamics STATUS double-array X (Xdot) number of items
@@ -190,7 +306,14 @@ GenericObject::GenericObject (const char*    UniqueName,    // Text string Uniqu
 GenericObject::~GenericObject ()
 //-------------------------------------------------------------------------
 {
-// Delete the Inter-Object digital data Serial Links array
+   int   i;
+
+// Delete the Inter-Object digital data Serial Links array (and the queued links rings)
+   for (i = 0; i < N_serial_links; i++)
+   {
+      _Deallocate (serial_link[i].inbound);
+      delete[] serial_link[i].reply;
+   }
    _Deallocate (serial_link);
    N_serial_links = 0;
 
@@ -201,8 +324,15 @@ GenericObject::~GenericObject ()
    _Deallocate (P_PublishData)
    N_PublishData = 0;
 
-// Delete the User-forced INPUT and OUTPUT information arrays
+// Unlink this object from the queued commands targeting it
+   if (Command_Queue)
+      Command_Queue->Forget_Target (this);
+
+// Delete the User-forced INPUT and OUTPUT items and their published views
+   Forcing_Engine.Clear (pU_Forcing);
+   Forcing_Engine.Clear (pY_Forcing);
    _Deallocate (pU_Forced);
+   pY_Forced = NULL;
 
 // Trace in the Log File the registered object informations before destroying it
    Log_Message ("GenericObject DESTRUCTOR \"% 24s\" >> (Id=%i,N=%i), this= #%p, Previous_Object= #%p, Next_Object= #%p, First_Object= #%p, Last_Object= #%p",
@@ -213,7 +343,8 @@ GenericObject::~GenericObject ()
       fclose (Debug_File); // Close the trace file, if open
    Debug_File = NULL;
 
-// Remove this object from the registration chain
+// Remove this object from the registration chain and from the 1553 dispatch table
+   Unlink_Rt1553 ();
    if (pPrevious_Object)
       pPrevious_Object->pNext_Object = pNext_Object;
    if (pNext_Object)
@@ -229,20 +360,20 @@ GenericObject::~GenericObject ()
    {
 // Deallocate the allocable resources
       _Deallocate (input_file);
-      _Deallocate (pCommandQueueBuffer);
-      _Deallocate (pCommandBuffer);
+      _Deallocate (Command_Queue);
+      if (Config_Store)
+         Config_Store->Release ();
 // Close the Log File
       if (Log_File)
       {
          Log_Write("\n\n   Number of Warnings : %i\n\n   Number of ERRORS   : %i\n\n   ---      E N D     O F     P R O G R A M      ---\n\n", N_Warnings, N_Errors);
+         _Deallocate (Log_Backend); // Write the queued messages, if asynchronous
          fclose (Log_File);
       }
-// Close the 1553 Log File
-      if (Log_1553_File)
-         fclose (Log_1553_File);
+// Close the 1553 recording
+      Bus_Recorder.Close ();
 // Reset to default all the Static Variables
       Log_File             = NULL;
-      Log_1553_File        = NULL;
       N_Warnings           = 0;
       N_Errors             = 0;
       Current_Epoch        = 0.0;
@@ -250,7 +381,8 @@ GenericObject::~GenericObject ()
       pFirst_Object        = NULL;
       pLast_Object         = NULL;
       topology_solved_flag = false;
-      pCurrentCommand      = NULL;
+      Command_Stack_Loaded = false;
+      Config_Store         = NULL;
    }
 }
 
@@ -274,11 +406,6 @@ void GenericObject::DeleteAll ()
 void GenericObject::Initialize_Model (typ_return &result, char* Input_File_Name)
 //-------------------------------------------------------------------
 {
-   char              *c;
-   bool              found;
-   int               i, j, n_Commands, old_error;
-   typ_CommandData   dummy;
-
 // If the Input_File_Name has been provided here then that means the
 // configuration input file has to be managed at this level
    if (Input_File_Name)
@@ -314,71 +441,21 @@ void GenericObject::Initialize_Model (typ_return &result, char* Input_File_Name)
          return;
    }
 
-// If the Commad Descriptors queue has not been loaded yet, then load it from the input file
-   if (!pCommandQueueBuffer)
-   {
-      input_file->DisableLineTokenizer(); // Disable the instruction lines tokenization, i.e. acquire each input line as a single token
-      n_Commands = input_file->GetRowsNumber ("MODEL_COMMAND_STACK", 1);
-      pCommandQueueBuffer = new typ_CommandData[n_Commands+1];
-      if (!pCommandQueueBuffer)
-      {
-         Log_Error ("Initialize_Model : Unable to allocate in RAM the 'CommandQueueBuffer'. Cannot continue");
-         return;
-      }
-      memset (pCommandQueueBuffer, '\0', (n_Commands+1)*sizeof(typ_CommandData));
-      pCommandQueueBuffer[n_Commands].elapsed_time = 1.E+32;
-
-      if (n_Commands > 0)
-      {
-         old_error = input_file->error;
-         found     = input_file->readSymbol ("MODEL_COMMAND_STACK", n_Commands);
-
-         if (found && old_error == input_file->error)
-         {
-            pCommandBuffer = new char[n_Commands*TOKEN_SIZE+1];
-            if (!pCommandBuffer)
-            {
-               Log_Error ("Initialize_Model : Unable to allocate in RAM the 'CommandBuffer'. Cannot continue");
-               return;
-            }
-            else
-            {
-               memset (pCommandBuffer, '\0',               n_Commands*TOKEN_SIZE+1);
-               memcpy (pCommandBuffer, input_file->buffer, n_Commands*TOKEN_SIZE);
-               for (i = 0; i < n_Commands; i++)
-               {
-                  c = strtok (pCommandBuffer+i*TOKEN_SIZE, " ,\t");
-                  if (c) pCommandQueueBuffer[i].elapsed_time = atof (c);
-                  c = strtok (NULL, "\n");
-                  if (c) pCommandQueueBuffer[i].pCommand_String = c + strspn (c, " ,\t");
-               }
-// Order command data by ascending dispatching time
-               for (i = 0; i < n_Commands; i++)
-                  for (j = i+1; j < n_Commands; j++)
-                     if (pCommandQueueBuffer[j].elapsed_time < pCommandQueueBuffer[i].elapsed_time)
-                     {
-                        dummy                  = pCommandQueueBuffer[j];
-                        pCommandQueueBuffer[j] = pCommandQueueBuffer[i];
-                        pCommandQueueBuffer[i] = dummy;
-                     }
-               pCurrentCommand = pCommandQueueBuffer;
-            }
-         }
-      }
-      input_file->EnableLineTokenizer(); // Enable (default) the instruction lines tokenization, i.e. acquire several tokens from the same input line
-   }
+// If the time-scheduled commands have not been loaded yet, then load them from the input file
+   if (!Command_Stack_Loaded)
+      Load_Command_Stack ();
 
 // Initialize data for Update_Model scheduling
    LastUpdateExecTime =  0.0;
    UpdateStepTime     = -1.0;    // Default behaviour is UPDATE ALWAYS
    input_file->load (&UpdateStepTime, Name, "UPDATE_STEP_TIME" , 1, false);
+   Seed_Random_Stream ();
 
 // Initialize the specific model
    Initialize (result);
 
-// Allocate the User-forced INPUT and OUTPUT information arrays
-   pU_Forced = pY_Forced = NULL;
-   if (nu > 0 || ny > 0)
+// Allocate the published views of the User-forced INPUT and OUTPUT items
+   if (Publish_All_Flag && !pU_Forced && (nu > 0 || ny > 0))
    {
       pU_Forced = new typ_forced_value [ nu+ny ];
       if (pU_Forced)
@@ -394,34 +471,84 @@ void GenericObject::Initialize_Model (typ_return &result, char* Input_File_Name)
         result = Error;
 }
 
+//-------------------------------------------------------------------
+void GenericObject::Reconfigure_Model (typ_return &result, int n_parameters, const char* parameters[])
+//-------------------------------------------------------------------
+{
+   int   i, n;
+
+// Apply the generic parameters, the Model specific ones are left to "Reconfigure"
+   for (n = i = 0; i < n_parameters; i++)
+      if (!strcmp (parameters[i], "UPDATE_STEP_TIME"))
+      {
+         UpdateStepTime = -1.0;
+         input_file->load (&UpdateStepTime, Name, "UPDATE_STEP_TIME" , 1, false);
+      }
+      else if (!strcmp (parameters[i], "RANDOM_SEED"))
+         Seed_Random_Stream ();
+      else
+         parameters[n++] = parameters[i];
+
+   if (n)
+      Reconfigure (result, n, parameters);
+}
+
+//-------------------------------------------------------------------
+void GenericObject::Seed_Random_Stream ()
+//-------------------------------------------------------------------
+{
+   double   seed = 0.;
+
+// The stream depends on the Model name and on the seed only, not on the Models (threads) order
+   input_file->load (&seed, "RANDOM_SEED", 1, false);
+   input_file->load (&seed, Name, "RANDOM_SEED", 1, false);
+   Random_Stream.Seed (ConfigStore::Hash (Name), (unsigned long long) seed);
+}
+
+//-------------------------------------------------------------------
+void GenericObject::Reconfigure (typ_return &result, int n_parameters, const char* parameters[])
+//-------------------------------------------------------------------
+{
+   int   i;
+
+   for (i = 0; i < n_parameters; i++)
+      Log_Warning ("%s.Reconfigure : the changed parameter \"%s\" has not been applied, the Model does not support the live reconfiguration", Name, parameters[i]);
+}
+
 //-------------------------------------------------------------------
 void GenericObject::Get_Model_Input (typ_return &result, double time, bool is_the_first_getinput)
 //-------------------------------------------------------------------
 {
-   int i;
-   Current_Epoch = time;
+   if (Current_Epoch != time) // Not written by the Models updated concurrently at the same epoch
+      Current_Epoch = time;
+   Model_Epoch   = time;
 
 // Get the registered inputs to other model
    Get_Connected_Inputs ();
 
+// Deliver the queued Serial Links records sent by the Partner-Objects
+   if (serial_queued_flag)
+      Serial_Drain_Links (time);
+
 // Get the model specific INPUT
    Get_Input (result, time, is_the_first_getinput);
 
-// Force the INPUT values set by the user
-   if (pU_Forced)
-      for (i = 0; i < nu; i++)
-      {
-         pU_Forced[i].actual_value = pU[i]; // Store the actual INPUT value
-         if (pU_Forced[i].forced_flag)
-            pU[i] = pU_Forced[i].forced_value; // Override the INPUT when required
-      }
+// Force the INPUT values set by the user (only the forced items are processed)
+   if (pU_Forcing)
+   {
+      Forcing_Engine.Apply (pU_Forcing, time);
+      if (pU_Forced)
+         Refresh_Forced_View (pU_Forcing, pU_Forced);
+   }
 }
 
 //-------------------------------------------------------------------
 void GenericObject::Model_Status (typ_return &result, double time)
 //-------------------------------------------------------------------
 {
-   Current_Epoch = time;
+   if (Current_Epoch != time)
+      Current_Epoch = time;
+   Model_Epoch   = time;
    Status (result, time);
 }
 
@@ -429,8 +556,9 @@ void GenericObject::Model_Status (typ_return &result, double time)
 void GenericObject::Update_Model (typ_return &result, double time, bool is_the_final_updating)
 //-------------------------------------------------------------------
 {
-   int i;
-   Current_Epoch = time;
+   if (Current_Epoch != time)
+      Current_Epoch = time;
+   Model_Epoch   = time;
 
 // Build the model specific OUTPUT
    if( UpdateStepTime<=0 ||                              // The model has not update step time
@@ -442,462 +570,712 @@ void GenericObject::Update_Model (typ_return &result, double time, bool is_the_f
          LastUpdateExecTime = time;
    }
 
-// Force the OUTPUT values set by the user
-   if (pY_Forced)
-      for (i = 0; i < ny; i++)
-      {
-         pY_Forced[i].actual_value = pY[i]; // Store the actual OUTPUT value
-         if (pY_Forced[i].forced_flag)
-            pY[i] = pY_Forced[i].forced_value; // Override the OUTPUT when required
-      }
+// Force the OUTPUT values set by the user (only the forced items are processed)
+   if (pY_Forcing)
+   {
+      Forcing_Engine.Apply (pY_Forcing, time);
+      if (pY_Forced)
+         Refresh_Forced_View (pY_Forcing, pY_Forced);
+   }
+}
 
-// Dispatch expired commands
-   if (is_the_final_updating)
-      while (pCurrentCommand
-          && pCurrentCommand->pCommand_String
-          && pCurrentCommand->elapsed_time <= time)
-      {
-         Execute_Command (pCurrentCommand->pCommand_String);
-         pCurrentCommand++;
-      }
+//-------------------------------------------------------------------
+void GenericObject::Refresh_Forced_View (const ForcingEngine::typ_Forcing *port, typ_forced_value *view)
+//-------------------------------------------------------------------
+{
+// Only the forced items are refreshed, with the value stored before being overridden
+   for (; port; port = port->next)
+   {
+      view[port->index-1].actual_value = port->actual_value;
+      view[port->index-1].forced_value = port->value;
+      view[port->index-1].forced_flag  = port->active;
+   }
+}
+
+//-------------------------------------------------------------------
+void GenericObject::Reset_Forced_View (const ForcingEngine::typ_Forcing *port, typ_forced_value *view)
+//-------------------------------------------------------------------
+{
+   for (; port; port = port->next)
+      view[port->index-1].forced_flag = 0;
 }
 
 //-------------------------------------------------------------------
 void GenericObject::Static_Local_Parser (typ_return &result, char* model_command, int n_parameters, char*  parameters [])
 //-------------------------------------------------------------------
 {
-   char     complete_file_name[GENERIC_OBJECT_LEN_LOG_FILE_NAME];
-   bool     command_identified = false;
-   time_t   current_time;
+   const CommandTable::typ_CommandSchema  *schema;
+   CommandTable::typ_CommandArg           *args;
 
-   switch (*model_command)
+   schema = Static_Commands.Find (model_command);
+   if (!schema)
    {
-      case 'E':
-         if(!strcmp (model_command, "ENABLE_1553_LOG")){
-            command_identified = true;
-            if (n_parameters == 0)
-            {
-               if( Log_1553_File )
-                  Log_Warning ("Static command string \"%s\" 1553 bus logging is already enabled", model_command);
-               else{
-                  time (&current_time);
-                  tm *time_now = localtime (&current_time);
-                  sprintf (complete_file_name, "%s1553_dump_%04i%02i%02i_%02i%02i%02i.txt", Path,
-                           time_now->tm_year+1900, time_now->tm_mon+1, time_now->tm_mday,
-                           time_now->tm_hour, time_now->tm_min, time_now->tm_sec);
-                  Log_1553_File = fopen (complete_file_name, "wt"); // Open the 1553 debug file
-                  if ( Log_1553_File )
-                     result = Nominal;
-                  else
-                     Log_Warning ("Static command string \"%s\" unable to open for writing the \"%s\" 1553 log file", model_command, complete_file_name);
-               }
-            }
+      // The global Command has not been identified
+      Log_Warning ("Static_Local_Parser : FAILED processing static command \"%s\" with \"%i\" parameter-tokens", model_command, n_parameters);
+      return;
+   }
+
+// Convert the Text-Parameters as per the command schema and execute it
+   args = new CommandTable::typ_CommandArg [n_parameters+1];
+   if (args && CommandTable::Convert (schema, n_parameters, parameters, args) == Nominal)
+      Static_Command (result, schema->id, n_parameters, args);
+   if (args)
+      delete [] args;
+}
+
+//-------------------------------------------------------------------
+void GenericObject::Static_Command (typ_return &result, int command_id, int n_args, const CommandTable::typ_CommandArg args[])
+//-------------------------------------------------------------------
+{
+   char           complete_file_name[GENERIC_OBJECT_LEN_LOG_FILE_NAME];
+   time_t         current_time;
+   unsigned long  mask[2];
+   int            i;
+
+   switch (command_id)
+   {
+      case Cmd_Enable_1553_Log:
+         if( Bus_Recorder.Is_Open () )
+            Log_Warning ("Static command string \"ENABLE_1553_LOG\" 1553 bus logging is already enabled");
+         else if( n_args > 2 )
+            Log_Warning ("Static command string \"ENABLE_1553_LOG\" allows the RT and subaddress masks only");
+         else{
+            // Optional RT and subaddress masks (decimal, or hexadecimal with '#' prefix)
+            for (i = 0; i < 2; i++)
+               mask[i] = (i >= n_args) ? 0xFFFFFFFF : (args[i].s[0] == '#') ? strtoul (args[i].s+1, NULL, 16) : strtoul (args[i].s, NULL, 10);
+            time (&current_time);
+            tm *time_now = localtime (&current_time);
+            sprintf (complete_file_name, "%s1553_dump_%04i%02i%02i_%02i%02i%02i.bin", Path,
+                     time_now->tm_year+1900, time_now->tm_mon+1, time_now->tm_mday,
+                     time_now->tm_hour, time_now->tm_min, time_now->tm_sec);
+            if ( Bus_Recorder.Open (complete_file_name, mask[0], mask[1]) == Nominal ) // Open the 1553 recording file
+               result = Nominal;
             else
-            {
-               Log_Warning ("Static command string \"%s\" does not require any parameter, \"%i\" have been found instead", model_command, n_parameters);
-               return;
-            }
+               Log_Warning ("Static command string \"ENABLE_1553_LOG\" unable to open for writing the \"%s\" 1553 log file", complete_file_name);
          }
          break;
 
-      case 'D':
-         if(!strcmp (model_command, "DISABLE_1553_LOG")){
-            command_identified = true;
-            if (n_parameters == 0)
-            {
-               if( Log_1553_File == NULL )
-                  Log_Warning ("Static command string \"%s\" 1553 bus logging is not enabled", model_command);
-               else{
-                  fclose( Log_1553_File );
-                  Log_1553_File = NULL;
-                  result = Nominal;
-               }
-            }
-            else
-            {
-               Log_Warning ("Static command string \"%s\" does not require any parameter, \"%i\" have been found instead", model_command, n_parameters);
-               return;
-            }
+      case Cmd_Disable_1553_Log:
+         if( !Bus_Recorder.Is_Open () )
+            Log_Warning ("Static command string \"DISABLE_1553_LOG\" 1553 bus logging is not enabled");
+         else{
+            Bus_Recorder.Close ();
+            result = Nominal;
          }
          break;
-   }
 
-   // The global Command has not been identified
-   if (!command_identified)
-      Log_Warning ("Static_Local_Parser : FAILED processing static command \"%s\" with \"%i\" parameter-tokens", model_command, n_parameters);
+      case Cmd_Dump_Bus_Stats:
+         if( n_args && strcmp (args[0].s, "RESET") )
+            Log_Warning ("Static command string \"DUMP_BUS_STATS\" allows the \"RESET\" parameter only");
+         else{
+            Dump_Bus_Stats (n_args > 0);
+            result = Nominal;
+         }
+         break;
+
+      case Cmd_Reload_Config:
+         result = Reload_Config (args[0].s);
+         break;
+   }
 }
 
 //-------------------------------------------------------------------
 void GenericObject::Model_Local_Parser (typ_return &result, char* model_command, int n_parameters, char* parameters[])
 //-------------------------------------------------------------------
+{
+   const CommandTable::typ_CommandSchema  *schema;
+   const CommandTable                     *table;
+   CommandTable::typ_CommandArg           *args;
+   bool                                   generic_command;
+
+// Identify the command among the generic commands first, then among the Model class ones
+   schema          = Generic_Commands.Find (model_command);
+   if (schema && !Generic_Command_Applies (schema->id))
+      schema = NULL;
+   generic_command = (schema != NULL);
+   if (!schema && (table = Get_Command_Table ()))
+      schema = table->Find (model_command);
+
+// If the command has not been identified then parse it with the specific model parser
+   if (!schema)
+   {
+      Local_Parser (result, model_command, n_parameters, parameters);
+      return;
+   }
+
+// Convert the Text-Parameters as per the command schema and execute it
+   args = new CommandTable::typ_CommandArg [n_parameters+1];
+   if (args && CommandTable::Convert (schema, n_parameters, parameters, args) == Nominal)
+   {
+      if (generic_command)
+         Generic_Command (result, schema->id, n_parameters, args);
+      else
+         Local_Command (result, schema->id, n_parameters, args);
+   }
+   if (args)
+      delete [] args;
+}
+
+//-------------------------------------------------------------------
+void GenericObject::Generic_Command (typ_return &result, int command_id, int n_args, const CommandTable::typ_CommandArg args[])
+//-------------------------------------------------------------------
 {
    char     comlete_file_name[GENERIC_OBJECT_LEN_LOG_FILE_NAME];
-   bool     command_identified = false;
     int     i, k, SubAddress, ModeCode, enabling_flag;
    time_t   current_time;
+   typ_Rt1553_word   *Modifier;
 
-   switch (*model_command)
+   switch (command_id)
    {
-      case 'D':
-         if (!strcmp (model_command, "DISABLE_DEBUG"))
-         {
-            command_identified = true;
-            if (n_parameters == 0)
-            {
-               if (Debug_File)
-                  fclose (Debug_File); // Close the trace file, if open
-               Debug_File = NULL;
-               result = Nominal;
-            }
-            else
-            {
-               Log_Warning ("Command string \"%s\". Model \"%s.DISABLE_DEBUG\" does not require any parameter, \"%i\" have been found instead", model_command, Name, n_parameters);
-               return;
-            }
-         }
-      break;
+      case Cmd_Disable_Debug:
+         if (Debug_File)
+            fclose (Debug_File); // Close the trace file, if open
+         Debug_File = NULL;
+         result = Nominal;
+         break;
 
-      case 'E':
-         if (!strcmp (model_command, "ENABLE_DEBUG"))
+      case Cmd_Enable_Debug:
+         if (Debug_File)
+            fclose (Debug_File); // Close the previous trace file, if already open
+         time (&current_time);
          {
-            command_identified = true;
-            if (n_parameters == 0)
-            {
-               if (Debug_File)
-                  fclose (Debug_File); // Close the previous trace file, if already open
-               time (&current_time);
-               tm *time_now = localtime (&current_time);
-               sprintf (comlete_file_name, "%s_debug_%s_%04i%02i%02i_%02i%02i%02i.txt", Path, Name,
-                  time_now->tm_year+1900, time_now->tm_mon+1, time_now->tm_mday,
-                  time_now->tm_hour, time_now->tm_min, time_now->tm_sec);
-               Debug_File = fopen (comlete_file_name, "wt"); // Open the new trace file
-               if (Debug_File)
-                  result = Nominal;
-               else
-                  Log_Warning ("Command string \"%s\". Model \"%s.ENABLE_DEBUG\" unable to open for writing the \"%s\" utput text file", model_command, Name, comlete_file_name);
-            }
-            else
-            {
-               Log_Warning ("Command string \"%s\". Model \"%s.ENABLE_DEBUG\" does not require any parameter, \"%i\" have been found instead", model_command, Name, n_parameters);
-               return;
-            }
+            tm *time_now = localtime (&current_time);
+            sprintf (comlete_file_name, "%s_debug_%s_%04i%02i%02i_%02i%02i%02i.txt", Path, Name,
+               time_now->tm_year+1900, time_now->tm_mon+1, time_now->tm_mday,
+               time_now->tm_hour, time_now->tm_min, time_now->tm_sec);
          }
+         Debug_File = fopen (comlete_file_name, "wt"); // Open the new trace file
+         if (Debug_File)
+            result = Nominal;
+         else
+            Log_Warning ("Model \"%s.ENABLE_DEBUG\" unable to open for writing the \"%s\" utput text file", Name, comlete_file_name);
          break;
 
-      case 'F':
-         if(!strcmp(model_command, "FORCE_INPUT"))
+      case Cmd_Force_Input:
+      case Cmd_Force_Output:
          {
-            command_identified = true;
-            if (n_parameters >= 2 // There shall be at least the First Index and the First Value
-             && atoi(parameters[0]) >= 1 // First Index check
-             && atoi(parameters[0]) + n_parameters - 2 <= nu // Last index check
-             && pU_Forced)
+            ForcingEngine::typ_Forcing *&pForcing = (command_id == Cmd_Force_Input) ? pU_Forcing : pY_Forcing;
+            double                     *pData    = (command_id == Cmd_Force_Input) ? pU : pY;
+            typ_forced_value           *pView    = (command_id == Cmd_Force_Input) ? pU_Forced : pY_Forced;
+            int                        n         = (command_id == Cmd_Force_Input) ? nu : ny;
+
+            if (args[0].i >= 1 // First Index check
+             && args[0].i + n_args - 2 <= n) // Last index check
             {
-               for (i = 1; i < n_parameters; i++)
-               {
-                  k = atoi(parameters[0]) + i - 1;
-                  if     (*parameters[i] == '*') // Reset the forcing flag
-                     pU_Forced[k-1].forced_flag = 0;
-                  else if(*parameters[i] == '=') // Do nothing, leave as it is
-                     ;
-                  else
-                  {
-                     pU_Forced[k-1].forced_flag = 1;
-                     pU_Forced[k-1].forced_value = atof (parameters[i]);
-                  }
-               }
                result = Nominal;
-            }
-         }
-         else if(!strcmp(model_command, "FORCE_OUTPUT"))
-         {
-            command_identified = true;
-            if (n_parameters >= 2 // There shall be at least the First Index and the First Value
-             && atoi(parameters[0]) >= 1 // First Index check
-             && atoi(parameters[0]) + n_parameters - 2 <= ny // Last index check
-             && pY_Forced)
-            {
-               for (i = 1; i < n_parameters; i++)
+               for (i = 1; i < n_args; i++)
                {
-                  k = atoi(parameters[0]) + i - 1;
-                  if     (*parameters[i] == '*') // Reset the forcing flag
-                     pY_Forced[k-1].forced_flag = 0;
-                  else if(*parameters[i] == '=') // Do nothing, leave as it is
-                     ;
-                  else
+                  k = args[0].i + i - 1;
+                  if     (args[i].kind == '*') // Reset the forcing
                   {
-                     pY_Forced[k-1].forced_flag = 1;
-                     pY_Forced[k-1].forced_value = atof (parameters[i]);
+                     Forcing_Engine.Remove (pForcing, pData+k-1);
+                     if (pView)
+                        pView[k-1].forced_flag = 0;
                   }
-               }
-               result = Nominal;
-            }
-         }
-         else if(!strcmp(model_command, "FREEZE_INPUT"))
-         {
-            command_identified = true;
-            for (i = 0; i < nu; i++)
-            {
-               {
-                  pU_Forced[i].forced_flag  = 1;
-                  pU_Forced[i].forced_value = pU[i];
-               }
-            }
-            result = Nominal;
-         }
-         else if(!strcmp(model_command, "FREEZE_OUTPUT"))
-         {
-            command_identified = true;
-            for (i = 0; i < ny; i++)
-            {
-               {
-                  pY_Forced[i].forced_flag  = 1;
-                  pY_Forced[i].forced_value = pY[i];
+                  else if(args[i].kind == '=') // Do nothing, leave as it is
+                     ;
+                  else if (Forcing_Engine.Set (pForcing, pData+k-1, k, ForcingEngine::Constant, 1, &args[i].d) == Error)
+                     result = Error;
                }
             }
-            result = Nominal;
          }
-      break;
+         break;
 
-      case 'R':
-         if (Rt1553_RemoteTerminalAddress && !memcmp (model_command, "RT_", 3))
+      case Cmd_Force_Input_Profile:
+      case Cmd_Force_Output_Profile:
          {
-            if(!strcmp(model_command, "RT_SET_STATUS") && n_parameters == 1)
-            {
-               command_identified = true;
-               enabling_flag = atoi (parameters[0]);
-               if (0 <= enabling_flag && enabling_flag <= 1)
-               {
-                  result = Nominal;
-                  Rt1553_Set_RT_Status (enabling_flag==1?Enable:Disable);
-               }
-            }
-            else if(!strcmp(model_command, "RT_SET_SA_STATUS") && n_parameters == 3)
-            {
-               command_identified = true;
-               SubAddress    = atoi (parameters[0]);
-               enabling_flag = atoi (parameters[2]);
-               if (1 <= SubAddress    && SubAddress    <= 30
-               &&  0 <= enabling_flag && enabling_flag <=  1
-               && strchr ("TR", *parameters[1]))
-               {
-                  result = Nominal;
-                  Rt1553_Set_SA_Status (SubAddress, *parameters[1]=='T'?DSS_TX:DSS_RX, enabling_flag==1?Enable:Disable);
-               }
-            }
-            else if(!strcmp(model_command, "RT_SET_MC_STATUS") && n_parameters == 2)
+            ForcingEngine::typ_Forcing *&pForcing = (command_id == Cmd_Force_Input_Profile) ? pU_Forcing : pY_Forcing;
+            double                     *pData    = (command_id == Cmd_Force_Input_Profile) ? pU : pY;
+            int                        n         = (command_id == Cmd_Force_Input_Profile) ? nu : ny;
+            ForcingEngine::typ_profile profile;
+            double                     points[FORCING_MAX_PROFILE_POINTS];
+
+            k = args[0].i;
+            if (k < 1 || k > n)
+               Log_Warning ("Model \"%s\" forcing profile index %i is out of the range [1..%i]", Name, k, n);
+            else if (ForcingEngine::Get_Profile (args[1].s, profile) == Error)
+               Log_Warning ("Model \"%s\" forcing profile \"%s\" is unknown (allowed: CONSTANT, RAMP, STEP, SINE, TABLE)", Name, args[1].s);
+            else if (n_args-2 > FORCING_MAX_PROFILE_POINTS)
+               Log_Warning ("Model \"%s\" forcing profile has more than %i parameters", Name, FORCING_MAX_PROFILE_POINTS);
+            else
             {
-               command_identified = true;
-               ModeCode      = atoi (parameters[0]);
-               enabling_flag = atoi (parameters[1]);
-               if (0 <= ModeCode     && ModeCode       <= 31
-               &&  0 <= enabling_flag && enabling_flag <=  1)
-               {
+               for (i = 2; i < n_args; i++)
+                  points[i-2] = args[i].d;
+               if (Forcing_Engine.Set (pForcing, pData+k-1, k, profile, n_args-2, points) == Error)
+                  Log_Warning ("Model \"%s\" forcing profile \"%s\" has inconsistent parameters", Name, args[1].s);
+               else
                   result = Nominal;
-                  Rt1553_Set_MC_Status (ModeCode, enabling_flag==1?Enable:Disable);
-               }
-            }
-            else if(!strcmp(model_command, "RT_FORCE_SA_TX_BUFFER"))
-            {
-               command_identified = true;
-               if (1 <= n_parameters && n_parameters <= 33)
-               {
-                  SubAddress = atoi (parameters[0]);
-                  if (1 <= SubAddress && SubAddress <= 30)
-                  {
-                     result = Nominal;
-                     if (n_parameters == 1) // No further parameters, reset all the forcing flags
-                        for (i = 0; i < 32; i++)
-                           TxModifier[SubAddress].forced_flag[i] = 0;
-                     else
-                        for(i = 1; i < n_parameters; i++)
-                        {
-                           if     (*parameters[i] == '*') // Reset the forcing flag
-                              TxModifier[SubAddress].forced_flag[i-1] = 0;
-                           else if(*parameters[i] == '=') // Do nothing, leave as it is
-                              ;
-                           else
-                           {
-                              TxModifier[SubAddress].forced_flag[i-1] = 1;
-                              TxModifier[SubAddress].word_value[i-1]  = (unsigned short)_AtoI(parameters[i]);
-                           }
-                        }
-                  }
-               }
-             }
-            else if(!strcmp(model_command, "RT_FORCE_SA_RX_BUFFER"))
-            {
-               command_identified = true;
-               if (1 <= n_parameters && n_parameters <= 33)
-               {
-                  SubAddress = atoi (parameters[0]);
-                  if (1 <= SubAddress && SubAddress <= 30)
-                  {
-                     result = Nominal;
-                     if (n_parameters == 1) // No further parameters, reset all the forcing flags
-                        for (i = 0; i < 32; i++)
-                           RxModifier[SubAddress].forced_flag[i] = 0;
-                     else
-                        for(i = 1; i < n_parameters; i++)
-                        {
-                           if     (*parameters[i] == '*') // Reset the forcing flag
-                              RxModifier[SubAddress].forced_flag[i-1] = 0;
-                           else if(*parameters[i] == '=') // Do nothing, leave as it is
-                              ;
-                           else
-                           {
-                              RxModifier[SubAddress].forced_flag[i-1] = 1;
-                              RxModifier[SubAddress].word_value[i-1]  = (unsigned short)_AtoI(parameters[i]);
-                           }
-                        }
-                  }
-               }
-            }
-            else if(!strcmp(model_command, "RT_FORCE_MC_BUFFER"))
-            {
-               command_identified = true;
-               if (1 <= n_parameters && n_parameters <= 2)
-               {
-                  ModeCode = atoi (parameters[0]);
-                  if (0 <= ModeCode && ModeCode <= 31)
-                  {
-                     result = Nominal;
-                     if (n_parameters == 1) // No further parameters, reset all the forcing flags
-                        McModifier[ModeCode].forced_flag[0] = 0;
-                     else // i.e. if n_parameters == 2
-                     {
-                        if     (*parameters[1] == '=') // Reset the forcing flag
-                           McModifier[ModeCode].forced_flag[0] = 0;
-                        else if(*parameters[1] == '*') // Do nothing, leave as it is
-                           ;
-                        else
-                        {
-                           McModifier[ModeCode].forced_flag[0] = 1;
-                           McModifier[ModeCode].word_value[0]  = (unsigned short)_AtoI(parameters[1]);
-                        }
-                     }
-                  }
-               }
             }
          }
-      break;
+         break;
 
-      case 'S':
-         if (!strcmp (model_command, "SWITCH_ON"))
-         {
-            command_identified = true;
-            result = Command_Switch_ON();
-         }
-         else if(!strcmp(model_command, "SWITCH_OFF"))
+      case Cmd_Freeze_Input:
+      case Cmd_Freeze_Output:
          {
-            command_identified = true;
-            result = Command_Switch_OFF();
+            ForcingEngine::typ_Forcing *&pForcing = (command_id == Cmd_Freeze_Input) ? pU_Forcing : pY_Forcing;
+            double                     *pData    = (command_id == Cmd_Freeze_Input) ? pU : pY;
+            int                        n         = (command_id == Cmd_Freeze_Input) ? nu : ny;
+
+            result = Nominal;
+            for (i = 0; i < n; i++)
+               if (Forcing_Engine.Set (pForcing, pData+i, i+1, ForcingEngine::Constant, 1, pData+i) == Error)
+                  result = Error;
          }
-         else if(!strcmp(model_command, "SET_POWER_LOAD") && n_parameters == 1)
+         break;
+
+      case Cmd_Rt_Set_Status:
+         enabling_flag = args[0].i;
+         if (0 <= enabling_flag && enabling_flag <= 1)
          {
-            command_identified = true;
             result = Nominal;
-            PowerLoad = atof (parameters[0]);
+            Rt1553_Set_RT_Status (enabling_flag==1?Enable:Disable);
          }
-         else if(!strcmp(model_command, "SET_VALUE") && n_parameters == 2)
+         break;
+
+      case Cmd_Rt_Set_SA_Status:
+         SubAddress    = args[0].i;
+         enabling_flag = args[2].i;
+         if (1 <= SubAddress    && SubAddress    <= 30
+         &&  0 <= enabling_flag && enabling_flag <=  1
+         && (args[1].i == 'T' || args[1].i == 'R'))
          {
-            command_identified = true;
-            result = SetValue (parameters[0], atof (parameters[1]));
+            result = Nominal;
+            Rt1553_Set_SA_Status (SubAddress, args[1].i=='T'?DSS_TX:DSS_RX, enabling_flag==1?Enable:Disable);
          }
-         else if(!strcmp(model_command, "SET_COMPONENTS") && n_parameters > 2)
+         break;
+
+      case Cmd_Rt_Set_MC_Status:
+         ModeCode      = args[0].i;
+         enabling_flag = args[1].i;
+         if (0 <= ModeCode     && ModeCode       <= 31
+         &&  0 <= enabling_flag && enabling_flag <=  1)
          {
-            command_identified = true;
             result = Nominal;
-            for (i = 0; i < n_parameters-2 && result == Nominal; i++)
-               if (SetValue (parameters[0], atoi(parameters[1])+i-1, atof(parameters[2+i])) == Error)
-                  result = Error;
+            Rt1553_Set_MC_Status (ModeCode, enabling_flag==1?Enable:Disable);
          }
-      break;
+         break;
 
-      case 'U':
-         if(!strcmp(model_command, "UNFORCE_INPUT"))
+      case Cmd_Rt_Force_SA_Tx_Buffer:
+      case Cmd_Rt_Force_SA_Rx_Buffer:
+         SubAddress = args[0].i;
+         Modifier   = (command_id == Cmd_Rt_Force_SA_Tx_Buffer) ? TxModifier : RxModifier;
+         if (n_args <= 33 && 1 <= SubAddress && SubAddress <= 30)
          {
-            command_identified = true;
-            if (pU_Forced)
-               for (i = 0; i < nu; i++)
-                  pU_Forced[i].forced_flag = 0;
             result = Nominal;
+            if (n_args == 1) // No further parameters, reset all the forcing flags
+               for (i = 0; i < 32; i++)
+                  Modifier[SubAddress].forced_flag[i] = 0;
+            else
+               for(i = 1; i < n_args; i++)
+               {
+                  if     (args[i].kind == '*') // Reset the forcing flag
+                     Modifier[SubAddress].forced_flag[i-1] = 0;
+                  else if(args[i].kind == '=') // Do nothing, leave as it is
+                     ;
+                  else
+                  {
+                     Modifier[SubAddress].forced_flag[i-1] = 1;
+                     Modifier[SubAddress].word_value[i-1]  = (unsigned short)args[i].i;
+                  }
+               }
          }
-         else if(!strcmp(model_command, "UNFORCE_OUTPUT"))
+         break;
+
+      case Cmd_Rt_Force_MC_Buffer:
+         ModeCode = args[0].i;
+         if (0 <= ModeCode && ModeCode <= 31)
          {
-            command_identified = true;
-            if (pY_Forced)
-               for (i = 0; i < ny; i++)
-                  pY_Forced[i].forced_flag = 0;
             result = Nominal;
+            if (n_args == 1) // No further parameters, reset all the forcing flags
+               McModifier[ModeCode].forced_flag[0] = 0;
+            else // i.e. if n_args == 2
+            {
+               if     (args[1].kind == '=') // Reset the forcing flag
+                  McModifier[ModeCode].forced_flag[0] = 0;
+               else if(args[1].kind == '*') // Do nothing, leave as it is
+                  ;
+               else
+               {
+                  McModifier[ModeCode].forced_flag[0] = 1;
+                  McModifier[ModeCode].word_value[0]  = (unsigned short)args[1].i;
+               }
+            }
          }
-      break;
-   }
+         break;
 
-// If the command has not been identified then parse it with the specific model parser
-   if (!command_identified)
-      Local_Parser (result, model_command, n_parameters, parameters);
-}
+      case Cmd_Switch_On:
+         result = Command_Switch_ON();
+         break;
 
-//-------------------------------------------------------------------------
-void GenericObject::Initialize_All (const char* Input_File_Name, typ_return &result)
-//-------------------------------------------------------------------------
+      case Cmd_Switch_Off:
+         result = Command_Switch_OFF();
+         break;
+
+      case Cmd_Set_Power_Load:
+         result = Nominal;
+         PowerLoad = args[0].d;
+         break;
+
+      case Cmd_Set_Value:
+         result = SetValue (args[0].s, args[1].d);
+         break;
+
+      case Cmd_Set_Components:
+         result = Nominal;
+         for (i = 0; i < n_args-2 && result == Nominal; i++)
+            if (SetValue (args[0].s, args[1].i+i-1, args[2+i].d) == Error)
+               result = Error;
+         break;
+
+      case Cmd_Unforce_Input:
+         if (pU_Forced)
+            Reset_Forced_View (pU_Forcing, pU_Forced);
+         Forcing_Engine.Clear (pU_Forcing);
+         result = Nominal;
+         break;
+
+      case Cmd_Unforce_Output:
+         if (pY_Forced)
+            Reset_Forced_View (pY_Forcing, pY_Forced);
+         Forcing_Engine.Clear (pY_Forcing);
+         result = Nominal;
+         break;
+   }
+}
+
+//-------------------------------------------------------------------------
+void GenericObject::Initialize_All (const char* Input_File_Name, typ_return &result)
+//-------------------------------------------------------------------------
+{
+   ConfigStore       *config;
+
+   config = ConfigStore::Load (Input_File_Name); // Load the model setup input file (or share it, if already loaded)
+   if (!config)
+   {
+      result = Error;
+      Log_Error ("Initialize_All : Unable to open for reading the input file \"%s\"", (Input_File_Name ? Input_File_Name : INPUTFILE_DEFAULT));
+      return;
+   }
+   Initialize_All (config, result);
+   config->Release (); // The reference is kept by "Config_Store"
+}
+
+//-------------------------------------------------------------------------
+void GenericObject::Initialize_All (ConfigStore* config, typ_return &result)
+//-------------------------------------------------------------------------
 {
    typ_return        model_result;
-   GenericObject     *model;
+   GenericObject     *model, *wave, **models = NULL;
+   unsigned long     level;
+   int               n;
+
+   _Deallocate (input_file) // Close and free the input file reader, if already open
 
-   _Deallocate (input_file) // Close and free the input file, if already open
+// Keep the configuration store for the whole simulation
+   if (config)
+      config->Acquire ();
+   if (Config_Store)
+      Config_Store->Release ();
+   Config_Store = config;
 
-   input_file = new InputFile; // Open the model setup input file
+   input_file = new InputFile; // Read the model setup configuration
    if (!input_file)
    {
       result = Error;
       return;
    }
 
-   input_file->open (Input_File_Name);
+   if (Initialize_Threads > 1)
+      input_file->FreezeCache (); // Each reader of the parallel initialization reads a part of the symbols only
+   input_file->attach (Config_Store);
    result = input_file->error ? Error : Nominal;
    if (result == Error)
-      Log_Error ("Initialize_All : Unable to open for reading the input file \"%s\"", Input_File_Name);
+      Log_Error ("Initialize_All : Unable to read the configuration");
+
+// Parallel initialization: the time-scheduled commands are loaded first, then the Models are initialized by the threads
+   if (result == Nominal && Initialize_Threads > 1 && Number_Of_Objects > 1)
+   {
+      models = new GenericObject*[Number_Of_Objects];
+      if (!models)
+      {
+         result = Error;
+         Log_Error ("Initialize_All : Unable to allocate in RAM the Objects List array \"models[%i]\"", Number_Of_Objects);
+      }
+   }
+   if (models)
+   {
+      if (!Command_Stack_Loaded)
+         Load_Command_Stack ();
+      for (n = 0, model = Get_First (); model; model = model->Get_Next())
+         if (!model->Serial_Initialization_Flag)
+            models[n++] = model;
+      Log_Message ("Initialize_All : initializing %i Models on %i threads", n, Initialize_Threads);
+      result = Run_Initialization_Batch (models, n, false);
+   }
 
    model = Get_First ();
-   while (result == Nominal && model) // Iterate on all the registered Objects
+   while (result == Nominal && model) // Iterate on all the registered Objects (the ones not initialized yet)
    {
       model_result = Nominal;
-      Log_Write ("\n>>>> Reading Input File to initialize Model \"%s\" <<<<\n\n", model->Get_Name());
-      model->Initialize_Model (model_result);
+      if (!models || model->Serial_Initialization_Flag)
+      {
+         Log_Write ("\n>>>> Reading Input File to initialize Model \"%s\" <<<<\n\n", model->Get_Name());
+         model->Initialize_Model (model_result);
+      }
       if (model_result == Error)
          result = Error;
 
       model = model->Get_Next();
    }
    input_file->close ();
-   _Deallocate (input_file);
+   _Deallocate (input_file); // The configuration store is kept ("Get_Config_Store")
 
 // Now call the Update function for all the Objects to complete their initialization
    model = Get_First ();
 
-   while (result == Nominal && model) // Iterate on all the registered Objects
+   if (models && topology_solved_flag)
+   {
+// Parallel first update in topological waves: the Models of the same nesting level do not feed each other; those not allowed
+// to run concurrently follow the others of their wave, in the list order
+      while (result == Nominal && model)
+      {
+         wave  = model;
+         level = model->nesting_level;
+         for (n = 0; model && model->nesting_level == level; model = model->Get_Next())
+            if (model->Concurrent_Initialization_Allowed ())
+               models[n++] = model;
+         result = Run_Initialization_Batch (models, n, true);
+
+         for (; result == Nominal && wave != model; wave = wave->Get_Next())
+            if (!wave->Concurrent_Initialization_Allowed ())
+            {
+               model_result = Nominal;
+               wave->First_Update (model_result);
+               if (model_result == Error)
+                  result = Error;
+            }
+      }
+   }
+
+   while (result == Nominal && model) // Iterate on all the registered Objects (serial first update)
    {
       model_result = Nominal;
-      Log_Write ("\n>>>> \"%s\": Initialize_All() --> Get_Connected_Inputs()  <<<<\n\n", model->Get_Name());
-      model->Get_Model_Input (model_result, Current_Epoch, true);
+      model->First_Update (model_result);
+      if (model_result == Error)
+         result = Error;
+      model = model->Get_Next();
+   }
+   delete [] models;
+
+// Dispatch the commands scheduled at the initial epoch
+   if (result == Nominal)
+      Dispatch_Commands (Current_Epoch);
+}
+
+//-------------------------------------------------------------------------
+typ_return GenericObject::Reload_Config (const char* Input_File_Name)
+//-------------------------------------------------------------------------
+{
+   typ_return        result = Nominal, model_result;
+   ConfigStore       *config;
+   GenericObject     *model;
+   const char        **changed, **parameters;
+   int               i, n_changed, n_parameters, n_symbols, name_length;
+
+   config = ConfigStore::Load (Input_File_Name); // A new store, unless the file is unchanged
+   if (!config)
+   {
+      Log_Error ("Reload_Config : Unable to open for reading the input file \"%s\"", Input_File_Name);
+      return Error;
+   }
+   if (config == Config_Store)
+   {
+      Log_Message ("Reload_Config : the configuration \"%s\" is unchanged", Input_File_Name);
+      config->Release ();
+      return Nominal;
+   }
+
+// List the changed symbols (names held by the old and the new stores)
+   n_symbols  = config->Get_N_Symbols () + (Config_Store ? Config_Store->Get_N_Symbols () : 0);
+   changed    = new const char*[n_symbols + 1];
+   parameters = new const char*[n_symbols + 1];
+   n_changed  = config->Compare (Config_Store, changed);
+   Log_Message ("Reload_Config : %i symbols changed in the configuration \"%s\"", n_changed, Input_File_Name);
+
+   _Deallocate (input_file)
+   input_file = new InputFile;
+   if (input_file)
+      input_file->attach (config);
+   if (!input_file || input_file->error)
+   {
+      Log_Error ("Reload_Config : Unable to read the configuration \"%s\"", Input_File_Name);
+      result = Error;
+      n_changed = 0;
+   }
+
+// Apply to each Model its changed parameters ("<Model Name>.<parameter>")
+   for (model = Get_First (); n_changed && model; model = model->Get_Next())
+   {
+      name_length = strlen (model->Name);
+      for (n_parameters = i = 0; i < n_changed; i++)
+         if (changed[i] && !strncmp (changed[i], model->Name, name_length) && changed[i][name_length] == '.')
+         {
+            parameters[n_parameters++] = changed[i] + name_length + 1;
+            changed[i] = NULL;
+         }
+      if (!n_parameters)
+         continue;
+      Log_Write ("\n>>>> Reading Input File to reconfigure Model \"%s\" (%i changed parameters) <<<<\n\n", model->Name, n_parameters);
+      model_result = Nominal;
+      model->Reconfigure_Model (model_result, n_parameters, parameters);
       if (model_result == Error)
       {
          result = Error;
-         Log_Error ("\n ERROR: \"%s\" Initialize_All() --> Get_Connected_Inputs <<<<<\n\n", model->Get_Name());
+         Log_Error ("Reload_Config : \"%s\" reconfiguration failed", model->Name);
+      }
+   }
+   for (i = 0; i < n_changed; i++)
+      if (changed[i])
+         Log_Warning ("Reload_Config : the changed symbol \"%s\" does not belong to any Model, it has not been applied", changed[i]);
+   if (input_file && input_file->error)
+   {
+      Log_Error ("Reload_Config : %i errors reading the configuration \"%s\"", input_file->error, Input_File_Name);
+      result = Error;
+   }
+
+   if (input_file)
+      input_file->close ();
+   _Deallocate (input_file);
+   delete [] changed;
+   delete [] parameters;
+
+// On failure the current configuration is kept, so that the next reload compares the file with it again
+   if (result == Error)
+   {
+      Log_Error ("Reload_Config : the configuration \"%s\" has not been (fully) applied, the previous one is kept", Input_File_Name);
+      config->Release ();
+      return Error;
+   }
+
+// The new configuration replaces the current one (the reference of "Load" is kept)
+   if (Config_Store)
+      Config_Store->Release ();
+   Config_Store = config;
+   return result;
+}
+
+//-------------------------------------------------------------------------
+typ_return GenericObject::Run_Initialization_Batch (GenericObject **models, int n_models, bool update_flag)
+//-------------------------------------------------------------------------
+{
+   typ_initialization_batch   batch;
+   pthread_t                  *thread = NULL;
+   int                        i, n_threads;
+
+   batch.model       = models;
+   batch.n_models    = n_models;
+   batch.next_model  = 0;
+   batch.update_flag = update_flag;
+   batch.n_errors    = 0;
+
+// The calling thread processes the batch too, with the threads successfully started
+   n_threads = ((Initialize_Threads < n_models) ? Initialize_Threads : n_models) - 1;
+   if (n_threads > 0)
+      thread = new pthread_t[n_threads];
+   for (i = 0; thread && i < n_threads; i++)
+      if (pthread_create (&thread[i], NULL, Initialization_Thread, &batch))
+      {
+         Log_Warning ("Initialize_All : Unable to start an initialization thread, the batch is processed by %i threads", i+1);
+         n_threads = i;
       }
+   Process_Initialization_Batch (batch);
+   for (i = 0; thread && i < n_threads; i++)
+      pthread_join (thread[i], NULL);
+   delete [] thread;
+
+   return batch.n_errors ? Error : Nominal;
+}
+
+//-------------------------------------------------------------------------
+void GenericObject::Process_Initialization_Batch (typ_initialization_batch &batch)
+//-------------------------------------------------------------------------
+{
+   typ_return  model_result;
+   int         i;
+
+   while (!__atomic_load_n (&batch.n_errors, __ATOMIC_RELAXED)
+        && (i = __atomic_fetch_add (&batch.next_model, 1, __ATOMIC_RELAXED)) < batch.n_models)
+   {
+      model_result = Nominal;
+      if (batch.update_flag)
+         batch.model[i]->First_Update (model_result);
       else
       {
-         model->Update_Model (model_result, Current_Epoch, true);
-         if (model_result == Error)
-         {
-            result = Error;
-            Log_Error ("\n ERROR: \"%s\" Initialize_All() --> Update_Model <<<<<\n\n", model->Get_Name());
-         }
+         Log_Write ("\n>>>> Reading Input File to initialize Model \"%s\" <<<<\n\n", batch.model[i]->Get_Name());
+         batch.model[i]->Initialize_Model (model_result);
       }
-      model = model->Get_Next();
+      if (model_result == Error)
+         __atomic_add_fetch (&batch.n_errors, 1, __ATOMIC_RELAXED);
+   }
+}
+
+//-------------------------------------------------------------------------
+void* GenericObject::Initialization_Thread (void *batch)
+//-------------------------------------------------------------------------
+{
+   typ_initialization_batch   &work = *(typ_initialization_batch*) batch;
+
+   if (work.update_flag)
+   {
+      Process_Initialization_Batch (work);
+      return NULL;
+   }
+
+// The Models initialized by this thread read the configuration through a reader of the thread
+   input_file = new InputFile;
+   if (!input_file)
+   {
+      __atomic_add_fetch (&work.n_errors, 1, __ATOMIC_RELAXED);
+      return NULL;
+   }
+   input_file->FreezeCache ();
+   if (input_file->attach (Config_Store) == Nominal)
+      Process_Initialization_Batch (work);
+   input_file->close ();
+   _Deallocate (input_file);
+   return NULL;
+}
+
+//-------------------------------------------------------------------------
+void GenericObject::First_Update (typ_return &result)
+//-------------------------------------------------------------------------
+{
+   Log_Write ("\n>>>> \"%s\": Initialize_All() --> Get_Connected_Inputs()  <<<<\n\n", Name);
+   Get_Model_Input (result, Current_Epoch, true);
+   if (result == Error)
+   {
+      Log_Error ("\n ERROR: \"%s\" Initialize_All() --> Get_Connected_Inputs <<<<<\n\n", Name);
+      return;
    }
+   Update_Model (result, Current_Epoch, true);
+   if (result == Error)
+      Log_Error ("\n ERROR: \"%s\" Initialize_All() --> Update_Model <<<<<\n\n", Name);
+}
+
+//-------------------------------------------------------------------------
+bool GenericObject::Concurrent_Initialization_Allowed ()
+//-------------------------------------------------------------------------
+{
+   int   i;
+
+// The Model shall declare its update safe; the BUS 1553 RT's are served by the Bus Controllers updates, the Serial Link partners
+// call each other, and a delayed input can be linked to a Model of the same wave
+   if (!Concurrent_Update_Flag || Serial_Initialization_Flag || Rt1553_RemoteTerminalAddress || N_serial_links)
+      return false;
+   for (i = 0; pY2U && i < nu; i++)
+      if (pY2U[i].pObject && pY2U[i].delay_flag)
+         return false;
+   return true;
 }
 
 //-------------------------------------------------------------------------
@@ -907,6 +1285,9 @@ void GenericObject::Status_All_Dynamic (double time, bool is_the_first_getinput,
    typ_return        model_result;
    GenericObject     *model = Get_First();
 
+// Evaluate in one batch the User forcing profiles at the phase time
+   Forcing_Engine.Evaluate (time);
+
    while (result == Nominal && model) // Iterate on all the registered Objects
    {
       model_result = Nominal;
@@ -940,6 +1321,9 @@ void GenericObject::Update_All_Dynamic (double time, bool is_the_final_updating,
    typ_return        model_result;
    GenericObject     *model = Get_First();
 
+// Evaluate in one batch the User forcing profiles at the phase time
+   Forcing_Engine.Evaluate (time);
+
    while (result == Nominal && model) // Iterate on all the registered Objects
    {
       model_result = Nominal;
@@ -959,6 +1343,10 @@ void GenericObject::Update_All_Dynamic (double time, bool is_the_final_updating,
       }
       model = model->Get_Next();
    }
+
+// Dispatch the expired commands once the final updating of the step has been completed
+   if (is_the_final_updating)
+      Dispatch_Commands (time);
 }
 
 //-------------------------------------------------------------------------
@@ -975,6 +1363,9 @@ void GenericObject::Update_All_Static_in_Chain (double time, typ_processing_mode
       return;
    }
 
+// Evaluate in one batch the User forcing profiles at the phase time
+   Forcing_Engine.Evaluate (time);
+
    result = Nominal;
    model  = Get_First ();
    while (result == Nominal && model) // Iterate on all the registered Objects
@@ -995,6 +1386,9 @@ void GenericObject::Update_All_Static_in_Chain (double time, typ_processing_mode
       }
       model = model->Get_Next();
    }
+
+// Dispatch the expired commands
+   Dispatch_Commands (time);
 }
 
 //-------------------------------------------------------------------------
@@ -1028,10 +1422,8 @@ GenericObject* GenericObject::Get_Object_by_Name (const char* ObjectName)
 typ_return GenericObject::Execute_Command (char* command_string)
 //-------------------------------------------------------------------------
 {
-   typ_return        result = Error;
-   char              *working_copy, *model_name, *model_command, *parameters[MAX_COMMAND_PARAMETERS_NUMBER];
-   int               n_parameters, length;
-   GenericObject     *model;
+   typ_return                 result = Error;
+   CommandQueue::typ_Command  *command;
 
    if (!command_string)
    {
@@ -1045,67 +1437,314 @@ typ_return GenericObject::Execute_Command (char* command_string)
    }
    Log_Message ("Execute_Command : Received the following command string : \"%s\"", command_string);
 
-// Duplicate the input command on a working copy
-   length = strlen (command_string) + 32;
-   working_copy = (char*) malloc (length);
-   if (!working_copy)
+// Parse the command string into a command record and execute it immediately
+   command = CommandQueue::Create (command_string, Current_Epoch);
+   if (!command)
+   {
+      Log_Error ("Execute_Command : Unable to allocate memory for the command string \"%s\" working copy", command_string);
+      return result;
+   }
+   result = Dispatch_Command (command);
+   CommandQueue::Delete (command);
+   return result;
+}
+
+//-------------------------------------------------------------------------
+typ_return GenericObject::Insert_Command (double elapsed_time, const char* command_string)
+//-------------------------------------------------------------------------
+{
+   CommandQueue::typ_Command  *command;
+   typ_return                 result;
+
+   if (!command_string || !strlen(command_string))
+   {
+      Log_Error ("Insert_Command : Received empty command string");
+      return Error;
+   }
+
+// Parse the command string once, the target Model is resolved now (if already registered) or at dispatching time
+   command = CommandQueue::Create (command_string, elapsed_time);
+   if (!command)
+   {
+      Log_Error ("Insert_Command : Unable to parse the command string \"%s\"", command_string);
+      return Error;
+   }
+   Lock_Registry (); // Models may queue commands while initialized concurrently
+   result = Queue_Command (command);
+   Unlock_Registry ();
+   return result;
+}
+
+//-------------------------------------------------------------------------
+typ_return GenericObject::Queue_Command (CommandQueue::typ_Command *command)
+//-------------------------------------------------------------------------
+{
+// Allocate the Commands Queue at first insertion
+   if (!Command_Queue)
+   {
+      Command_Queue = new CommandQueue;
+      if (!Command_Queue)
+      {
+         Log_Error ("Insert_Command : Unable to allocate in RAM the Commands Queue");
+         CommandQueue::Delete (command);
+         return Error;
+      }
+   }
+
+   if (command->model_name)
+      command->pTarget = Get_Object_by_Name (command->model_name);
+
+// Identify the command and validate its parameters once, now
+   if (Compile_Command (command, command->pTarget) == Error)
+   {
+      Log_Warning ("Insert_Command : command \"%s\" scheduled at %.3f s has been rejected", command->text, command->elapsed_time);
+      CommandQueue::Delete (command);
+      return Error;
+   }
+
+   if (command->elapsed_time < Current_Epoch)
+      Log_Warning ("Insert_Command : command \"%s\" scheduled at %.3f s is already expired, it will be dispatched at the next commands dispatching phase", command->text, command->elapsed_time);
+
+   if (Command_Queue->Push (command) == Error)
+   {
+      Log_Error ("Insert_Command : Unable to queue the command \"%s\"", command->text);
+      CommandQueue::Delete (command);
+      return Error;
+   }
+   return Nominal;
+}
+
+//-------------------------------------------------------------------------
+typ_return GenericObject::Post_Command (const char* command_string, double elapsed_time, CommandTicket **ticket)
+//-------------------------------------------------------------------------
+{
+   CommandQueue::typ_Command  *command;
+
+   if (ticket)
+      *ticket = NULL;
+
+// Parse the command string on the calling thread (no logging here, the Log File is owned by the sim thread)
+   command = CommandQueue::Create (command_string, elapsed_time);
+   if (!command)
+      return Error;
+   Posted_Commands.Post (command, elapsed_time < 0.0, ticket);
+   return Nominal;
+}
+
+//-------------------------------------------------------------------------
+typ_return GenericObject::Drain_Posted_Commands ()
+//-------------------------------------------------------------------------
+{
+   typ_return                             result = Nominal;
+   typ_return                             command_result;
+   CommandIngestQueue::typ_Posted         *posted;
+   CommandQueue::typ_Command              *command;
+   bool                                   immediate;
+
+// Apply in posting order all the commands posted since the last drain
+   while ((posted = Posted_Commands.Pop ()))
+   {
+      command   = posted->command;
+      immediate = posted->immediate;
+      delete posted;
+
+      if (immediate)
+      {
+         command->elapsed_time = Current_Epoch;
+         Log_Message ("Drain_Posted_Commands : executing posted command \"%s\"", command->text);
+         command_result = Dispatch_Command (command);
+         if (command->ticket)
+            command->ticket->Complete (command_result);
+         CommandQueue::Delete (command);
+      }
+      else
+      {
+         Log_Message ("Drain_Posted_Commands : queueing posted command \"%s\" scheduled at %.3f s", command->text, command->elapsed_time);
+         command_result = Queue_Command (command);
+      }
+      if (command_result == Error)
+         result = Error;
+   }
+   return result;
+}
+
+//-------------------------------------------------------------------------
+typ_return GenericObject::Dispatch_Commands (double time)
+//-------------------------------------------------------------------------
+{
+   typ_return                 result = Nominal;
+   typ_return                 command_result;
+   CommandQueue::typ_Command  *command;
+
+// Apply the commands posted by the other threads since the last dispatching phase
+   result = Drain_Posted_Commands ();
+   if (!Command_Queue)
+      return result;
+
+// Execute in time order all the commands whose dispatching time has elapsed
+   while ((command = Command_Queue->Top ()) && command->elapsed_time <= time)
+   {
+      command = Command_Queue->Pop ();
+      Log_Message ("Dispatch_Commands : dispatching command \"%s\" scheduled at %.3f s", command->text, command->elapsed_time);
+      command_result = Dispatch_Command (command);
+      if (command->ticket)
+         command->ticket->Complete (command_result);
+      if (command_result == Error)
+         result = Error;
+      CommandQueue::Delete (command);
+   }
+   return result;
+}
+
+//-------------------------------------------------------------------------
+typ_return GenericObject::Dispatch_Command (CommandQueue::typ_Command *command)
+//-------------------------------------------------------------------------
+{
+   typ_return        result = Error;
+   GenericObject     *model;
+
+   if (!command->model_name)
+   {
+      if (command->handler == CommandQueue::Not_Compiled && Compile_Command (command, NULL) == Error)
+         ;
+      else
+         Static_Command (result, command->schema->id, command->n_parameters, command->args);   // Static command execution
+      if (result == Nominal)
+         Log_Message ("Static_Local_Parser : successfully processed command \"%s\" with \"%i\" parameter-tokens", command->command_name, command->n_parameters);
+      else
+         Log_Warning ("Static_Local_Parser : FAILED processing command \"%s\" with \"%i\" parameter-tokens", command->command_name, command->n_parameters);
+   }
+   else if (!strlen(command->model_name))
+      Log_Warning ("Execute_Command : the Model Name is empty");
+   else if (!strlen(command->command_name))
+      Log_Warning ("Execute_Command : the Model Command is empty (i.e. Model Command not provided)");
+   else
+   {
+// Model object identification (by name, case sensitive), unless already resolved when queued
+      model = command->pTarget ? command->pTarget : Get_Object_by_Name (command->model_name);
+
+// Specific Model command execution (checks and messages to be implemented at Specific Model level)
+      if (model)
+      {
+         if (command->handler == CommandQueue::Not_Compiled && Compile_Command (command, model) == Error)
+            ;
+         else switch (command->handler)
+         {
+            case CommandQueue::Generic_Handler:
+               if (model->Generic_Command_Applies (command->schema->id))
+                  model->Generic_Command (result, command->schema->id, command->n_parameters, command->args);
+               else // e.g. "RT_" command of a Model not (or no more) Remote Terminal
+                  model->Local_Parser (result, command->command_name, command->n_parameters, command->parameters);
+               break;
+            case CommandQueue::Class_Handler:
+               model->Local_Command (result, command->schema->id, command->n_parameters, command->args);
+               break;
+            default:
+               model->Local_Parser (result, command->command_name, command->n_parameters, command->parameters);
+               break;
+         }
+         if (result == Nominal)
+            Log_Message ("%s.Model_Local_Parser : successfully processed command \"%s\" with \"%i\" parameter-tokens", model->Get_Name(), command->command_name, command->n_parameters);
+         else
+            Log_Warning ("%s.Model_Local_Parser : FAILED processing command \"%s\" with \"%i\" parameter-tokens", model->Get_Name(), command->command_name, command->n_parameters);
+      }
+      else
+         Log_Warning ("Execute_Command : There is no registered Object-Model matching the Name \"%s\"", command->model_name);
+   }
+   return result;
+}
+
+//-------------------------------------------------------------------------
+typ_return GenericObject::Compile_Command (CommandQueue::typ_Command *command, GenericObject *model)
+//-------------------------------------------------------------------------
+{
+   const CommandTable   *table;
+
+   command->handler = CommandQueue::Not_Compiled;
+   command->schema  = NULL;
+
+   if (!command->model_name)
+   {
+// Static command
+      command->schema = Static_Commands.Find (command->command_name);
+      if (!command->schema)
+      {
+         Log_Warning ("Static command \"%s\" is not a declared static command", command->command_name);
+         return Error;
+      }
+      command->handler = CommandQueue::Static_Handler;
+   }
+   else if (!strlen(command->model_name) || !strlen(command->command_name))
+      return Nominal; // Reported when dispatched
+   else if ((command->schema = Generic_Commands.Find (command->command_name)) && (!model || model->Generic_Command_Applies (command->schema->id)))
+      command->handler = CommandQueue::Generic_Handler;
+   else if (!model)
+      return Nominal; // Model not registered yet, the command will be identified when dispatched
+   else if ((table = model->Get_Command_Table ()) && (command->schema = table->Find (command->command_name)))
+      command->handler = CommandQueue::Class_Handler;
+   else
    {
-      Log_Error ("Execute_Command : Unable to allocate memory for the command string \"%s\" working copy", command_string);
-      return result;
+      command->handler = CommandQueue::Text_Parser; // Not declared: it is passed as text to the Model Local_Parser
+      command->schema  = NULL;
+      return Nominal;
    }
-   memset (working_copy, '\0', length);
-   strcpy (working_copy, command_string);
 
-   // Check if the Command String has a ModelName (has '.' character) or it is static
-   if( strchr(working_copy, '.') ){
-      // Parse the Model Command String. The command format shall be: ModelName.CommandName,param1,parm2,....
-      model_name    = strtok (working_copy, "."); // Get the first token i.e. the Model Name
-      model_command = strtok (NULL,         ","); // Get the Model specific command string
-   }
-   else{
-      // Parse the Static Command String. The command format shall be: CommandName,param1,parm2,....
-      model_name    = NULL;
-      model_command = strtok (working_copy, ","); // Get the specific command string
+// Convert and validate the Text-Parameters as per the command schema
+   if (command->args)
+      delete [] command->args;
+   command->args = new CommandTable::typ_CommandArg [command->n_parameters+1];
+   if (!command->args)
+   {
+      Log_Error ("Compile_Command : Unable to allocate memory for the \"%s\" command arguments", command->text);
+      command->handler = CommandQueue::Not_Compiled;
+      return Error;
    }
-   n_parameters  = 0;
-   parameters[0] = strtok (NULL,         ","); // Get the first parameter text-string
-   while (parameters[n_parameters] && n_parameters < MAX_COMMAND_PARAMETERS_NUMBER)
+   if (CommandTable::Convert (command->schema, command->n_parameters, command->parameters, command->args) == Error)
    {
-      n_parameters++;
-      parameters[n_parameters] = strtok (NULL, ","); // Get the next parameter text-string
+      command->handler = CommandQueue::Not_Compiled;
+      return Error;
    }
+   return Nominal;
+}
 
-   if (!model_name){
-      Static_Local_Parser(result, model_command, n_parameters, parameters);   // Static command execution
-      if (result == Nominal)
-         Log_Message ("Static_Local_Parser : successfully processed command \"%s\" with \"%i\" parameter-tokens", model_command, n_parameters);
-      else
-         Log_Warning ("Static_Local_Parser : FAILED processing command \"%s\" with \"%i\" parameter-tokens", model_command, n_parameters);
-   }
-   else if (!strlen(model_name))
-      Log_Warning ("Execute_Command : the Model Name is empty");
-   else if (!model_command)
-      Log_Warning ("Execute_Command : the Model Command pointer is NULL (i.e. Model Command not provided)");
-   else if (!strlen(model_command))
-      Log_Warning ("Execute_Command : the Model Command is empty (i.e. Model Command not provided)");
-   else
-   {
-// Model object identification (by name, case sensitive)
-      model = Get_Object_by_Name (model_name);
+//-------------------------------------------------------------------------
+typ_return GenericObject::Load_Command_Stack ()
+//-------------------------------------------------------------------------
+{
+   typ_return  result = Nominal;
+   char        *token, *c;
+   int         i, n_Commands, old_error;
+   double      elapsed_time;
 
-// Specific Model command execution (checks and messages to be implemented at Specific Model level)
-      if (model)
+   if (!input_file)
+      return Error;
+   Command_Stack_Loaded = true;
+
+   input_file->DisableLineTokenizer(); // Disable the instruction lines tokenization, i.e. acquire each input line as a single token
+   n_Commands = input_file->GetRowsNumber ("MODEL_COMMAND_STACK", 1);
+   if (n_Commands > 0)
+   {
+      old_error = input_file->error;
+      if (input_file->readSymbol ("MODEL_COMMAND_STACK", n_Commands) == Nominal && old_error == input_file->error)
       {
-         model->Model_Local_Parser (result, model_command, n_parameters, parameters);
-         if (result == Nominal)
-            Log_Message ("%s.Model_Local_Parser : successfully processed command \"%s\" with \"%i\" parameter-tokens", model->Get_Name(), model_command, n_parameters);
-         else
-            Log_Warning ("%s.Model_Local_Parser : FAILED processing command \"%s\" with \"%i\" parameter-tokens", model->Get_Name(), model_command, n_parameters);
+// Each entry is: "time, ModelName.CommandName,param1,parm2,..."
+         for (i = 0; i < n_Commands; i++)
+         {
+            token        = input_file->buffer + i*TOKEN_SIZE;
+            elapsed_time = strtod (token, &c);
+            if (c == token)
+            {
+               Log_Warning ("Load_Command_Stack : \"MODEL_COMMAND_STACK\" entry \"%s\" has no dispatching time, it has been ignored", token);
+               continue;
+            }
+            c += strspn (c, " ,\t");
+            if (Insert_Command (elapsed_time, c) == Error)
+               result = Error;
+         }
+         Log_Message ("Load_Command_Stack : %i time-scheduled commands queued", Command_Queue ? Command_Queue->Size() : 0);
       }
-      else
-         Log_Warning ("Execute_Command : There is no registered Object-Model matching the Name \"%s\"", model_name);
    }
-   free (working_copy);
+   input_file->EnableLineTokenizer(); // Enable (default) the instruction lines tokenization, i.e. acquire several tokens from the same input line
    return result;
 }
 
@@ -1433,10 +2072,11 @@ typ_return GenericObject::Topology_Analyzer ()
 }
 
 //-------------------------------------------------------------------------
-typ_return GenericObject::Registry_Serial_Link_Connection (GenericObject *objA, int chA, GenericObject *objB, int chB)
+typ_return GenericObject::Registry_Serial_Link_Connection (GenericObject *objA, int chA, GenericObject *objB, int chB, bool queued_flag, double latency)
 //-------------------------------------------------------------------------
 {
-   GenericObject  *pObject;
+   GenericObject  *pObject, *side_object[2] = {objA, objB};
+   int            side_channel[2] = {chA, chB}, k;
 
 // Check the first object "objA"
    pObject = Get_First();
@@ -1486,11 +2126,41 @@ typ_return GenericObject::Registry_Serial_Link_Connection (GenericObject *objA,
       return Error;
    }
 
+// Check the link does not connect a channel to itself (two channels of the same object are allowed)
+   if (objA == objB && chA == chB)
+   {
+      Log_Error ("Registry_Serial_Link_Connection : link channel \"%s.serial_link[%i]\" cannot be connected to itself", objA->Get_Name(), chA);
+      return Error;
+   }
+
 // Register the connection : objA[chA] <--> objB[chB]
+// Check the queued link latency
+   if (queued_flag && latency < 0.0)
+   {
+      Log_Error ("Registry_Serial_Link_Connection : negative latency %g s for the queued link \"%s.serial_link[%i] <---> %s.serial_link[%i]\"", latency, objA->Get_Name(), chA, objB->Get_Name(), chB);
+      return Error;
+   }
+
    objA->serial_link[chA].p_Other  = objB;
    objA->serial_link[chA].ch_Other = chB;
    objB->serial_link[chB].p_Other  = objA;
    objB->serial_link[chB].ch_Other = chA;
+
+// Queued link: each side gets the ring of the records sent by the other side
+   if (queued_flag)
+   {
+      for (k = 0; k < 2; k++)
+      {
+         typ_serial_link_channel &link = side_object[k]->serial_link[side_channel[k]];
+         link.inbound    = new SerialLinkQueue ();
+         link.reply      = new char[SERIAL_LINK_MAX_PAYLOAD];
+         link.latency    = latency;
+         link.reply_kind = 0;
+         side_object[k]->serial_queued_flag = true;
+      }
+      Log_Message ("Registry_Serial_Link_Connection : Digital Serial Link connection \"%s.serial_link[%i] <---> %s.serial_link[%i]\" successfully established, queued with %g s latency", objA->Get_Name(), chA, objB->Get_Name(), chB, latency);
+      return Nominal;
+   }
    Log_Message ("Registry_Serial_Link_Connection : Digital Serial Link connection \"%s.serial_link[%i] <---> %s.serial_link[%i]\" successfully established", objA->Get_Name(), chA, objB->Get_Name(), chB);
    return Nominal;
 }
@@ -1510,12 +2180,17 @@ typ_return GenericObject::Log_Write (const char *format, ...)
       User_Message (msg, "Write");           // Dispatch the "msg" message to the User
    if (Log_File)
    {
-      fprintf (Log_File, "%s", msg);         // Write the "msg" message on the Log_File
-      fflush (Log_File);                     // Flush the Log File to keep it in case of SW crash
+      if (Log_Backend)
+         Log_Backend->Push (LogBackend::Raw, Current_Epoch, msg); // Queue the "msg" message to the Log File writer thread
+      else
+      {
+         fprintf (Log_File, "%s", msg);         // Write the "msg" message on the Log_File
+         fflush (Log_File);                  // Flush the Log File to keep it in case of SW crash
+      }
    }
    else // In case the Log_File is not accessible trace the error
    {
-      N_Errors++;
+      __atomic_add_fetch (&N_Errors, 1, __ATOMIC_RELAXED);
       result = Error;
    }
    return result;
@@ -1536,12 +2211,17 @@ typ_return GenericObject::Log_Message (const char *format, ...)
       User_Message (msg, "Message");         // Dispatch the "msg" message to the User
    if (Log_File)
    {
-      fprintf (Log_File, "% 12.3f            : %s\n", Current_Epoch, msg); // Trace the EPOCH and the "msg" message in the Log File
-      fflush (Log_File);                     // Flush the Log File to keep it in case of SW crash
+      if (Log_Backend)
+         Log_Backend->Push (LogBackend::Message, Current_Epoch, msg); // Queue the "msg" message to the Log File writer thread
+      else
+      {
+         fprintf (Log_File, "% 12.3f            : %s\n", Current_Epoch, msg); // Trace the EPOCH and the "msg" message in the Log File
+         fflush (Log_File);                  // Flush the Log File to keep it in case of SW crash
+      }
    }
    else // In case the Log_File is not accessible trace the error
    {
-      N_Errors++;
+      __atomic_add_fetch (&N_Errors, 1, __ATOMIC_RELAXED);
       result = Error;
    }
    return result;
@@ -1562,13 +2242,18 @@ typ_return GenericObject::Log_Warning (const char *format, ...)
       User_Message (msg, "Warning");         // Dispatch the "msg" message to the User
    if (Log_File)
    {
-      fprintf  (Log_File, "% 12.3f >> WARNING : %s\n", Current_Epoch, msg); // Trace EPOCH & WARNING "msg" message in the Log File
-      fflush (Log_File);                     // Flush the Log File to keep it in case of SW crash
-      N_Warnings++;
+      if (Log_Backend)
+         Log_Backend->Push (LogBackend::Warning, Current_Epoch, msg); // Queue the "msg" message to the Log File writer thread
+      else
+      {
+         fprintf  (Log_File, "% 12.3f >> WARNING : %s\n", Current_Epoch, msg); // Trace EPOCH & WARNING "msg" message in the Log File
+         fflush (Log_File);                  // Flush the Log File to keep it in case of SW crash
+      }
+      __atomic_add_fetch (&N_Warnings, 1, __ATOMIC_RELAXED);
    }
    else // In case the Log_File is not accessible trace the error
    {
-      N_Errors++;
+      __atomic_add_fetch (&N_Errors, 1, __ATOMIC_RELAXED);
       result = Error;
    }
    return result;
@@ -1589,30 +2274,99 @@ typ_return GenericObject::Log_Error (const char *format, ...)
       User_Message (msg, "Error");           // Dispatch the "msg" message to the User
    if (Log_File)
    {
-      fprintf  (Log_File, "% 12.3f >> ERROR :   %s\n", Current_Epoch, msg); // Trace EPOCH & ERROR "msg" message in the Log File
-      fflush (Log_File);                     // Flush the Log File to keep it in case of SW crash
-      N_Errors++;
+      if (Log_Backend)
+         Log_Backend->Push (LogBackend::Error, Current_Epoch, msg); // Queue the "msg" message to the Log File writer thread
+      else
+      {
+         fprintf  (Log_File, "% 12.3f >> ERROR :   %s\n", Current_Epoch, msg); // Trace EPOCH & ERROR "msg" message in the Log File
+         fflush (Log_File);                  // Flush the Log File to keep it in case of SW crash
+      }
+      __atomic_add_fetch (&N_Errors, 1, __ATOMIC_RELAXED);
    }
    else // In case the Log_File is not accessible trace the error
    {
-      N_Errors++;
+      __atomic_add_fetch (&N_Errors, 1, __ATOMIC_RELAXED);
       result = Error;
    }
    return result;
 }
 
 //-------------------------------------------------------------------------
-void GenericObject::Log_Debug (const char *format, ...)
+typ_return GenericObject::Log_Limited (typ_log_site &site, bool error, const char *format, ...)
 //-------------------------------------------------------------------------
 {
    va_list        arguments;
    char           msg[1024];
+   unsigned long  occurrences, suppressed;
+   double         last_logged;
+   int            length;
+
+// The site counters are updated atomically, the call site can be reached by the Models initialized concurrently
+   occurrences = __atomic_add_fetch (&site.occurrences, 1, __ATOMIC_RELAXED);
+   __atomic_load (&site.last_logged, &last_logged, __ATOMIC_RELAXED);
+
+// After the first messages, count only the messages issued before the summary interval is elapsed (or the time is restarted)
+   if (occurrences > GENERIC_OBJECT_LOG_SITE_BURST
+    && Current_Epoch >= last_logged && Current_Epoch - last_logged < GENERIC_OBJECT_LOG_SITE_INTERVAL)
+   {
+      __atomic_add_fetch (&site.suppressed, 1, __ATOMIC_RELAXED);
+      if (!Log_File)
+      {
+         __atomic_add_fetch (&N_Errors, 1, __ATOMIC_RELAXED);
+         return Error;
+      }
+      __atomic_add_fetch (error ? &N_Errors : &N_Warnings, 1, __ATOMIC_RELAXED);
+      return Nominal;
+   }
+   __atomic_store (&site.last_logged, &Current_Epoch, __ATOMIC_RELAXED);
+   suppressed = __atomic_exchange_n (&site.suppressed, 0, __ATOMIC_RELAXED);
 
    va_start (arguments, format);             // Initialize the parameters list handler
-   vsprintf (msg, format, arguments);        // Write the provided text on the "msg" text string
+   length = vsnprintf (msg, sizeof(msg), format, arguments); // Write the provided text on the "msg" text string
    va_end (arguments);                       // Terminate the parameters list handler
+   if (length < 0 || length >= (int)sizeof(msg))
+      length = strlen (msg);
+   if (suppressed)
+      snprintf (msg+length, sizeof(msg)-length, " [%lu similar messages suppressed]", suppressed);
+   else if (occurrences == GENERIC_OBJECT_LOG_SITE_BURST)
+      snprintf (msg+length, sizeof(msg)-length, " [further similar messages summarized every %g s]", GENERIC_OBJECT_LOG_SITE_INTERVAL);
+   return error ? Log_Error ("%s", msg) : Log_Warning ("%s", msg);
+}
+
+//-------------------------------------------------------------------------
+typ_return GenericObject::Log_Set_Async (bool enable, LogBackend::typ_flush_policy flush_policy, double flush_period)
+//-------------------------------------------------------------------------
+{
+// Stop the current backend (if any), writing the queued messages
+   _Deallocate (Log_Backend);
+   if (!enable)
+      return Nominal;
+
+   if (!Log_File)
+      return Error;
+   Log_Backend = new LogBackend (Log_File, flush_policy, flush_period);
+   if (!Log_Backend || !Log_Backend->Is_Running ())
+   {
+      _Deallocate (Log_Backend);
+      Log_Warning ("GenericObject::Log_Set_Async : the Log File writer thread cannot be started, the messages are written synchronously");
+      return Error;
+   }
+   Log_Message ("GenericObject::Log_Set_Async : asynchronous Log File writing enabled (flush policy %i, period %.3f s)", flush_policy, flush_period);
+   return Nominal;
+}
+
+//-------------------------------------------------------------------------
+void GenericObject::Log_Debug (const char *format, ...)
+//-------------------------------------------------------------------------
+{
+   va_list        arguments;
+   char           msg[1024];
+
    if (Debug_File)
    {
+      va_start (arguments, format);          // Initialize the parameters list handler
+      vsprintf (msg, format, arguments);     // Write the provided text on the "msg" text string
+      va_end (arguments);                    // Terminate the parameters list handler
       if (User_Message)
          User_Message (msg, "Debug");        // Dispatch the "msg" message to the User
       fprintf  (Debug_File, "% 12.3f            : %s\n", Current_Epoch, msg); // Trace the EPOCH and the "msg" message in the Debug File
@@ -1761,6 +2515,9 @@ typ_return GenericObject::Serial_CreateLinks (const int N_links)
 typ_return GenericObject::Serial_TransmitData (const int channel, const int DataWordCount, unsigned short *pDataWords)
 //-------------------------------------------------------------------------
 {
+   typ_return     result;
+   double         handler_time = 0.0;
+
 // Check the Digital Serial Link channel is in the range of the allocate ones
    if (channel < 0 || N_serial_links <= channel)
    {
@@ -1775,14 +2532,28 @@ typ_return GenericObject::Serial_TransmitData (const int channel, const int Data
       return Error;
    }
 
-// Execute the slave Partner-Object virtual method "Serial_ProcessData" for Processing the unsolicited data receive by "this" master via digital Serial Link
-   return serial_link[channel].p_Other->Serial_ProcessData (serial_link[channel].ch_Other, DataWordCount, pDataWords);
+// Queued link: time-tag the data into the Partner-Object ring, they are processed when the Partner-Object acquires its inputs
+   if (serial_link[channel].inbound)
+      result = Serial_Queue (channel, SerialLinkQueue::Data_Words, DataWordCount, pDataWords, DataWordCount*sizeof(unsigned short));
+
+   else
+   {
+   // Execute the slave Partner-Object virtual method "Serial_ProcessData" for Processing the unsolicited data receive by "this" master via digital Serial Link
+      handler_time = Stats_Clock ();
+      result       = serial_link[channel].p_Other->Serial_ProcessData (serial_link[channel].ch_Other, DataWordCount, pDataWords);
+      handler_time = Stats_Clock () - handler_time;
+   }
+   Serial_Count (channel, true, DataWordCount, result, handler_time);
+   return result;
 }
 
 //-------------------------------------------------------------------------
 typ_return GenericObject::Serial_TransmitData (const int channel, const int DataByteCount, char *pDataBytes)
 //-------------------------------------------------------------------------
 {
+   typ_return     result;
+   double         handler_time = 0.0;
+
 // Check the Digital Serial Link channel is in the range of the allocate ones
    if (channel < 0 || N_serial_links <= channel)
    {
@@ -1797,14 +2568,28 @@ typ_return GenericObject::Serial_TransmitData (const int channel, const int Data
       return Error;
    }
 
-// Execute the slave Partner-Object virtual method "Serial_ProcessData" for Processing the unsolicited data receive by "this" master via digital Serial Link
-   return serial_link[channel].p_Other->Serial_ProcessData (serial_link[channel].ch_Other, DataByteCount, pDataBytes);
+// Queued link: time-tag the data into the Partner-Object ring, they are processed when the Partner-Object acquires its inputs
+   if (serial_link[channel].inbound)
+      result = Serial_Queue (channel, SerialLinkQueue::Data_Bytes, DataByteCount, pDataBytes, DataByteCount);
+
+   else
+   {
+   // Execute the slave Partner-Object virtual method "Serial_ProcessData" for Processing the unsolicited data receive by "this" master via digital Serial Link
+      handler_time = Stats_Clock ();
+      result       = serial_link[channel].p_Other->Serial_ProcessData (serial_link[channel].ch_Other, DataByteCount, pDataBytes);
+      handler_time = Stats_Clock () - handler_time;
+   }
+   Serial_Count (channel, true, DataByteCount, result, handler_time);
+   return result;
 }
 
 //-------------------------------------------------------------------------
 typ_return GenericObject::Serial_ReceiveData (const int channel, const int DataWordCount, unsigned short *pDataWords)
 //-------------------------------------------------------------------------
 {
+   typ_return     result;
+   double         handler_time = 0.0;
+
 // Check the Digital Serial Link channel is in the range of the allocate ones
    if (channel < 0 || N_serial_links <= channel)
    {
@@ -1819,14 +2604,28 @@ typ_return GenericObject::Serial_ReceiveData (const int channel, const int DataW
       return Error;
    }
 
-// Execute the slave Partner-Object virtual method "Serial_ProduceData" for Generating the solicited data requested by "this" master via digital Serial Link
-   return serial_link[channel].p_Other->Serial_ProduceData (serial_link[channel].ch_Other, DataWordCount, pDataWords);
+// Queued link: queue the request and return the answer to a previous one
+   if (serial_link[channel].inbound)
+      result = Serial_Request (channel, SerialLinkQueue::Request_Words, DataWordCount, pDataWords, sizeof(unsigned short));
+
+   else
+   {
+   // Execute the slave Partner-Object virtual method "Serial_ProduceData" for Generating the solicited data requested by "this" master via digital Serial Link
+      handler_time = Stats_Clock ();
+      result       = serial_link[channel].p_Other->Serial_ProduceData (serial_link[channel].ch_Other, DataWordCount, pDataWords);
+      handler_time = Stats_Clock () - handler_time;
+   }
+   Serial_Count (channel, false, DataWordCount, result, handler_time);
+   return result;
 }
 
 //-------------------------------------------------------------------------
 typ_return GenericObject::Serial_ReceiveData (const int channel, const int DataByteCount, char *pDataBytes)
 //-------------------------------------------------------------------------
 {
+   typ_return     result;
+   double         handler_time = 0.0;
+
 // Check the Digital Serial Link channel is in the range of the allocate ones
    if (channel < 0 || N_serial_links <= channel)
    {
@@ -1841,15 +2640,217 @@ typ_return GenericObject::Serial_ReceiveData (const int channel, const int DataB
       return Error;
    }
 
-// Execute the slave Partner-Object virtual method "Serial_ProduceData" for Generating the solicited data requested by "this" master via digital Serial Link
-   return serial_link[channel].p_Other->Serial_ProduceData (serial_link[channel].ch_Other, DataByteCount, pDataBytes);
+// Queued link: queue the request and return the answer to a previous one
+   if (serial_link[channel].inbound)
+      result = Serial_Request (channel, SerialLinkQueue::Request_Bytes, DataByteCount, pDataBytes, 1);
+
+   else
+   {
+   // Execute the slave Partner-Object virtual method "Serial_ProduceData" for Generating the solicited data requested by "this" master via digital Serial Link
+      handler_time = Stats_Clock ();
+      result       = serial_link[channel].p_Other->Serial_ProduceData (serial_link[channel].ch_Other, DataByteCount, pDataBytes);
+      handler_time = Stats_Clock () - handler_time;
+   }
+   Serial_Count (channel, false, DataByteCount, result, handler_time);
+   return result;
+}
+
+//-------------------------------------------------------------------------
+typ_return GenericObject::Serial_Queue (const int channel, SerialLinkQueue::typ_kind kind, const int count, const void *payload, unsigned int payload_size)
+//-------------------------------------------------------------------------
+{
+   typ_serial_link_channel    *link = &serial_link[channel];
+
+   if (count >= 0 && link->p_Other->serial_link[link->ch_Other].inbound->Push (Model_Epoch + link->latency, kind, count, payload, payload_size))
+      return Nominal;
+   DSS_ERROR ("Serial_Queue : record not queued on \"%s.serial_link[%i]\", %s", Get_Name(), channel, (count < 0 || payload_size > SERIAL_LINK_MAX_PAYLOAD) ? "wrong data size" : "Partner-Object ring full");
+   return Error;
+}
+
+//-------------------------------------------------------------------------
+typ_return GenericObject::Serial_Request (const int channel, SerialLinkQueue::typ_kind request_kind, const int count, void *data, unsigned int unit_size)
+//-------------------------------------------------------------------------
+{
+   typ_serial_link_channel    *link = &serial_link[channel];
+   int                        reply_kind = (request_kind == SerialLinkQueue::Request_Words) ? SerialLinkQueue::Reply_Words : SerialLinkQueue::Reply_Bytes;
+
+   if (count < 0 || count*unit_size > SERIAL_LINK_MAX_PAYLOAD)
+   {
+      DSS_ERROR ("Serial_Request : wrong data size %i on \"%s.serial_link[%i]\"", count, Get_Name(), channel);
+      return Error;
+   }
+   if (Serial_Queue (channel, request_kind, count, NULL, 0) == Error)
+      return Error;
+
+// Take the answer to the previous request, if already delivered
+   if (link->reply_kind != reply_kind)
+      return Error;
+   memcpy (data, link->reply, ((count < link->reply_count) ? count : link->reply_count) * unit_size);
+   link->reply_kind = 0;
+   return Nominal;
+}
+
+//-------------------------------------------------------------------------
+void GenericObject::Serial_Drain_Links (double time)
+//-------------------------------------------------------------------------
+{
+   SerialLinkQueue::typ_Record   *record;
+   typ_serial_link_channel       *link;
+   unsigned short                answer[SERIAL_LINK_MAX_PAYLOAD / sizeof(unsigned short)];
+   void                          *payload;
+   double                        start_time;
+   int                           channel;
+
+   for (channel = 0; channel < N_serial_links; channel++)
+   {
+      link = &serial_link[channel];
+      if (!link->inbound)
+         continue;
+      while ((record = link->inbound->Front ()) && record->time <= time + SERIAL_LINK_TIME_TOLERANCE)
+      {
+         start_time = Stats_Clock ();
+         payload    = SerialLinkQueue::Payload (record);
+         switch (record->kind)
+         {
+            case SerialLinkQueue::Data_Words:
+               Serial_ProcessData (channel, (int) record->count, (unsigned short*) payload);
+               break;
+            case SerialLinkQueue::Data_Bytes:
+               Serial_ProcessData (channel, (int) record->count, (char*) payload);
+               break;
+            case SerialLinkQueue::Request_Words:
+               memset (answer, '\0', record->count * sizeof(unsigned short));
+               Serial_ProduceData (channel, (int) record->count, answer);
+               Serial_Queue (channel, SerialLinkQueue::Reply_Words, record->count, answer, record->count * sizeof(unsigned short));
+               break;
+            case SerialLinkQueue::Request_Bytes:
+               memset (answer, '\0', record->count);
+               Serial_ProduceData (channel, (int) record->count, (char*) answer);
+               Serial_Queue (channel, SerialLinkQueue::Reply_Bytes, record->count, answer, record->count);
+               break;
+            default: // Solicited data, kept until taken by "Serial_ReceiveData"
+               link->reply_kind  = record->kind;
+               link->reply_count = record->count;
+               memcpy (link->reply, payload, record->count * ((record->kind == SerialLinkQueue::Reply_Words) ? sizeof(unsigned short) : 1));
+               break;
+         }
+         link->inbound->Pop ();
+         link->handler_time += Stats_Clock () - start_time;
+      }
+   }
+}
+
+//-------------------------------------------------------------------------
+void GenericObject::Dump_Bus_Stats (bool reset_flag)
+//-------------------------------------------------------------------------
+{
+   typ_stats_rank             *rank;
+   GenericObject              *model;
+   typ_bus1553_stats          *stats;
+   typ_serial_link_channel    *link;
+   char                       channel_name[2][STD_SHORT_STRING_SIZE+32], field[8];
+   unsigned long              messages, words, errors;
+   int                        i, n, dir, sa;
+
+// BUS 1553 RT Objects, the most expensive endpoints first
+   rank = new typ_stats_rank[Number_Of_Objects+1];
+   for (n = 0, model = pFirst_Object; model; model = model->pNext_Object)
+      if (model->Rt1553_RemoteTerminalAddress)
+      {
+         rank[n].model        = model;
+         rank[n].handler_time = 0.0;
+         for (dir = 0; dir < 2; dir++)
+            for (sa = 0; sa < 32; sa++)
+               rank[n].handler_time += model->Bus1553_Stats.handler_time[dir][sa];
+         n++;
+      }
+   qsort (rank, n, sizeof(typ_stats_rank), Compare_Stats_Rank);
+
+   Log_Write ("\n   BUS 1553 traffic statistics at %.3f s (RT Objects sorted by handler time)\n", Current_Epoch);
+   Log_Write ("   %-24s  RT  DIR  SA    messages       words  errors  handler [ms]  mean [us]\n", "Model");
+   for (i = 0; i < n; i++)
+   {
+      model    = rank[i].model;
+      stats    = &model->Bus1553_Stats;
+      messages = words = errors = 0;
+      for (dir = 0; dir < 2; dir++)
+         for (sa = 0; sa < 32; sa++)
+         {
+            messages += stats->messages[dir][sa];
+            words    += stats->words[dir][sa];
+            errors   += stats->errors[dir][sa];
+         }
+      Log_Write ("   %-24s  %2d  all      %10lu  %10lu  %6lu  %12.3f  %9.3f\n", model->Name, model->Rt1553_RemoteTerminalAddress,
+                 messages, words, errors, 1.0e3*rank[i].handler_time, messages ? 1.0e6*rank[i].handler_time/messages : 0.0);
+      for (dir = 0; dir < 2; dir++)
+         for (sa = 0; sa < 32; sa++)
+            if (stats->messages[dir][sa])
+            {
+               if (sa == B1553_MODE_FIELD_CODE)   strcpy (field, "MC  ");
+               else                               sprintf (field, "SA%2d", sa);
+               Log_Write ("   %-24s  %2d  %s  %s  %10u  %10u  %6u  %12.3f  %9.3f\n", "", model->Rt1553_RemoteTerminalAddress,
+                          dir ? "TX" : "RX", field, stats->messages[dir][sa], stats->words[dir][sa],
+                          stats->errors[dir][sa], 1.0e3*stats->handler_time[dir][sa], 1.0e6*stats->handler_time[dir][sa]/stats->messages[dir][sa]);
+            }
+   }
+   delete [] rank;
+
+// Serial Link channels
+   Log_Write ("\n   Serial Link traffic statistics at %.3f s\n", Current_Epoch);
+   Log_Write ("   %-32s  %-32s  tx messages     tx data  rx messages     rx data  errors  handler [ms]\n", "Channel", "Partner");
+   for (model = pFirst_Object; model; model = model->pNext_Object)
+      for (i = 0; i < model->N_serial_links; i++)
+      {
+         link = &model->serial_link[i];
+         if (!link->p_Other)
+            continue;
+         sprintf (channel_name[0], "%s.serial_link[%d]", model->Name, i);
+         sprintf (channel_name[1], "%s.serial_link[%d]", link->p_Other->Name, link->ch_Other);
+         Log_Write ("   %-32s  %-32s  %11u  %10u  %11u  %10u  %6u  %12.3f\n", channel_name[0], channel_name[1],
+                    link->tx_messages, link->tx_data, link->rx_messages, link->rx_data, link->errors, 1.0e3*link->handler_time);
+      }
+   Log_Write ("\n");
+
+   if (!reset_flag)
+      return;
+   for (model = pFirst_Object; model; model = model->pNext_Object)
+   {
+      memset (&model->Bus1553_Stats, '\0', sizeof(typ_bus1553_stats));
+      for (i = 0; i < model->N_serial_links; i++)
+      {
+         link = &model->serial_link[i];
+         link->tx_messages = link->tx_data = link->rx_messages = link->rx_data = link->errors = 0;
+         link->handler_time = 0.0;
+      }
+   }
+}
+
+//-------------------------------------------------------------------------
+void GenericObject::Serial_Count (const int channel, bool transmit_flag, const int count, typ_return result, double handler_time)
+//-------------------------------------------------------------------------
+{
+   typ_serial_link_channel    *link = &serial_link[channel];
+
+   if (result == Error)
+      link->errors++;
+   else if (transmit_flag)
+   {
+      link->tx_messages++;
+      link->tx_data += count;
+   }
+   else
+   {
+      link->rx_messages++;
+      link->rx_data += count;
+   }
+   link->handler_time += handler_time;
 }
 
 //-------------------------------------------------------------------------
 typ_return GenericObject::Set_Rt1553_Address (int Rt1553_Address, bool allow_shared_Rt1553_Address_flag)
 //-------------------------------------------------------------------------
 {
-   GenericObject  *model;
+   GenericObject  *model, **link;
 
    if (Rt1553_Address < 1 || 31 < Rt1553_Address)
    {
@@ -1857,22 +2858,29 @@ typ_return GenericObject::Set_Rt1553_Address (int Rt1553_Address, bool allow_sha
        return Error;
    }
 
-   model = Get_First();
-   while (model) // Iterate on all the registered Objects
+   Lock_Registry (); // The RT addresses may be reserved by Models initialized concurrently
+   for (model = Rt1553_Table[Rt1553_Address]; model; model = model->pNext_Rt1553) // Iterate on the Objects sharing the address
    {
-      if (Rt1553_Address == model->Rt1553_RemoteTerminalAddress)
+      if (model == this)
+         continue;
+      if (allow_shared_Rt1553_Address_flag)
+         Log_Warning ("%s.Set_Rt1553_Address : The Bus 1553 Remote Terminal Address \"%d\" has been already assigned to \"%s\"", Name, Rt1553_Address, model->Name);
+      else
       {
-         if (allow_shared_Rt1553_Address_flag)
-            Log_Warning ("%s.Set_Rt1553_Address : The Bus 1553 Remote Terminal Address \"%d\" has been already assigned to \"%s\"", Name, Rt1553_Address, model->Name);
-         else
-         {
-            Log_Error ("%s.Set_Rt1553_Address : The Bus 1553 Remote Terminal Address \"%d\" has been already reserved by \"%s\"", Name, Rt1553_Address, model->Name);
-            return Error;
-         }
+         Log_Error ("%s.Set_Rt1553_Address : The Bus 1553 Remote Terminal Address \"%d\" has been already reserved by \"%s\"", Name, Rt1553_Address, model->Name);
+         Unlock_Registry ();
+         return Error;
       }
-      model = model->Get_Next();
    }
 
+// Move the Object into the dispatch table chain of the new address, sorted by Id as the Objects list (the first one serves the transactions)
+   Unlink_Rt1553 ();
+   for (link = &Rt1553_Table[Rt1553_Address]; *link && (*link)->Id < Id; link = &(*link)->pNext_Rt1553)
+      ;
+   pNext_Rt1553 = *link;
+   *link        = this;
+   Unlock_Registry ();
+
    Rt1553_RemoteTerminalAddress = (unsigned char)Rt1553_Address;
    memset (TxModifier, '\0', 32*sizeof(typ_Rt1553_word));
    memset (RxModifier, '\0', 32*sizeof(typ_Rt1553_word));
@@ -1881,6 +2889,47 @@ typ_return GenericObject::Set_Rt1553_Address (int Rt1553_Address, bool allow_sha
    return Nominal;
 }
 
+//-------------------------------------------------------------------------
+void GenericObject::Initialize_Registry_Mutex ()
+//-------------------------------------------------------------------------
+{
+   pthread_mutexattr_t  attributes;
+
+// Recursive: "Set_Rt1553_Address" unlinks the Object from its previous address with the mutex locked
+   pthread_mutexattr_init (&attributes);
+   pthread_mutexattr_settype (&attributes, PTHREAD_MUTEX_RECURSIVE);
+   pthread_mutex_init (&Registry_Mutex, &attributes);
+   pthread_mutexattr_destroy (&attributes);
+}
+
+//-------------------------------------------------------------------------
+void GenericObject::Lock_Registry ()
+//-------------------------------------------------------------------------
+{
+   pthread_once (&Registry_Once, Initialize_Registry_Mutex);
+   pthread_mutex_lock (&Registry_Mutex);
+}
+
+//-------------------------------------------------------------------------
+void GenericObject::Unlink_Rt1553 ()
+//-------------------------------------------------------------------------
+{
+   GenericObject  **link;
+
+   if (!Rt1553_RemoteTerminalAddress)
+      return;
+   Lock_Registry ();
+   for (link = &Rt1553_Table[Rt1553_RemoteTerminalAddress]; *link; link = &(*link)->pNext_Rt1553)
+      if (*link == this)
+      {
+         *link = pNext_Rt1553;
+         break;
+      }
+   Unlock_Registry ();
+   pNext_Rt1553                 = NULL;
+   Rt1553_RemoteTerminalAddress = 0;
+}
+
 //-------------------------------------------------------------------------
 typ_return GenericObject::Modify_Rt1553_Buffer (typ_Rt1553_word *Rt1553_word, unsigned short pDataWords[32])
 //-------------------------------------------------------------------------
@@ -1899,26 +2948,48 @@ typ_return GenericObject::Modify_Rt1553_Buffer (typ_Rt1553_word *Rt1553_word, un
 typ_return GenericObject::Bc1553_ReceiveData (int Rt1553_Address, const unsigned char Subaddress, const unsigned char DataWordCount, unsigned short pDataWords[32])
 //-------------------------------------------------------------------------
 {
+   GenericObject  *model;
+   typ_return     result;
+   double         start_time;
+   int            address;
+   unsigned short words[32];
+
+   if (Rt1553_Address < 1 || 31 < Rt1553_Address)
+      return Nominal;
+
    /******************************************************************************
-   * Loop on all objects dispatching the 1553 RX request
+   * Broadcast: dispatch the 1553 RX request to all the registered RT's, each one
+   * receiving its own copy of the data words (the RX-modifier forcing of an RT
+   * shall not be seen by the following ones)
    * ***************************************************************************/
-   GenericObject  *model = GenericObject::Get_First ();
-   while ( model ) // Iterate on all the registered Objects
-   {
-      if( model->Rt1553_RemoteTerminalAddress == Rt1553_Address){
-         // Perform Rt1553_ReceiveData request
-         model->Rt1553_ReceiveData (Subaddress, DataWordCount, pDataWords);
-        // LOG request on dump file
-        if( Log_1553_File != NULL ){
-           fprintf(Log_1553_File,"%s.ReceiveData %d,%d\t\t", model->Get_Name(), Rt1553_Address, Subaddress);
-           for(int i=0; i<DataWordCount; i++)
-              fprintf(Log_1553_File,"%04X\t", pDataWords[i]);
-           fprintf(Log_1553_File,"\n");
-        }
-        // Request served
-        break;
-      }
-      model = model->Get_Next();
+   if (Rt1553_Address == B1553_BROADCAST_ADDRES)
+   {
+      for (address = 1; address <= 31; address++)
+         for (model = Rt1553_Table[address]; model; model = model->pNext_Rt1553)
+         {
+            memcpy (words, pDataWords, sizeof(words));
+            start_time = Stats_Clock ();
+            result     = model->Rt1553_ReceiveData (Subaddress, DataWordCount, words);
+            model->Bus1553_Count (DSS_RX, Subaddress, DataWordCount, result, Stats_Clock () - start_time);
+            if( Bus_Recorder.Accept (Rt1553_Address, Subaddress) )
+               Bus_Recorder.Record (Current_Epoch, model, model->Name, Bus1553Recorder::Receive_Data, Rt1553_Address, Subaddress, 0, DataWordCount, result, words);
+         }
+      return Nominal;
+   }
+
+   /******************************************************************************
+   * Dispatch the 1553 RX request to the first RT having the address
+   * ***************************************************************************/
+   model = Rt1553_Table[Rt1553_Address];
+   if ( model )
+   {
+      // Perform Rt1553_ReceiveData request
+      start_time = Stats_Clock ();
+      result     = model->Rt1553_ReceiveData (Subaddress, DataWordCount, pDataWords);
+      model->Bus1553_Count (DSS_RX, Subaddress, DataWordCount, result, Stats_Clock () - start_time);
+      // Record the transaction
+      if( Bus_Recorder.Accept (Rt1553_Address, Subaddress) )
+         Bus_Recorder.Record (Current_Epoch, model, model->Name, Bus1553Recorder::Receive_Data, Rt1553_Address, Subaddress, 0, DataWordCount, result, pDataWords);
    }
    return Nominal;
 }
@@ -1927,26 +2998,27 @@ typ_return GenericObject::Bc1553_ReceiveData (int Rt1553_Address, const unsigned
 typ_return GenericObject::Bc1553_TransmitData (int Rt1553_Address, const unsigned char Subaddress, const unsigned char DataWordCount, unsigned short pDataWords[32])
 //-------------------------------------------------------------------------
 {
+   GenericObject  *model;
+   typ_return     result;
+   double         start_time;
+
+   if (Rt1553_Address < 1 || 31 < Rt1553_Address)
+      return Nominal;
+
    /******************************************************************************
-   * Loop on all objects dispatching the 1553 TX request
+   * Dispatch the 1553 TX request to the first RT having the address
+   * (a broadcast RT-to-BC transaction is not allowed, only an RT registered with address 31 can answer)
    * ***************************************************************************/
-   GenericObject  *model = GenericObject::Get_First ();
-   while ( model ) // Iterate on all the registered Objects
-   {
-      if( model->Rt1553_RemoteTerminalAddress == Rt1553_Address){
-         // Perform Rt1553_ReceiveData request
-         model->Rt1553_TransmitData (Subaddress, DataWordCount, pDataWords);
-         // LOG request on dump file
-         if( Log_1553_File != NULL ){
-           fprintf(Log_1553_File,"%s.TransmitData %d,%d\t\t", model->Get_Name(), Rt1553_Address, Subaddress);
-           for(int i=0; i<DataWordCount; i++)
-              fprintf(Log_1553_File,"%04X\t", pDataWords[i]);
-           fprintf(Log_1553_File,"\n");
-         }
-         // Request served
-         break;
-      }
-      model = model->Get_Next();
+   model = Rt1553_Table[Rt1553_Address];
+   if ( model )
+   {
+      // Perform Rt1553_TransmitData request
+      start_time = Stats_Clock ();
+      result     = model->Rt1553_TransmitData (Subaddress, DataWordCount, pDataWords);
+      model->Bus1553_Count (DSS_TX, Subaddress, DataWordCount, result, Stats_Clock () - start_time);
+      // Record the transaction
+      if( Bus_Recorder.Accept (Rt1553_Address, Subaddress) )
+         Bus_Recorder.Record (Current_Epoch, model, model->Name, Bus1553Recorder::Transmit_Data, Rt1553_Address, Subaddress, 0, DataWordCount, result, pDataWords);
    }
    return Nominal;
 }
@@ -1955,18 +3027,35 @@ typ_return GenericObject::Bc1553_TransmitData (int Rt1553_Address, const unsigne
 typ_return GenericObject::Bc1553_ReceiveModeCommand (int Rt1553_Address, const typ_B1553_TxRx TxRx, const typ_B1553_ModeCode ModeCode, unsigned short pDataWord[32])
 //-------------------------------------------------------------------------
 {
+   GenericObject  *model;
+   typ_return     result;
+   double         start_time;
+   int            address, last_address;
+
+   if (Rt1553_Address < 1 || 31 < Rt1553_Address)
+      return Nominal;
+
    /******************************************************************************
-   * Loop on all objects dispatching the 1553 ModeCommand request
+   * Dispatch the 1553 ModeCommand request to all the RT's having the address (all the RT's if broadcast)
    * ***************************************************************************/
-   GenericObject  *model = GenericObject::Get_First ();
-   while ( model ) // Iterate on all the registered Objects
+   if (Rt1553_Address == B1553_BROADCAST_ADDRES)
    {
-      if( model->Rt1553_RemoteTerminalAddress == Rt1553_Address){
+      address      = 1;
+      last_address = 31;
+   }
+   else
+      address = last_address = Rt1553_Address;
+   for (; address <= last_address; address++)
+      for (model = Rt1553_Table[address]; model; model = model->pNext_Rt1553)
+      {
          // Perform Rt1553_ReceiveModeCommand request
-         model->Rt1553_ReceiveModeCommand (TxRx, ModeCode, pDataWord);
+         start_time = Stats_Clock ();
+         result     = model->Rt1553_ReceiveModeCommand (TxRx, ModeCode, pDataWord);
+         model->Bus1553_Count (TxRx, B1553_MODE_FIELD_CODE, (ModeCode >= 16) ? 1 : 0, result, Stats_Clock () - start_time);
+         // Record the transaction (the mode codes from 16 on have a data word)
+         if( Bus_Recorder.Accept (Rt1553_Address, B1553_MODE_FIELD_CODE) )
+            Bus_Recorder.Record (Current_Epoch, model, model->Name, Bus1553Recorder::Mode_Command, Rt1553_Address, ModeCode, TxRx, (ModeCode >= 16) ? 1 : 0, result, pDataWord);
       }
-      model = model->Get_Next();
-   }
    return Nominal;
 }
 
@@ -2259,9 +3348,9 @@ typ_return GenericObject::Publish_Generic_Object (void)
 {
    typ_return  result = Nominal;
    int         i;
-   char        pub_name[32];
+   char        pub_name[GENERIC_OBJECT_PUB_NAME_SIZE];
 
-   memset (pub_name, '\0', 32);
+   memset (pub_name, '\0', sizeof(pub_name));
 
 // ----- Static Model parameters, published only on Id == 1 occurrence
 
@@ -2278,25 +3367,25 @@ typ_return GenericObject::Publish_Generic_Object (void)
    {
       for (i = 0; i < nu; i++)
       {
-         sprintf (pub_name, "GO.pU_Forced_%d_actual_value", i);
+         snprintf (pub_name, sizeof(pub_name), "GO.pU_Forced_%d_actual_value", i);
          result &= Publish (pU_Forced[i].actual_value, pub_name, "");
-         sprintf (pub_name, "GO.pU_Forced_%d_forced_value", i);
+         snprintf (pub_name, sizeof(pub_name), "GO.pU_Forced_%d_forced_value", i);
          result &= Publish (pU_Forced[i].forced_value, pub_name, "");
-         sprintf (pub_name, "GO.pU_Forced_%d_forced_flag", i);
+         snprintf (pub_name, sizeof(pub_name), "GO.pU_Forced_%d_forced_flag", i);
          result &= Publish (pU_Forced[i].forced_flag,  pub_name, "");
-       }
+      }
    }
    if (pY_Forced)
    {
-     for (i = 0; i < ny; i++)
+      for (i = 0; i < ny; i++)
       {
-         sprintf (pub_name, "GO.pY_Forced_%d_actual_value", i);
+         snprintf (pub_name, sizeof(pub_name), "GO.pY_Forced_%d_actual_value", i);
          result &= Publish (pY_Forced[i].actual_value, pub_name, "");
-         sprintf (pub_name, "GO.pY_Forced_%d_forced_value", i);
+         snprintf (pub_name, sizeof(pub_name), "GO.pY_Forced_%d_forced_value", i);
          result &= Publish (pY_Forced[i].forced_value, pub_name, "");
-         sprintf (pub_name, "GO.pY_Forced_%d_forced_flag", i);
+         snprintf (pub_name, sizeof(pub_name), "GO.pY_Forced_%d_forced_flag", i);
          result &= Publish (pY_Forced[i].forced_flag,  pub_name, "");
-       }
+      }
    }
 
 // ----- Power Standard Model parameters
@@ -2313,22 +3402,44 @@ typ_return GenericObject::Publish_Generic_Object (void)
    result &= Publish (Enable_ModeCode_flag,           32,   "GO.Enable_ModeCode_flag",         "");  // HW Model parameter: MIL BUS 1553 Model <b>ModeCode Transaction Enabling</b> array ([MCid])
    for (i = 0; i < 32; i++)
    {
-      sprintf (pub_name, "GO.TxModifier_%d_word_value", i);
+      snprintf (pub_name, sizeof(pub_name), "GO.TxModifier_%d_word_value", i);
       result &= Publish (TxModifier[i].word_value,  32, pub_name,  "");     // HW Model parameter: MIL BUS 1553 Model <b>Forced SubAddres Tx-Transactions</b> data ([SAid])
-      sprintf (pub_name, "GO.TxModifier_%d_forced_flag", i);
+      snprintf (pub_name, sizeof(pub_name), "GO.TxModifier_%d_forced_flag", i);
       result &= Publish (TxModifier[i].forced_flag, 32, pub_name,  "");
       //
-      sprintf (pub_name, "GO.RxModifier_%d_word_value", i);
+      snprintf (pub_name, sizeof(pub_name), "GO.RxModifier_%d_word_value", i);
       result &= Publish (RxModifier[i].word_value,  32, pub_name,  "");     // HW Model parameter: MIL BUS 1553 Model <b>Forced SubAddres Rx-Transactions</b> data ([SAid])
-      sprintf (pub_name, "GO.RxModifier_%d_forced_flag", i);
+      snprintf (pub_name, sizeof(pub_name), "GO.RxModifier_%d_forced_flag", i);
       result &= Publish (RxModifier[i].forced_flag, 32, pub_name,  "");
       //
-      sprintf (pub_name, "GO.McModifier_%d_word_value", i);
+      snprintf (pub_name, sizeof(pub_name), "GO.McModifier_%d_word_value", i);
       result &= Publish (McModifier[i].word_value,  32, pub_name,  "");     // HW Model parameter: MIL BUS 1553 Model <b>Forced SubAddres ModeCode Transactions</b> data ([MCid])
-      sprintf (pub_name, "GO.McModifier_%d_forced_flag", i);
+      snprintf (pub_name, sizeof(pub_name), "GO.McModifier_%d_forced_flag", i);
       result &= Publish (McModifier[i].forced_flag, 32, pub_name,  "");
    }
 
+// ----- BUS 1553 and Serial Links traffic statistics
+
+   result &= Publish (&Bus1553_Stats.messages[0][0],     32*2, "GO.Bus1553_messages",     "");   // Served transactions ([RX/TX][SAid], mode commands at SAid 31)
+   result &= Publish (&Bus1553_Stats.words[0][0],        32*2, "GO.Bus1553_words",        "");   // Transferred data words
+   result &= Publish (&Bus1553_Stats.errors[0][0],       32*2, "GO.Bus1553_errors",       "");   // RT handler Error returns
+   result &= Publish (&Bus1553_Stats.handler_time[0][0], 32*2, "GO.Bus1553_handler_time", "s");  // Time spent in the RT handler
+   for (i = 0; i < N_serial_links; i++)
+   {
+      snprintf (pub_name, sizeof(pub_name), "GO.serial_link_%d_tx_messages", i);
+      result &= Publish (serial_link[i].tx_messages,  pub_name, "");
+      snprintf (pub_name, sizeof(pub_name), "GO.serial_link_%d_tx_data", i);
+      result &= Publish (serial_link[i].tx_data,      pub_name, "");
+      snprintf (pub_name, sizeof(pub_name), "GO.serial_link_%d_rx_messages", i);
+      result &= Publish (serial_link[i].rx_messages,  pub_name, "");
+      snprintf (pub_name, sizeof(pub_name), "GO.serial_link_%d_rx_data", i);
+      result &= Publish (serial_link[i].rx_data,      pub_name, "");
+      snprintf (pub_name, sizeof(pub_name), "GO.serial_link_%d_errors", i);
+      result &= Publish (serial_link[i].errors,       pub_name, "");
+      snprintf (pub_name, sizeof(pub_name), "GO.serial_link_%d_handler_time", i);
+      result &= Publish (serial_link[i].handler_time, pub_name, "s");
+   }
+
 // ----- Object variable for Update_Model scheduling
 
    result &= Publish (LastUpdateExecTime, "GO.LastUpdateExecTime",   "s");  // Time at last Update execution
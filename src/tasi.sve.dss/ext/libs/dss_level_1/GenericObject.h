@@ -70,6 +70,53 @@
    D.Andreetti    13/11/2017  Added pubblic method to publish the Generic Object properties relevant for breakpoints
                               ( As public can be invoked from external classes such as SDVE_Level3Template)
    L.Galvagni     2018/01/20  Added static publig "Publish_All_Flag" boolean flag to allow disabling the automatic data publishing (enable by default)
+   DSS Team       2026/10/19  "MODEL_COMMAND_STACK" commands are pre-parsed at load time into records kept in a time-ordered "CommandQueue"
+                              (binary heap). Removed "typ_CommandData", "pCommandQueueBuffer", "pCurrentCommand" and "pCommandBuffer".
+                              Added "Insert_Command" to queue timed commands at run-time and "Dispatch_Commands" kernel phase,
+                              the commands are no more dispatched inside "Update_Model".
+   DSS Team       2026/10/19  Commands dispatching is table-driven: the generic, the static and the Model class commands are declared
+                              with typed argument schemas in per-class perfect-hash "CommandTable"s. Commands are identified and their
+                              parameters converted and validated once, when queued. Added the virtual "Get_Command_Table" and
+                              "Local_Command" methods; "Local_Parser" is still called for the commands not declared in any table.
+   DSS Team       2026/10/19  Added the thread-safe "Post_Command": commands posted by any thread are pushed into a lock-free
+                              "CommandIngestQueue" and drained in one batch by the sim thread at the beginning of "Dispatch_Commands",
+                              with an optional completion ticket. "Insert_Command" queueing moved to the private "Queue_Command".
+   DSS Team       2026/10/19  User forcing kept by the sparse "ForcingEngine" "pU_Forcing"/"pY_Forcing" lists of the forced items only;
+                              the "pU_Forced"/"pY_Forced" arrays are the published views of the lists, allocated and refreshed only
+                              when the Model attributes are published. Added the time-profiled FORCE_INPUT_PROFILE and
+                              FORCE_OUTPUT_PROFILE commands.
+   DSS Team       2026/10/19  Added the optional asynchronous "LogBackend" ("Log_Set_Async"): the Log_* methods queue the messages
+                              into per-thread lock-free rings written in batches by a background thread, instead of writing and
+                              flushing the Log File on the calling thread.
+   DSS Team       2026/10/19  Added the "DSS_DEBUG" and "DSS_TRACE" debug message front end macros: the message arguments are evaluated
+                              only when the Model Debug File is open and the message level is not below the compile-time
+                              "DSS_DEBUG_MIN_LEVEL".
+   DSS Team       2026/10/19  Added the rate-limited "DSS_WARNING" and "DSS_ERROR" macros: each call site keeps its own "typ_log_site"
+                              counters, logs its first messages and then one summary per interval ("Log_Limited").
+   DSS Team       2026/10/19  Added the "Rt1553_Table" BUS 1553 dispatch table, indexed by RT address, with "pNext_Rt1553" chains for the
+                              shared addresses.
+   DSS Team       2026/10/19  "Log_1553_File" text dump replaced by the binary "Bus1553Recorder" ("Bus_Recorder").
+   DSS Team       2026/10/19  Added "Get_Rt1553" to let a Bus Controller model check whether an RT answers at an address.
+   DSS Team       2026/10/19  Added the optional queued Serial Links ("Registry_Serial_Link_Connection" "queued_flag" and "latency"):
+                              the transactions are time-tagged into the Partner-Object "SerialLinkQueue" lock-free ring and
+                              drained by the Partner-Object itself in "Get_Model_Input" ("Serial_Drain_Links"). The records are time-tagged
+                              with the new per-Object "Model_Epoch".
+   DSS Team       2026/10/19  Added the BUS 1553 ("Bus1553_Stats", per direction and subaddress) and the Serial Link (per channel) traffic
+                              statistics: messages, data, Error returns and time spent in the RT/Partner-Object handlers. They are
+                              published and written into the Log File by the DUMP_BUS_STATS[,RESET] static command ("Dump_Bus_Stats").
+   DSS Team       2026/10/19  The configuration is kept by the shared, immutable "Config_Store" ("ConfigStore"), available after the
+                              initialization too ("Get_Config_Store"); "input_file" is a per-thread reader of it. Added the
+                              "Initialize_All" overload initializing the Models from an already loaded store (e.g. with overlays).
+   DSS Team       2026/10/19  Added the parallel Models initialization ("Set_Initialize_Threads"): "Initialize_All" initializes the
+                              Models on a pool of threads, each one reading the "Config_Store" through its own "input_file", and runs
+                              the first update in topological waves. The BUS 1553 dispatch table and the Commands Queue mutations are
+                              serialized by "Registry_Mutex". Added the "Serial_Initialization_Flag" of the Models to be processed alone.
+                              The concurrent first update is opt-in: only the Models setting the "Concurrent_Update_Flag" take part in it.
+   DSS Team       2026/10/19  Added the live configuration reload ("Reload_Config", RELOAD_CONFIG static command): the changed symbols
+                              of the new configuration are applied to their Models only, through the "Reconfigure" virtual method.
+   DSS Team       2026/10/19  Added the per-Model counter-based "Random_Stream" ("RandomStream"), keyed by the Model name and seeded by
+                              the RANDOM_SEED and <Name>.RANDOM_SEED set file parameters: the Model noise is reproducible whatever
+                              the threads and the Models execution order.
 
 ******************************************************************************/
 
@@ -78,12 +125,42 @@
 #include <string.h>
 #include "GenericTypes.h"
 #include "Input_file.h"
+#include "ConfigStore.h"
+#include "CommandQueue.h"
+#include "CommandIngestQueue.h"
+#include "ForcingEngine.h"
+#include "LogBackend.h"
+#include "Bus1553Recorder.h"
+#include "SerialLinkQueue.h"
+#include "RandomStream.h"
 
 #define  STD_SHORT_STRING_SIZE            63                            //!< Maximum allowed length for the <b>Model Unique Name</b> and short text strings
 #define  MAX_COMMAND_PARAMETERS_NUMBER    512                           //!< Maximum allowed number of parameters in a model <b>Text String Command</b>
 #define  GENERIC_OBJECT_LOG_FILE_NAME     "%sdss_log_%04i%02i%02i_%02i%02i%02i.txt" //!< Standard name for the <b>Messages Log File</b>, shared by all the program models
 #define  GENERIC_OBJECT_LEN_LOG_FILE_NAME  1024                         //!< Maximum allowed length for the <b>LoG File Name</b> text strings (including path)
 
+#define  DSS_LOG_LEVEL_TRACE              0                             //!< <b>Trace</b> debug messages level (e.g. once per integration step)
+#define  DSS_LOG_LEVEL_DEBUG              1                             //!< <b>Debug</b> messages level (e.g. once per Model update)
+#if !defined(DSS_DEBUG_MIN_LEVEL)
+#define  DSS_DEBUG_MIN_LEVEL              DSS_LOG_LEVEL_TRACE           //!< Minimum <b>compiled debug messages level</b>; the lower level messages are removed at compile time (2 removes all)
+#endif
+
+/** Debug message front end, to be used inside the Model methods in place of "Log_Debug": the message arguments are evaluated only when the
+    Model Debug File is open (ENABLE_DEBUG command) and the level is compiled, otherwise the cost is one branch (or nothing) */
+#define  DSS_DEBUG_AT(level, ...)         do {if ((level) >= DSS_DEBUG_MIN_LEVEL && __builtin_expect (Debug_File != NULL, 0)) Log_Debug (__VA_ARGS__);} while (0)
+#define  DSS_DEBUG(...)                   DSS_DEBUG_AT (DSS_LOG_LEVEL_DEBUG, __VA_ARGS__)
+#define  DSS_TRACE(...)                   DSS_DEBUG_AT (DSS_LOG_LEVEL_TRACE, __VA_ARGS__)
+
+#define  GENERIC_OBJECT_LOG_SITE_BURST    10                            //!< Number of messages logged by a <b>rate-limited call site</b> before its messages are summarized
+#define  GENERIC_OBJECT_LOG_SITE_INTERVAL 10.0                          //!< Minimum <b>simulation time interval</b> [s] between two summaries of a rate-limited call site
+#define  GENERIC_OBJECT_PUB_NAME_SIZE     (sizeof("GO.serial_link__handler_time") + 10) //!< Size of the "Publish_Generic_Object" <b>data name</b> buffer: longest name plus a 10-digit index
+
+/** Rate-limited WARNING/ERROR message front end, for the messages that can be repeated at each step or bus transaction: each call site
+    logs its first GENERIC_OBJECT_LOG_SITE_BURST messages, then one message per GENERIC_OBJECT_LOG_SITE_INTERVAL reporting the number of
+    the suppressed ones; the suppressed messages are neither built nor written, but they are still counted as WARNINGS/ERRORS */
+#define  DSS_WARNING(...)                 do {static GenericObject::typ_log_site log_site_ = {0, 0, 0.0}; GenericObject::Log_Limited (log_site_, false, __VA_ARGS__);} while (0)
+#define  DSS_ERROR(...)                   do {static GenericObject::typ_log_site log_site_ = {0, 0, 0.0}; GenericObject::Log_Limited (log_site_, true, __VA_ARGS__);} while (0)
+
 /**
 * ABSTRACT Class definition for the Generic Object model <b>(Level 1)</b>.
 * Specific HW Unit Models <b>(Level 2)</b> have to inherit from this class common methods and data;
@@ -132,6 +209,13 @@ public:
       char              unit[15];   //!< C++ Data units descriptor text string
    };
 
+   struct typ_log_site       /** Counters of a <b>rate-limited message call site</b> (DSS_WARNING and DSS_ERROR macros)*/
+   {
+      unsigned long     occurrences;   //!< Number of the messages issued by the call site
+      unsigned long     suppressed;    //!< Number of the messages suppressed since the last one logged
+      double            last_logged;   //!< <b>Current Epoch</b> [s] of the last logged message
+   };
+
 protected:
 
    struct typ_Rt1553_word    /** Type used to force the value of the BUS-1553 transction words */
@@ -140,21 +224,69 @@ protected:
       unsigned short forced_flag[32]; //!< Flag to say if the Word has to be forced to the provided value
    };
 
-   struct typ_forced_value    /** Type used to force the value of the BUS-1553 transction words */
+   struct typ_forced_value    /** Type used to publish the forcing state of a Model INPUT or OUTPUT item */
    {
       double         actual_value;  //!< Double floating stored actual value
       double         forced_value;  //!< Double floating value to be forced
-      unsigned short forced_flag;   //!< Flag to say if the double floating has to be forced to the provided value
+      unsigned short forced_flag;   //!< Flag to say if the double floating is currently forced to the provided value
    };
 
    struct typ_serial_link_channel   /** Data structure used to implement the Inter-Object digital data serial links */
    {
       GenericObject  *p_Other;   //!< Pointer to the <b>GenericObject</b> connected to the other side of this Inter-Object digital data serial link (Partner-Object)
       int            ch_Other;   //!< Serial link channel of this connection, as seen by the GenericObject on the other side of the link (Partner-Channel)
+      SerialLinkQueue *inbound;  //!< Queued link only: ring of the records sent by the Partner-Object, drained by this GenericObject (NULL if the link is direct)
+      double         latency;    //!< Queued link only: <b>transmission latency</b> [s] added to the time tag of the records sent on this channel
+      int            reply_kind; //!< Queued link only: type of the last delivered solicited data (SerialLinkQueue::typ_kind, 0 if none)
+      int            reply_count;//!< Queued link only: number of the last delivered solicited data words or bytes
+      char           *reply;     //!< Queued link only: last delivered solicited data, taken by "Serial_ReceiveData"
+      unsigned int   tx_messages;//!< Statistics: number of the unsolicited data transmissions ("Serial_TransmitData") not returning Error
+      unsigned int   tx_data;    //!< Statistics: number of the transmitted data words or bytes
+      unsigned int   rx_messages;//!< Statistics: number of the solicited data receptions ("Serial_ReceiveData") not returning Error
+      unsigned int   rx_data;    //!< Statistics: number of the received data words or bytes
+      unsigned int   errors;     //!< Statistics: number of the transactions returning Error
+      double         handler_time;//!< Statistics: time [s] spent in the Partner-Object handlers (direct link), or in this GenericObject handlers delivering the queued records
+   };
+
+   struct typ_bus1553_stats   /** Data structure used to store the BUS 1553 traffic statistics of an RT Object, per direction ([DSS_RX/DSS_TX]) and subaddress (mode commands at B1553_MODE_FIELD_CODE) */
+   {
+      unsigned int   messages[2][32];     //!< Number of the served transactions
+      unsigned int   words[2][32];        //!< Number of the transferred data words
+      unsigned int   errors[2][32];       //!< Number of the transactions the RT handler returned Error for
+      double         handler_time[2][32]; //!< Time [s] spent in the RT handler
    };
 
 private:
 
+   enum typ_generic_command   /** Identifiers of the <b>generic Model commands</b> and of the <b>static commands</b> declared in the GenericObject commands tables*/
+   {
+      Cmd_Disable_Debug = 1,        //!< DISABLE_DEBUG
+      Cmd_Enable_Debug,             //!< ENABLE_DEBUG
+      Cmd_Force_Input,              //!< FORCE_INPUT,first_index,value1,value2,...
+      Cmd_Force_Output,             //!< FORCE_OUTPUT,first_index,value1,value2,...
+      Cmd_Freeze_Input,             //!< FREEZE_INPUT
+      Cmd_Freeze_Output,            //!< FREEZE_OUTPUT
+      Cmd_Rt_Set_Status,            //!< RT_SET_STATUS,enabling_flag
+      Cmd_Rt_Set_SA_Status,         //!< RT_SET_SA_STATUS,sub_address,T/R,enabling_flag
+      Cmd_Rt_Set_MC_Status,         //!< RT_SET_MC_STATUS,mode_code,enabling_flag
+      Cmd_Rt_Force_SA_Tx_Buffer,    //!< RT_FORCE_SA_TX_BUFFER,sub_address,word1,word2,...
+      Cmd_Rt_Force_SA_Rx_Buffer,    //!< RT_FORCE_SA_RX_BUFFER,sub_address,word1,word2,...
+      Cmd_Rt_Force_MC_Buffer,       //!< RT_FORCE_MC_BUFFER,mode_code,word
+      Cmd_Switch_On,                //!< SWITCH_ON
+      Cmd_Switch_Off,               //!< SWITCH_OFF
+      Cmd_Set_Power_Load,           //!< SET_POWER_LOAD,value
+      Cmd_Set_Value,                //!< SET_VALUE,data_name,value
+      Cmd_Set_Components,           //!< SET_COMPONENTS,data_name,first_index,value1,value2,...
+      Cmd_Unforce_Input,            //!< UNFORCE_INPUT
+      Cmd_Unforce_Output,           //!< UNFORCE_OUTPUT
+      Cmd_Force_Input_Profile,      //!< FORCE_INPUT_PROFILE,index,profile,param1,param2,...
+      Cmd_Force_Output_Profile,     //!< FORCE_OUTPUT_PROFILE,index,profile,param1,param2,...
+      Cmd_Enable_1553_Log,          //!< ENABLE_1553_LOG[,rt_mask[,sa_mask]] (static command)
+      Cmd_Disable_1553_Log,         //!< DISABLE_1553_LOG (static command)
+      Cmd_Dump_Bus_Stats,           //!< DUMP_BUS_STATS[,RESET] (static command)
+      Cmd_Reload_Config             //!< RELOAD_CONFIG,file (static command)
+   };
+
    struct typ_objects_link    /** Data structure type to store the output-to-input inter Objects link information*/
    {
       GenericObject  *pObject;   //!< Pointer to the <b>source-Object</b> generating the output linked to an input of this one (target-Object)
@@ -162,10 +294,13 @@ private:
       bool           delay_flag; //!< Flag to say if data acquired on this link can be one propagation cycle old (used to open topological loops)
    };
 
-   struct typ_CommandData  /** Data structure type to store the data for the <b>time-scheduled Objects commands</b> */
+   struct typ_initialization_batch  /** Data structure of a batch of Models processed by the <b>initialization threads</b> ("Initialize_All")*/
    {
-      double            elapsed_time;        //!< Command dispatching <b>Time from Simulation Beginning</b> [s]
-      char              *pCommand_String;    //!< Pointer to the <b>Command String</b> (separated by <b>NEW LINE</b>) to be dispatched
+      GenericObject  **model;       //!< Models of the batch
+      int            n_models;      //!< Number of the Models of the batch
+      volatile int   next_model;    //!< Index of the next Model to be processed, atomically incremented by the threads
+      bool           update_flag;   //!< Batch phase: Models initialization (false) or first update (true)
+      volatile int   n_errors;      //!< Number of the Models returning Error, no more Models are processed afterwards
    };
 
 /*-------------------------------------------------------------------------
@@ -192,8 +327,10 @@ protected:
    double                    *pY;                              //!<  Object parameter: <b>Pointer to the model OUTPUT double-array Y</b> (instance dependent)
    double                     time_at_last_update;             //!<  Object parameter: <b>Time at last model updating [s] since Simulation Beginning</b> (instance dependent)
    double                     delta_time_at_last_update;       //!<  Object parameter: <b>Time increment at last model updating [s]</b> (instance dependent)
-   typ_forced_value           *pU_Forced;                      //!<  Object parameter: <b>User-forced INPUT U</b> information array
-   typ_forced_value           *pY_Forced;                      //!<  Object parameter: <b>User-forced OUTPUT Y</b> information array
+   ForcingEngine::typ_Forcing *pU_Forcing;                     //!<  Object parameter: <b>User-forced INPUT U</b> items list (NULL if nothing is forced)
+   ForcingEngine::typ_Forcing *pY_Forcing;                     //!<  Object parameter: <b>User-forced OUTPUT Y</b> items list (NULL if nothing is forced)
+   typ_forced_value           *pU_Forced;                      //!<  Object parameter: <b>User-forced INPUT U</b> published view of "pU_Forcing", refreshed for the forced items only (NULL if not published)
+   typ_forced_value           *pY_Forced;                      //!<  Object parameter: <b>User-forced OUTPUT Y</b> published view of "pY_Forcing", refreshed for the forced items only (NULL if not published)
 
 // ----- Power Standard Model parameters
 
@@ -213,19 +350,32 @@ protected:
 
 // ----- Models initialization and input data logging stream
 
-   static InputFile*          input_file;                      //!<  Models Setup file, <b>used for initialization</b> (shared by all Object instances)
+   static __thread InputFile* input_file;                      //!<  Models Setup file reader, <b>used for initialization</b> (one per thread, shared by all Object instances)
           FILE*               Debug_File;                      //!<  Models Debug file, <b>used for debug data logging</b> (instance dependent)
+          bool                Serial_Initialization_Flag;      //!<  Flag to say the Model shall be initialized and first updated <b>alone</b>, not concurrently with the other Models, e.g. a Bus Controller (instance dependent)
+          bool                Concurrent_Update_Flag;          //!<  Flag set by the Model to declare its first update <b>safe to run concurrently</b> with the other Models of its wave, i.e. it touches its own data only [default false] (instance dependent)
+          RandomStream        Random_Stream;                   //!<  Model <b>random numbers stream</b>, keyed by the Model name and seeded by RANDOM_SEED (<Name>.RANDOM_SEED if provided) at initialization (instance dependent)
 
 private:
 
    static FILE*               Log_File;                        //!<  Models Log file, <b>used for message logging</b> (shared by all Object instances)
-   static FILE*               Log_1553_File;                   //!<  1553 Log file, <b>used for 1553 bus</b> (shared by all Object instances)
    static unsigned long       N_Warnings;                      //!<  Number of program logged <b>WARNING Messages</b> (shared by all Object instances)
    static unsigned long       N_Errors;                        //!<  Number of program logged <b> ERROR  Messages</b> (shared by all Object instances)
+   static LogBackend*         Log_Backend;                     //!<  Asynchronous <b>Log File writer</b>, NULL when the messages are written synchronously (shared by all Object instances)
    static double              Current_Epoch;                   //!<  <b>Time at last overall updating</b> [s] since Simulation Beginning (shared by all Object instances)
-   static typ_CommandData*    pCommandQueueBuffer;             //!<  Pointer to the RAM Buffer to allocate the Commad Descriptors queue
-   static typ_CommandData*    pCurrentCommand;                 //!<  Pointer to the current Command Descriptor
-   static char*               pCommandBuffer;                  //!<  Pointer to the RAM Buffer to allocate the Commads text strings
+   static ConfigStore*        Config_Store;                    //!<  <b>Configuration Store</b> the Models have been initialized from, kept after the initialization (shared by all Object instances)
+   static CommandQueue*       Command_Queue;                   //!<  Time-ordered queue of the <b>pre-parsed time-scheduled commands</b> (shared by all Object instances)
+   static bool                Command_Stack_Loaded;            //!<  Flag to keep memory the <b>"MODEL_COMMAND_STACK" has been already loaded</b> (shared by all Object instances)
+   static int                 Initialize_Threads;              //!<  Number of the <b>threads initializing the Models</b>, 1 for the serial initialization (shared by all Object instances)
+   static pthread_mutex_t     Registry_Mutex;                  //!<  Recursive mutex serializing the <b>registries mutations</b> of the parallel initialization: BUS 1553 dispatch table and Commands Queue (shared by all Object instances)
+   static pthread_once_t      Registry_Once;                   //!<  Once-only initialization of "Registry_Mutex" (shared by all Object instances)
+   static const CommandTable::typ_CommandSchema Generic_Command_Schemas[]; //!<  Schemas of the <b>generic Model commands</b>, available for all the Models
+   static const CommandTable::typ_CommandSchema Static_Command_Schemas[];  //!<  Schemas of the <b>static commands</b>, not linked to a specific Model
+   static const CommandTable  Generic_Commands;                //!<  Perfect-hash table of the <b>generic Model commands</b>
+   static const CommandTable  Static_Commands;                 //!<  Perfect-hash table of the <b>static commands</b>
+   static CommandIngestQueue  Posted_Commands;                 //!<  Lock-free queue of the <b>commands posted by any thread</b>, drained by "Dispatch_Commands" (shared by all Object instances)
+   static ForcingEngine       Forcing_Engine;                  //!<  Sparse list of the <b>User-forced INPUT and OUTPUT items</b> (shared by all Object instances)
+   static Bus1553Recorder     Bus_Recorder;                    //!<  Binary <b>BUS 1553 traffic recorder</b>, enabled by ENABLE_1553_LOG (shared by all Object instances)
 
 // ----- Object variable for Update_Model scheduling
           double              LastUpdateExecTime;              //!<  Time at last Update execution
@@ -238,6 +388,8 @@ private:
    static GenericObject       *pLast_Object;                   //!<  Objects list link: <b>pointer to the last object registered in the list</b> (shared by all Object instances)
           GenericObject       *pNext_Object;                   //!<  Objects list link: <b>pointer to the next object registered in the list</b> (instance dependent)
           GenericObject       *pPrevious_Object;               //!<  Objects list link: <b>pointer to the previous object registered in the list</b> (instance dependent)
+   static GenericObject       *Rt1553_Table[32];               //!<  BUS 1553 dispatch table: <b>first object registered with each RT address</b> ([RT address], shared by all Object instances)
+          GenericObject       *pNext_Rt1553;                   //!<  BUS 1553 dispatch table link: <b>pointer to the next object sharing the RT address</b> (instance dependent)
           unsigned long       Id;                              //!<  Object unique numerical identifier, it is initialized as per the instanciation order and then re-ordered by the topolgy analyzer based on the execution priority (instance dependent)
           typ_objects_link    *pY2U;                           //!<  <b>output-to-input connection pointer</b> to implement inter-object links (instance dependent)
           typ_processing_mode processing_mode;                 //!<  Object property to identify when the Model has to be processed in the frame of a single Dynamics Propagation step
@@ -253,6 +405,9 @@ private:
 
    int                        N_serial_links;                  //!<  Number of digital data Serial Links
    typ_serial_link_channel    *serial_link;                    //!<  Digital data Serial Links array
+   bool                       serial_queued_flag;              //!<  Flag to say at least one Serial Link channel is queued
+   typ_bus1553_stats          Bus1553_Stats;                   //!<  BUS 1553 traffic statistics of this RT Object
+   double                     Model_Epoch;                     //!<  <b>Time at last updating of this Object</b> [s], time tag of the queued Serial Link records (the shared "Current_Epoch" is not, when the Objects run on different threads)
 
 /*-------------------------------------------------------------------------
    Function declarations
@@ -280,6 +435,8 @@ public:
 
 /** Public Generic Method <b> to initialize the Model</b>*/
    void                          Initialize_Model   (typ_return &result /*! Function <b>Return code</b>*/, char* Input_File_Name = NULL /*! Optional Model Initialization <b>Input File Name</b>*/);
+/** Public Generic Method <b> to apply the changed parameters</b> of a reloaded configuration to the Model, read through "input_file" (called by Reload_Config)*/
+   void                          Reconfigure_Model  (typ_return &result /*! Function <b>Return code</b>*/, int n_parameters /*! <b>Number of the changed parameters</b>*/, const char* parameters[] /*! <b>Names of the changed parameters</b>, without the Model name*/);
 /** Public Generic Method <b> to get the Model U INPUT data</b> at given Time*/
    void                          Get_Model_Input    (typ_return &result /*! Function <b>Return code</b>*/, double time /*! <b>Time</b> [s] since Simulation Beginning*/, bool is_the_first_getinput = true /*! Logical flag to identify wether the inputs are acquired for the first time (i.e. also external signals shall be acquired) in a numerical integration step or is an intermediate step */);
 /** Public Generic Method <b> to compute the Dynamic Model Dynamics STATUS derivative Xdot</b> based on the input data U and Time*/
@@ -295,6 +452,8 @@ protected:
 
 /** <b>Virtual</b> Protected Method <b>to initialize the Model</b>. By default is empty, it can be customized at Equipment Model level (Level 2, or higher)*/
    virtual void                  Initialize   (typ_return &result /*! Function <b>Return code</b>*/) {};
+/** <b>Virtual</b> Protected Method <b>to apply the changed parameters</b> of a reloaded configuration, read through "input_file", without re-initializing the Model (STATUS, connections and published data are kept). By default the changes are not applied and a warning is logged, it can be customized at Equipment Model level (Level 2, or higher)*/
+   virtual void                  Reconfigure  (typ_return &result /*! Function <b>Return code</b>*/, int n_parameters /*! <b>Number of the changed parameters</b>*/, const char* parameters[] /*! <b>Names of the changed parameters</b>, without the Model name*/);
 /** <b>Virtual</b> Protected Method <b>to acquire the Model INPUT U </b> at current Time. By default is empty, it can be customized at implementation Environment Level 3. <b>NOTE:</b> it shall only acquire U data, no other action has to be done here not to bypass the FORCE_INPUT feature*/
    virtual void                  Get_Input    (typ_return &result /*! Function <b>Return code</b>*/, double time /*! <b>Time</b> [s] since Simulation Beginning*/, bool is_the_first_getinput = true /*! Logical flag to identify wether the inputs are acquired for the first time (i.e. also external signals shall be acquired) in a numerical integration step or is an intermediate step */) {};
 /** <b>Virtual</b> Protected Method <b>to compute the Model Dynamics STATUS Derivative Xdot</b> based on the current INPUT U and Time. By default is empty, it shall be customized at Equipment Model level (Level 2, or higher) when the STATUS X is not empty*/
@@ -303,6 +462,10 @@ protected:
    virtual void                  Update       (typ_return &result /*! Function <b>Return code</b>*/, double time /*! <b>Time</b> [s] since Simulation Beginning*/, bool is_the_final_updating = true /*! Logical flag to identify wether the updating is for an intermediate numerical integration step or for the final one*/) = 0;
 /** <b>Virtual</b> Protected Method <b>to parse the command strings sent to the model</b> in order to allow performing actions on it (called by Execute_Command). By default is empty, it can be customized at Equipment Model level (Level 2, or higher)*/
    virtual void                  Local_Parser (typ_return &result /*! Function <b>Return code</b>*/, char* model_command /*! <b>Model specific</b> command string*/, int n_parameters /*! <b>Number of Parameters</b> parsed after the Model specific Command string*/, char* parameters[] /*! Array of <b>Pointers to the Text-Parameters</b> parsed after the Model specific Command string*/) {};
+/** <b>Virtual</b> Protected Method <b>to return the Model class Commands Table</b>, declaring the Model specific commands with their arguments schemas. By default there is no table (NULL), it can be customized at Equipment Model level (Level 2, or higher); a derived class can chain the parent class table*/
+   virtual const CommandTable*   Get_Command_Table () {return NULL;};
+/** <b>Virtual</b> Protected Method <b>to execute a Model specific command</b> declared in the Model class Commands Table, whose arguments have been already converted and validated as per its schema. By default is empty, it can be customized at Equipment Model level (Level 2, or higher)*/
+   virtual void                  Local_Command (typ_return &result /*! Function <b>Return code</b>*/, int command_id /*! Class-defined <b>command identifier</b>, as declared in the Commands Table*/, int n_args /*! <b>Number of the typed arguments</b>*/, const CommandTable::typ_CommandArg args[] /*! Array of the <b>typed arguments</b>*/) {};
 
 // ----- VIRTUAL Protected Methods to be customized for the HW Unit Models (Level 2) for implementing the unit answer (slave) to digital data Serial Link transactions requested by a master
 
@@ -341,11 +504,19 @@ public:
    static inline GenericObject*  Get_First ()             {return pFirst_Object;};
 /** Static Public Method to return the pointer to the <b>Last</b> registered Object in the list (shared by all Object instances)*/
    static inline GenericObject*  Get_Last ()              {return pLast_Object;};
+/** Static Public Method to return the <b>Configuration Store</b> the Models have been initialized from, NULL if none (shared by all Object instances). The store can be read at any time and by any thread through an own "InputFile" ("attach")*/
+   static inline ConfigStore*    Get_Config_Store ()      {return Config_Store;};
 
 // ----- STATIC Public Methods to iterate on all the HW Model instances (registered in the Objects List) the specific Model functions
 
 /** Static Public Method to iterate the <b>Initialize_Model()</b> method on all the GenericObject instances in the list, in order to initialize all of them (shared by all Object instances)*/
    static void                   Initialize_All (const char* Input_File_Name /*! Models Initialization <b>Input File Name</b> (if not provided the default is [GenericObject_Input_Log_File.txt])*/, typ_return &result /* Return code */);
+/** Static Public Method to iterate the <b>Initialize_Model()</b> method on all the GenericObject instances in the list, reading the provided <b>Configuration Store</b> (shared by all Object instances)*/
+   static void                   Initialize_All (ConfigStore* config /*! Models Initialization <b>Configuration Store</b>, a reference is kept by "Get_Config_Store"*/, typ_return &result /* Return code */);
+/** Static Public Method to <b>reload the configuration</b> from the provided input file: only the symbols whose value changed with respect to the current "Config_Store" are applied, to their Models ("Reconfigure_Model"); the Models are not re-initialized. The new configuration replaces the current one (shared by all Object instances)*/
+   static typ_return             Reload_Config (const char* Input_File_Name /*! Models Initialization <b>Input File Name</b>*/);
+/** Static Public Method to set the number of the <b>threads initializing the Models</b> in "Initialize_All" (1 by default, serial initialization). The Models are initialized concurrently, each thread reading the configuration through its own "input_file", then the Models having the "Concurrent_Update_Flag" set are first updated in topological waves (same nesting level). The Models having the "Serial_Initialization_Flag" set, the BUS 1553 RT's and the Models having Serial Links or delayed inputs are processed alone (shared by all Object instances)*/
+   static inline void            Set_Initialize_Threads (int n_threads /*! Number of the threads, the calling one included*/) {Initialize_Threads = (n_threads > 1) ? n_threads : 1;};
 /** Static Public Method to iterate the <b>Get_Model_Input(time,is_the_first_getinput)</b> and <b>Model_Status(time)</b> methods on all the GenericObject <b>DYNAMIC</b> instances in the list (the ones having nx > 0), in order to allow propagating all of them (shared by all Object instances)*/
    static void                   Status_All_Dynamic (double time /*! <b>Time</b> [s] since Simulation Beginning*/, bool is_the_first_getinput /*! Logical flag to identify wether the inputs are acquired for the first time (i.e. also external signals shall be acquired) in a numerical integration step or is an intermediate step */, typ_return &result /* Return code */);
 /** Static Public Method to iterate the <b>Get_Model_Input(time,false)</b> and <b>Update_Model(time,is_the_final_updating)</b> method on all the GenericObject <b>DYNAMIC</b> or <b>STATIC between Dynamics</b> instances in the list, in order to update the output for all of them (shared by all Object instances)*/
@@ -370,18 +541,30 @@ public:
 /** Static Public Method to handle a Mode Code transaction on MIL BUS 1553</b>*/
    static typ_return             Bc1553_ReceiveModeCommand (int Rt1553_Address /*! BUS 1553 RT Model Address.*/, const typ_B1553_TxRx TxRx, const typ_B1553_ModeCode ModeCode, unsigned short pDataWord[32]);
 
+/** Static Public Method to write into the Log File the <b>BUS 1553 and Serial Links traffic statistics</b>, the RT Objects sorted by handler time*/
+   static void                   Dump_Bus_Stats (bool reset_flag = false /*! Flag to reset the statistics after writing them*/);
+
+/** Static Public Method to return the first Object registered with the provided <b>BUS 1553 RT address</b> (NULL if no RT answers at that address)*/
+   static inline GenericObject*  Get_Rt1553 (int Rt1553_Address /*! BUS 1553 RT Model Address.*/) {return (1 <= Rt1553_Address && Rt1553_Address <= 31) ? Rt1553_Table[Rt1553_Address] : NULL;};
+
 // ----- STATIC Public Methods to implement generic-model utilities
 
 /** Static Public Method to return the pointer to the registered Object in the list matching the provided <b>unique name</b> (shared by all Object instances). Returns NULL if not found */
    static GenericObject*         Get_Object_by_Name (const char* ObjectName /*! <b>Name</b> of the Object to be returned as a pointer. Returns NULL if not found */);
 /** Static Public Method to send command strings to a Model, identified by its <b>unique name</b>, in order to perform <b>User defined actions on it</b> (shared by all Object instances); the command format shall be: <b>ModelName.CommandName,param1,parm2,__.</b>; after the Model identification the command is dispatched to its Model_Local_Parser*/
    static typ_return             Execute_Command (char* command_string /*! Text String to execute actions at <b>HW Unit Model</b> level; the command format shall be: ModelName.CommandName,param1,parm2,__.*/);
+/** Static Public Method to <b>queue a time-scheduled command</b> at run-time; the command string is parsed once and dispatched by <b>Dispatch_Commands</b> when its time has elapsed (shared by all Object instances)*/
+   static typ_return             Insert_Command (double elapsed_time /*! Command dispatching <b>Time</b> [s] since Simulation Beginning*/, const char* command_string /*! Text String of the command; the command format shall be: ModelName.CommandName,param1,parm2,__.*/);
+/** Static Public Method (<b>thread-safe</b>) to <b>post a command</b> from any thread; the command string is parsed by the calling thread and the command is executed (or scheduled, if a dispatching time is provided) by the simulation thread at the beginning of the next <b>Dispatch_Commands</b>. Returns Error if the command string is empty (nothing is logged by the calling thread)*/
+   static typ_return             Post_Command (const char* command_string /*! Text String of the command; the command format shall be: ModelName.CommandName,param1,parm2,__.*/, double elapsed_time = -1.0 /*! Optional command dispatching <b>Time</b> [s] since Simulation Beginning; if negative the command is executed as soon as drained*/, CommandTicket **ticket = NULL /*! Optional output: <b>completion ticket</b> giving the posting sequence number and the execution return code; it shall be released by the caller*/);
+/** Static Public Method implementing the <b>commands dispatching phase</b> of the kernel: the posted commands are drained first, then all the queued commands having dispatching time not greater than the provided one are executed in time order (shared by all Object instances)*/
+   static typ_return             Dispatch_Commands (double time /*! <b>Time</b> [s] since Simulation Beginning*/);
 /** Static Public Method to set one <b>output-to-input (pY2U) connection pointer</b> in order to feed <b>one Model input with a another Model output</b> (shared by all Object instances)*/
    static typ_return             Registry_Output2Input_Connection (double& source_Y /*output-to-input inter-objects link <b>source data</b>, it shall be a registered model output (Y) array element*/, double& target_U /*output-to-input inter-objects link <b>target data</b>, it shall be a different registered model input (U) array element*/, int n = 1 /* double array size */, bool delay_allowed_flag = false /* flag to allow one propagation cycle delay in order to open the topological loops */);
 /** Static Public Method to analyze the Models topology (it shall be executed <b>once only</b>) in order to identify the processing order based on the set inter-oject links and the Model properties (Static/Dynamic) (shared by all Object instances)*/
    static typ_return             Topology_Analyzer ();
 /** Static Public Method to set one Inter-Object <b>serial digital data link connection</b> (shared by all Object instances)*/
-   static typ_return             Registry_Serial_Link_Connection (GenericObject *objA /*! Pointer to the first model connected to the serial link*/, int chA /*! Serial link channel on the first model side*/, GenericObject *objB /*! Pointer to the second model connected to the serial link*/, int chB /*! Serial link channel on the second model side*/);
+   static typ_return             Registry_Serial_Link_Connection (GenericObject *objA /*! Pointer to the first model connected to the serial link*/, int chA /*! Serial link channel on the first model side*/, GenericObject *objB /*! Pointer to the second model connected to the serial link*/, int chB /*! Serial link channel on the second model side*/, bool queued_flag = false /*! Flag to queue the transactions instead of calling the Partner-Object, so that the two models can run on different threads*/, double latency = 0.0 /*! Queued link <b>transmission latency</b> [s]*/);
 /** Static Public Method to analyze the Models topology (it shall be executed <b>once only after all connections have been established</b>) in order to check that all the model inputs are connected */
    static typ_return             Input_Connections_Checks ();
 
@@ -404,14 +587,18 @@ public:
    static typ_return             Log_Warning (const char *format /*! Message built as per <b>printf</b> C function*/, ...);
 /** Static Public Method to trace in the commonm Log_File an <b>ERROR Text String Message</b>; it also increments the ERRORS counter, the message format is the same used by printf (shared by all Object instances)*/
    static typ_return             Log_Error   (const char *format /*! Message built as per <b>printf</b> C function*/, ...);
+/** Static Public Method to trace in the commonm Log_File a <b>rate-limited WARNING or ERROR Text String Message</b>, to be called through the DSS_WARNING and DSS_ERROR macros*/
+   static typ_return             Log_Limited (typ_log_site &site /*! Counters of the calling site*/, bool error /*! true for an ERROR, false for a WARNING*/, const char *format /*! Message built as per <b>printf</b> C function*/, ...);
 /** Pointer to Static Public Method to manage all messages at <b>User</b> level. The User shall define his own Static Function and assign it to this pointer*/
    static void                  (*User_Message) (const char *message /*! Message dispatched to the User*/ , const char *source /*! Message type identifier*/);
 /** Static Public Method for opening a User Custom Log File*/
-   static typ_return             Log_Open_Custom (char* User_File_Name) {Log_File=fopen(User_File_Name,"wt"); return Log_File ? Nominal : Error;};
+   static typ_return             Log_Open_Custom (char* User_File_Name) {_Deallocate (Log_Backend); Log_File=fopen(User_File_Name,"wt"); return Log_File ? Nominal : Error;};
+/** Static Public Method to enable (or disable) the <b>asynchronous Log File writing</b>: the messages are queued by the logging threads and written in batches by a background thread, as required by the flush policy. Returns Error if the Log File is not open or the writer thread cannot be started*/
+   static typ_return             Log_Set_Async (bool enable /*! true to enable, false to come back to the synchronous writing (the queued messages are written first)*/, LogBackend::typ_flush_policy flush_policy = LogBackend::Flush_Every_Batch /*! <b>Flush policy</b>*/, double flush_period = 0.1 /*! Flush period [s] (Flush_Periodic and Flush_On_Warning policies)*/);
 /** Static Public Method to return the <b>WARNINGS counter status</b> (shared by all Object instances)*/
-   static inline unsigned long   Get_N_Warnings () {return N_Warnings;};
+   static inline unsigned long   Get_N_Warnings () {return __atomic_load_n (&N_Warnings, __ATOMIC_RELAXED);};
 /** Static Public Method to return the <b>ERRORS counter status</b> (shared by all Object instances)*/
-   static inline unsigned long   Get_N_Errors () {return N_Errors;};
+   static inline unsigned long   Get_N_Errors () {return __atomic_load_n (&N_Errors, __ATOMIC_RELAXED);};
 
 // ----- INLINE Public Methods to provide access to the main internal basic data
 
@@ -472,7 +659,7 @@ public:
    typ_return                    Get_Connected_Inputs ();
 /** Public Method to send command strings to the Model, in order to perform <b>User defined actions on it</b>; the model_command format shall be: <b>CommandName,param1,parm2,__.</b>; after appending the model_command to the model name it is dispatched using the STATIC method Execute_Command*/
    typ_return                    Execute_Model_Command (const char* model_command_string /*! Text String to execute actions on <b>the current HW Unit Model</b> level; the model_command format shall be: CommandName,param1,parm2,__.*/);
-/** Public Method to trace in the proprietary Debug_File a <b>Text String Data Message</b> (instance dependent)*/
+/** Public Method to trace in the proprietary Debug_File a <b>Text String Data Message</b> (instance dependent); the hot paths shall use the DSS_DEBUG and DSS_TRACE macros*/
    void                          Log_Debug   (const char *format /*! Message built as per <b>printf</b> C function*/, ...);
 /** Public Method to get the value of the <b>i-th</b> published data descriptor. If "i" exceedes the published data number returns an empty descriptor*/
    typ_DataPublish               Get_DataPublish (unsigned int i);
@@ -493,11 +680,22 @@ protected:
    typ_return                    Serial_ReceiveData (const int channel /*! Serial Link local identifier*/, const int DataWordCount /*! Number of 16-bit data words*/, unsigned short *pDataWords /*! 16-bit data words buffer*/);
 /** Protected Method <b>for Acquiring solicited 8-bit data via digital Serial Link</b> as a master */
    typ_return                    Serial_ReceiveData (const int channel /*! Serial Link local identifier*/, const int DataByteCount /*! Number of 8-bit data words*/, char *pDataBytes /*! 8-bit data bytes buffer*/);
+/** Protected Method <b>for time-tagging a record into the Partner-Object ring</b> of a queued Serial Link channel*/
+   typ_return                    Serial_Queue (const int channel /*! Serial Link local identifier*/, SerialLinkQueue::typ_kind kind /*! Record type*/, const int count /*! Number of the data words or bytes*/, const void *payload /*! Record payload*/, unsigned int payload_size /*! Payload size [bytes]*/);
+/** Protected Method <b>for requesting solicited data</b> on a queued Serial Link channel: the request is queued and the answer to a previous request, if delivered, is returned (Error if none)*/
+   typ_return                    Serial_Request (const int channel /*! Serial Link local identifier*/, SerialLinkQueue::typ_kind request_kind /*! Request record type*/, const int count /*! Number of the data words or bytes*/, void *data /*! Data buffer*/, unsigned int unit_size /*! Size of a data word or byte*/);
+/** Protected Method <b>for delivering the queued Serial Link records</b> whose time tag is elapsed: unsolicited data to "Serial_ProcessData", data requests to "Serial_ProduceData" (the answer is queued back), solicited data kept for "Serial_ReceiveData"*/
+   void                          Serial_Drain_Links (double time /*! <b>Time</b> [s] since Simulation Beginning*/);
+/** Protected Method <b>for updating the traffic statistics</b> of a Serial Link channel*/
+   void                          Serial_Count (const int channel /*! Serial Link local identifier*/, bool transmit_flag /*! Transmission (true) or reception (false)*/, const int count /*! Number of the data words or bytes*/, typ_return result /*! Transaction return code*/, double handler_time /*! Time [s] spent in the handler*/);
 
 // ----- Protected Methods for the BUS 1553 implementation
 
 /** Protected Method to set the BUS 1553 RT Model Address and instanciate the relevant RT Model*/
    typ_return                    Set_Rt1553_Address (int Rt1553_Address /*! BUS 1553 RT Model Address.*/, bool allow_shared_Rt1553_Address_flag = false /*! Flag to allow creating more Objects wit the same TR Address */);
+/** Protected Method <b>for updating the BUS 1553 traffic statistics</b> of this RT Object*/
+   inline void                   Bus1553_Count (int TxRx /*! Transaction direction*/, int Subaddress /*! Subaddress (B1553_MODE_FIELD_CODE for the mode commands)*/, int DataWordCount /*! Number of the data words*/, typ_return result /*! RT handler return code*/, double handler_time /*! Time [s] spent in the RT handler*/)
+      {Bus1553_Stats.messages[TxRx&1][Subaddress&31]++; Bus1553_Stats.words[TxRx&1][Subaddress&31] += DataWordCount; Bus1553_Stats.errors[TxRx&1][Subaddress&31] += (result == Error); Bus1553_Stats.handler_time[TxRx&1][Subaddress&31] += handler_time;};
 /** Protected Method to force part of a BUS 1553 transaction buffer*/
    typ_return                    Modify_Rt1553_Buffer (typ_Rt1553_word *Rt1553_word, unsigned short pDataWords[32]);
 
@@ -516,6 +714,46 @@ private:
 
 /** Static Private Method to check the Models topology consistency in order to detect TOPOLOGY errors like ALGEBRICAL LOOPS */
    static typ_return             Topology_Checks ();
+/** Static Private Method to load from the input file the <b>"MODEL_COMMAND_STACK"</b> time-scheduled commands into the Commands Queue*/
+   static typ_return             Load_Command_Stack ();
+/** Static Private Method to <b>queue a pre-parsed command record</b> into the time-ordered Commands Queue, after its identification and validation. The queue takes the ownership of the record, deleted if rejected*/
+   static typ_return             Queue_Command (CommandQueue::typ_Command *command /*! Pre-parsed command record to be queued*/);
+/** Static Private Method to <b>drain the posted commands</b> in one batch, in posting order: the immediate ones are executed, the others are queued (simulation thread only)*/
+   static typ_return             Drain_Posted_Commands ();
+/** Static Private Method to <b>execute a pre-parsed command record</b> on its target Model (or as static command)*/
+   static typ_return             Dispatch_Command (CommandQueue::typ_Command *command /*! Pre-parsed command record to be executed*/);
+/** Static Private Method to <b>identify a pre-parsed command</b> in the commands tables and convert its parameters into typed arguments. The Model class commands are identified only when the target Model is known, otherwise the command record is left not compiled. Returns Error if the command is invalid*/
+   static typ_return             Compile_Command (CommandQueue::typ_Command *command /*! Pre-parsed command record to be compiled*/, GenericObject *model /*! Pointer to the <b>target Model</b> (NULL if not resolved yet or for static commands)*/);
+/** Private Method saying whether a <b>generic Model command</b> applies to the Model: the "RT_" commands apply to the Remote Terminals only, for the other Models they are passed as text to "Local_Parser"*/
+   inline bool                   Generic_Command_Applies (int command_id /*! <b>Command identifier</b>*/) const {return Rt1553_RemoteTerminalAddress || command_id < Cmd_Rt_Set_Status || command_id > Cmd_Rt_Force_MC_Buffer;};
+/** Private Method to <b>execute a generic Model command</b> declared in the GenericObject commands table*/
+   void                          Generic_Command (typ_return &result /*! Function <b>Return code</b>*/, int command_id /*! <b>Command identifier</b>*/, int n_args /*! <b>Number of the typed arguments</b>*/, const CommandTable::typ_CommandArg args[] /*! Array of the <b>typed arguments</b>*/);
+/** Static Private Method to <b>execute a static command</b> declared in the static commands table*/
+   static void                   Static_Command (typ_return &result /*! Function <b>Return code</b>*/, int command_id /*! <b>Command identifier</b>*/, int n_args /*! <b>Number of the typed arguments</b>*/, const CommandTable::typ_CommandArg args[] /*! Array of the <b>typed arguments</b>*/);
+/** Static Private Method to <b>create the recursive "Registry_Mutex"</b> (once-only, through "Registry_Once")*/
+   static void                   Initialize_Registry_Mutex ();
+/** Static Private Method to <b>lock the "Registry_Mutex"</b>, created at the first call*/
+   static void                   Lock_Registry ();
+/** Static Private Method to <b>unlock the "Registry_Mutex"</b>*/
+   static inline void            Unlock_Registry () {pthread_mutex_unlock (&Registry_Mutex);};
+/** Private Method to <b>remove the Object from the BUS 1553 dispatch table</b> and reset its RT address*/
+   void                          Unlink_Rt1553 ();
+/** Static Private Method to <b>process a batch of Models</b> on "Initialize_Threads" threads, the calling one included: initialization or first update. Returns Error if any Model returned Error*/
+   static typ_return             Run_Initialization_Batch (GenericObject **models /*! Models of the batch*/, int n_models /*! Number of the Models*/, bool update_flag /*! Batch phase: initialization (false) or first update (true)*/);
+/** Static Private Method <b>processing the Models of a batch</b> on the calling thread, until none is left*/
+   static void                   Process_Initialization_Batch (typ_initialization_batch &batch);
+/** Static Private Method, entry point of the <b>initialization threads</b>: "Process_Initialization_Batch" with a configuration reader of the thread*/
+   static void*                  Initialization_Thread (void *batch);
+/** Private Method to <b>first update the Model</b> at the end of the initialization ("Get_Model_Input" and "Update_Model" at the current epoch)*/
+   void                          First_Update (typ_return &result /*! Function <b>Return code</b>*/);
+/** Static Private Method to <b>refresh the published view</b> of the forced items of a Model port (the other items are left as they are)*/
+   static void                   Refresh_Forced_View (const ForcingEngine::typ_Forcing *port /*! Model port list (INPUT or OUTPUT)*/, typ_forced_value *view /*! Published view of the port*/);
+/** Static Private Method to <b>reset the published view</b> of the forced items of a Model port, before their forcings are removed*/
+   static void                   Reset_Forced_View (const ForcingEngine::typ_Forcing *port /*! Model port list (INPUT or OUTPUT)*/, typ_forced_value *view /*! Published view of the port*/);
+/** Private Method returning true if the Model can be initialized and first updated <b>concurrently</b> with the other Models*/
+   bool                          Concurrent_Initialization_Allowed ();
+/** Private Method to <b>seed the Model random stream</b> from the configuration: <Name>.RANDOM_SEED, or RANDOM_SEED, or 0*/
+   void                          Seed_Random_Stream ();
 
 // ----- C++ data publishing methods
 
@@ -25,13 +25,44 @@
                              the "readSymbol" ones. Inside the method "readSymbol" the special branch
                              (Ntokens == 1) is now constrained also to the "enable_tokenizer" flag.
 
+   DSS Team       2026/10/19  The input file is memory-mapped and its symbols are indexed once at "open": the symbol
+                              lookups of "readSymbol" and "GetRowsNumber" no longer re-read the whole file, so the
+                              initialization time is linear in the file size.
+
+   DSS Team       2026/10/19  Optional binary cache ("EnableCache") of the parsed symbols, written at "close" into
+                              "<input file>.cache" and reused while the hash of the input file content matches.
+
+   DSS Team       2026/10/19  "loadTable" parses numeric tables of any size straight from the mapped input file into
+                              the caller array, with a locale-independent real number parser: no TOKEN_SIZE buffer per
+                              value and no preliminary "GetRowsNumber" scan.
+
+   DSS Team       2026/10/19  The text and the symbol index moved into the shared, immutable "ConfigStore": "open" loads
+                              (or shares) the store of the input file, "attach" reads a store already loaded, and the
+                              symbols are looked up in the store layers. The tokenization uses "strtok_r", so that
+                              readers of the same store can be used by different threads.
+
+   DSS Team       2026/10/19  "CacheRead" checks the size of the cache file and every entry read from it (a damaged
+                              cache is discarded); "CacheStore" inserts the new entry in the cache hash table, which
+                              is rebuilt only when more than half full.
+
 ******************************************************************************/
 
 #include <string.h>
+#include <stdlib.h>
+#include <locale.h>
+#include <unistd.h>
+#include <sys/stat.h>
 
 #include "Input_file.h"
+#include "ConfigStore.h"
 #include "GenericObject.h"
 
+#define  CACHE_ALIGN(size)    (((size) + 7) & ~7ULL)                 // Cached data alignment (double arrays)
+
+// Static Data Initialization
+
+bool  InputFile::cache_enabled = false;
+
 //-------------------------------------------------------------------------
 InputFile::InputFile ()
 //-------------------------------------------------------------------------
@@ -43,46 +74,83 @@ InputFile::InputFile ()
 InputFile::~InputFile ()
 //-------------------------------------------------------------------------
 {
-   if (f) close ();
+   if (text) close ();
 }
 
 //-------------------------------------------------------------------------
 typ_return InputFile::open (const char* filename)
 //-------------------------------------------------------------------------
 {
-// Reset buffer memory pointer
-   enable_tokenizer = true;
-   buffer = 0;
-   strcpy (current_input_file_name, (filename ? filename : INPUTFILE_DEFAULT));
+   ConfigStore *config;
+   typ_return  result;
+
+   if (store)
+      close ();
 
 // Write log file header
    GenericObject::Log_Write ("\n================================================================================\n");
-   GenericObject::Log_Write ("Opening file \"%s\" for model initialization reading\n", current_input_file_name);
+   GenericObject::Log_Write ("Opening file \"%s\" for model initialization reading\n", (filename ? filename : INPUTFILE_DEFAULT));
    GenericObject::Log_Write ("================================================================================\n\n");
 
-// Open input file as a stream
-   f = fopen (current_input_file_name, "rb");
-   if (f)
-   {
-      error = 0;
-      GenericObject::Log_Write ("Input file \"%s\" succesfully open\n\n", current_input_file_name);
-   }
+// Load the configuration store of the input file (shared with the other readers of the same file)
+   config = ConfigStore::Load (filename);
+   result = Attach (config);
+   if (config)
+      config->Release (); // The reference is held by "Attach"
    else
-   {
-      error = 1;
-      GenericObject::Log_Error ("Unable to open for reading the input file \"%s\"\n\n", current_input_file_name);
-      *current_input_file_name = '\0';
-   }
-   return (error ? Error : Nominal);
+      GenericObject::Log_Error ("Unable to open for reading the input file \"%s\"\n\n", (filename ? filename : INPUTFILE_DEFAULT));
+   return result;
+}
+
+//-------------------------------------------------------------------------
+typ_return InputFile::attach (ConfigStore* config)
+//-------------------------------------------------------------------------
+{
+   if (store)
+      close ();
+   GenericObject::Log_Write ("\n================================================================================\n");
+   GenericObject::Log_Write ("Reading configuration \"%s\" for model initialization\n", (config ? config->Get_Name () : ""));
+   GenericObject::Log_Write ("================================================================================\n\n");
+   return Attach (config);
+}
+
+//-------------------------------------------------------------------------
+typ_return InputFile::Attach (ConfigStore* config)
+//-------------------------------------------------------------------------
+{
+// Reset buffer memory pointer
+   enable_tokenizer = true;
+   buffer = 0;
+   *current_input_file_name = '\0';
+   error = 1;
+   if (!config)
+      return Error;
+
+// The reading starts on the highest layer of the store
+   config->Acquire ();
+   store     = config;
+   text      = config->Get_Text ();
+   text_size = config->Get_Text_Size ();
+   error     = 0;
+   strcpy (current_input_file_name, config->Get_Name ());
+   if (cache_enabled && !config->Get_Base ()) // The binary cache is kept for single layer stores only
+      CacheRead ();
+   GenericObject::Log_Write ("Input file \"%s\" succesfully open\n\n", current_input_file_name);
+   return Nominal;
 }
 
 //-------------------------------------------------------------------------
 typ_return InputFile::close ()
 //-------------------------------------------------------------------------
 {
-   if (f)
-      fclose (f);
-   f = NULL;
+   if (cache_modified)
+      CacheWrite ();
+   CacheFree ();
+   if (store)
+      store->Release ();
+   store     = NULL;
+   text      = NULL;
+   text_size = 0;
    GenericObject::Log_Write ("\n================================================================================\n");
    if (current_input_file_name)
       GenericObject::Log_Write ("Input file \"%s\" succesfully closed\n", current_input_file_name);
@@ -107,17 +175,22 @@ typ_return InputFile::load (double v[], const char* VarName, int VarSize, bool m
    typ_return  found;
    int         i, old_error = error;
 
-// Read data vector from file
-   found = readSymbol (VarName, VarSize, mustexist);
-   if (found == Nominal && old_error == error) for (i = 0; i < VarSize; i++)
+// Read data vector from the cache, else from file
+   if (!CacheLoad (Cache_Doubles, VarName, v, VarSize, sizeof(double), mustexist, found))
    {
-      c = buffer + TOKEN_SIZE * i;
-      if (strspn (c, REAL_NUMBERS) < strlen (c))
+      found = ReadSymbolText (VarName, VarSize, mustexist);
+      if (found == Nominal && old_error == error) for (i = 0; i < VarSize; i++)
       {
-         GenericObject::Log_Error ("Symbol \"%s\" : illegal character in NUMERIC field \"%s\"", VarName, c);
-         error++;
+         c = buffer + TOKEN_SIZE * i;
+         if (strspn (c, REAL_NUMBERS) < strlen (c))
+         {
+            GenericObject::Log_Error ("Symbol \"%s\" : illegal character in NUMERIC field \"%s\"", VarName, c);
+            error++;
+         }
+         else v[i] = atof (c);
       }
-      else v[i] = atof (c);
+      if (old_error == error)
+         CacheStore (Cache_Doubles, VarName, VarSize, found == Nominal, v, (found == Nominal) ? VarSize * sizeof(double) : 0);
    }
    if (!found && !mustexist)
    {
@@ -152,17 +225,22 @@ typ_return InputFile::load (int v[], const char* VarName, int VarSize, bool must
    typ_return  found;
    int         i, old_error = error;
 
-// Read data vector from file
-   found = readSymbol (VarName, VarSize, mustexist);
-   if (found == Nominal && old_error == error) for (i = 0; i < VarSize; i++)
+// Read data vector from the cache, else from file
+   if (!CacheLoad (Cache_Integers, VarName, v, VarSize, sizeof(int), mustexist, found))
    {
-      c = buffer + TOKEN_SIZE * i;
-      if (strspn (c, REAL_NUMBERS) < strlen (c))
+      found = ReadSymbolText (VarName, VarSize, mustexist);
+      if (found == Nominal && old_error == error) for (i = 0; i < VarSize; i++)
       {
-         GenericObject::Log_Error ("Symbol \"%s\" : illegal character in NUMERIC field \"%s\"", VarName, c);
-         error++;
+         c = buffer + TOKEN_SIZE * i;
+         if (strspn (c, REAL_NUMBERS) < strlen (c))
+         {
+            GenericObject::Log_Error ("Symbol \"%s\" : illegal character in NUMERIC field \"%s\"", VarName, c);
+            error++;
+         }
+         else v[i] = atoi (c);
       }
-      else v[i] = atoi (c);
+      if (old_error == error)
+         CacheStore (Cache_Integers, VarName, VarSize, found == Nominal, v, (found == Nominal) ? VarSize * sizeof(int) : 0);
    }
    if (!found && !mustexist)
    {
@@ -258,109 +336,278 @@ typ_return InputFile::load (char* v[],const char* ModelName,const char* VarName,
    return load (v, name_variable, VarSize, mustexist);
 }
 
+//-------------------------------------------------------------------------
+int InputFile::loadTable (double v[], const char* VarName, int MaxSize, int n_columns, bool mustexist)
+//-------------------------------------------------------------------------
+{
+   return LoadTable (VarName, v, NULL, MaxSize, n_columns, mustexist);
+}
+
+//-------------------------------------------------------------------------
+int InputFile::loadTable (double v[], const char* ModelName, const char* VarName, int MaxSize, int n_columns, bool mustexist)
+//-------------------------------------------------------------------------
+{
+   char  name_variable[LINE_SIZE];
+
+   sprintf (name_variable, "%s.%s", ModelName, VarName);
+   return LoadTable (name_variable, v, NULL, MaxSize, n_columns, mustexist);
+}
+
+//-------------------------------------------------------------------------
+int InputFile::loadTable (int v[], const char* VarName, int MaxSize, int n_columns, bool mustexist)
+//-------------------------------------------------------------------------
+{
+   return LoadTable (VarName, NULL, v, MaxSize, n_columns, mustexist);
+}
+
+//-------------------------------------------------------------------------
+int InputFile::loadTable (int v[], const char* ModelName, const char* VarName, int MaxSize, int n_columns, bool mustexist)
+//-------------------------------------------------------------------------
+{
+   char  name_variable[LINE_SIZE];
+
+   sprintf (name_variable, "%s.%s", ModelName, VarName);
+   return LoadTable (name_variable, NULL, v, MaxSize, n_columns, mustexist);
+}
+
+//-------------------------------------------------------------------------
+int InputFile::LoadTable (const char* Symbol, double* dv, int* iv, int MaxSize, int n_columns, bool mustexist)
+//-------------------------------------------------------------------------
+{
+   typ_cache_kind          kind = dv ? Cache_Table_Doubles : Cache_Table_Integers;
+   unsigned int            item_size = dv ? sizeof(double) : sizeof(int);
+   const typ_cache_entry   *entry = CacheFind (kind, Symbol, MaxSize);
+   const char              *c;
+   unsigned long           length;
+   double                  value;
+   bool                    found, bracket;
+   int                     n = 0, old_error = error;
+
+   if (!text)
+      return 0;
+
+// Table from the cache
+   if (entry && (entry->found || !mustexist))
+   {
+      n = entry->size / item_size;
+      memcpy (dv ? (void*) dv : (void*) iv, cache_data + entry->data, entry->size);
+      if (entry->found)
+         GenericObject::Log_Write ("%s = [ %i values ] (cache)\n", Symbol, n);
+      else
+         GenericObject::Log_Write ("%s (Optional) not found and set to default\n", Symbol);
+      return n;
+   }
+
+// Look for "Symbol" in the symbol index (case sensitive) and skip it
+   found = SeekSymbol (Symbol);
+   if (found)
+   {
+      ScanToken (length);
+      c = ScanToken (length);
+      if (!c || length != 1 || *c != '=')
+      {
+         GenericObject::Log_Error ("at line % 5i : \"=\" was expected after symbol \"%s\"", iline, Symbol);
+         error++;
+      }
+      else
+      {
+
+// Parse the values, up to "]" (a single value may be given without brackets)
+         c = ScanToken (length);
+         bracket = (c && length == 1 && *c == '[');
+         if (bracket)
+            c = ScanToken (length);
+         while (c && !(length == 1 && *c == ']') && old_error == error)
+         {
+            if (length == 1 && (*c == '=' || *c == '['))
+            {
+               GenericObject::Log_Error ("at line % 5i : \"]\" was expected to close \"%s\" array", iline, Symbol);
+               error++;
+            }
+            else if (!ParseReal (c, length, value))
+            {
+               GenericObject::Log_Error ("Symbol \"%s\" : illegal character in NUMERIC field \"%.*s\"", Symbol, (int) (length < TOKEN_SIZE ? length : TOKEN_SIZE), c);
+               error++;
+            }
+            else if (n >= MaxSize)
+            {
+               GenericObject::Log_Error ("at line % 5i : Symbol \"%s\" has more than the \"%i\" allowed values", iline, Symbol, MaxSize);
+               error++;
+            }
+            else if (dv)
+               dv[n++] = value;
+            else
+               iv[n++] = (int) value;
+            c = bracket ? ScanToken (length) : NULL;
+         }
+         if (bracket && !c)
+         {
+            GenericObject::Log_Error ("at line % 5i : reached unexpected END of FILE\n", iline);
+            error++;
+         }
+      }
+
+// Check if the values number is an integer multiple of the columns number
+      if (old_error == error && (n < n_columns || n % n_columns > 0))
+      {
+         GenericObject::Log_Error ("at line % 5i : Symbol \"%s\" shall contain an integer multiple of \"%i\" data", iline, Symbol, n_columns);
+         error++;
+      }
+      if (old_error != error)
+         n = 0;
+      else
+         GenericObject::Log_Write ("%s = [ %i values ]\n", Symbol, n);
+   }
+
+// Message/Error when symbol has not been found
+   else if (mustexist)
+   {
+      GenericObject::Log_Error ("Symbol \"%s\" not found", Symbol);
+      error++;
+   }
+   else
+      GenericObject::Log_Write ("%s (Optional) not found and set to default\n", Symbol);
+
+   if (old_error == error)
+      CacheStore (kind, Symbol, MaxSize, found, dv ? (const void*) dv : (const void*) iv, n * item_size);
+   return n;
+}
+
 //-------------------------------------------------------------------------
 typ_return InputFile::readSymbol (const char* Symbol, int Ntokens, bool mustexist)
 //-------------------------------------------------------------------------
+{
+   const typ_cache_entry   *entry = CacheFind (Cache_Tokens, Symbol, Ntokens);
+   typ_return              found;
+   char                    *token, *packed;
+   unsigned int            size;
+   int                     i, old_error = error;
+
+// Tokens from the cache
+   if (entry && (entry->found || !mustexist))
+   {
+      if (entry->found)
+      {
+         if (buffer) {delete buffer; buffer = 0;}
+         buffer = new char[TOKEN_SIZE*Ntokens];
+         memset (buffer, '\0', TOKEN_SIZE*Ntokens);
+         for (i = 0, token = cache_data + entry->data; i < Ntokens; i++, token += strlen (token) + 1)
+            strcpy (buffer + TOKEN_SIZE*i, token);
+         GenericObject::Log_Write ("%s (cache)\n", Symbol);
+      }
+      else
+         GenericObject::Log_Write ("%s (Optional) not found and set to default := ", Symbol);
+      return (entry->found ? Nominal : Error);
+   }
+
+// Tokens from the input file, packed one after the other in the cache
+   found = ReadSymbolText (Symbol, Ntokens, mustexist);
+   if (cache_enabled && old_error == error)
+   {
+      for (i = 0, size = 0; found == Nominal && i < Ntokens; i++)
+         size += strlen (buffer + TOKEN_SIZE*i) + 1;
+      packed = new char[size + 1];
+      for (i = 0, token = packed; found == Nominal && i < Ntokens; i++, token += strlen (token) + 1)
+         strcpy (token, buffer + TOKEN_SIZE*i);
+      CacheStore (Cache_Tokens, Symbol, Ntokens, found == Nominal, packed, size);
+      delete [] packed;
+   }
+   return found;
+}
+
+//-------------------------------------------------------------------------
+typ_return InputFile::ReadSymbolText (const char* Symbol, int Ntokens, bool mustexist)
+//-------------------------------------------------------------------------
 {
    char  *c, line_copy[LINE_SIZE];
    bool  found;
    int   itoken;
 
-   if (!f)
+   if (!text)
       return Error;
 
-// Reset the input file status
-   clearerr (f);
-   fseek (f, 0, SEEK_SET);
-   iline = 0;
-
-// Look for "Symbol" in the input file (case sensitive)
-   found = false;
-   ReadLine ();
-   while (!found && !feof(f))
+// Look for "Symbol" in the symbol index (case sensitive) and read its line
+   found = SeekSymbol (Symbol);
+   if (found)
    {
+      ReadLine ();
       memset (line_copy, '\0', LINE_SIZE);
       strcpy (line_copy, line);
-      c = strtok (line, SEPARATORS);
-      if (!c || strcmp (c, Symbol)) ReadLine ();
-      else
-      {
-         found = true;
-         outside_square_brackets = true;
+      c = strtok_r (line, SEPARATORS, &token_state);
+      outside_square_brackets = true;
 
 // Memory buffer allocation for tokens storaging
-         if (buffer) {delete buffer; buffer = 0;}
-         buffer = new char[TOKEN_SIZE*Ntokens];
-         memset (buffer, '\0', TOKEN_SIZE*Ntokens);
+      if (buffer) {delete buffer; buffer = 0;}
+      buffer = new char[TOKEN_SIZE*Ntokens];
+      memset (buffer, '\0', TOKEN_SIZE*Ntokens);
 
 // Check the second token in current line (it must be "=")
-         c = strtok (NULL, SEPARATORS);
-         if (!c || *c != '=')
+      c = strtok_r (NULL, SEPARATORS, &token_state);
+      if (!c || *c != '=')
+      {
+         GenericObject::Log_Error ("at line % 5i : \"=\" was expected after symbol \"%s\"", iline, Symbol);
+         error++;
+      }
+
+// Load a single token data
+      else if (Ntokens == 1 && enable_tokenizer)
+      {
+         c = strtok_r (NULL, SEPARATORS, &token_state);
+         if (!c)
          {
-            GenericObject::Log_Error ("at line % 5i : \"=\" was expected after symbol \"%s\"", iline, Symbol);
+            GenericObject::Log_Error ("at line % 5i : at least one value was expected for symbol \"%s\"", iline, Symbol);
             error++;
          }
-
-// Load a single token data
-         else if (Ntokens == 1 && enable_tokenizer)
+         else if (c[0] == '[' && c[1] == '\0')
          {
-            c = strtok (NULL, SEPARATORS);
+            c = strtok_r (NULL, SEPARATORS, &token_state);
             if (!c)
             {
-               GenericObject::Log_Error ("at line % 5i : at least one value was expected for symbol \"%s\"", iline, Symbol);
+               GenericObject::Log_Error ("at line % 5i : one value was expected for symbol \"%s\"", iline, Symbol);
                error++;
             }
-            else if (c[0] == '[' && c[1] == '\0')
-            {
-               c = strtok (NULL, SEPARATORS);
-               if (!c)
-               {
-                  GenericObject::Log_Error ("at line % 5i : one value was expected for symbol \"%s\"", iline, Symbol);
-                  error++;
-               }
-               else strncpy (buffer, c, TOKEN_SIZE-1);
-            }
             else strncpy (buffer, c, TOKEN_SIZE-1);
          }
+         else strncpy (buffer, c, TOKEN_SIZE-1);
+      }
 
 // Load an array of tokens data
-         else
-         {
+      else
+      {
 
 // Check first token in array data (it must be "[")
-            GetArrayToken (c);
-            outside_square_brackets = false;
-            if (c && strcmp (c, "["))
-            {
-               GenericObject::Log_Error ("at line % 5i : \"[\" was expected to open \"%s\" array", iline, Symbol);
-               error++;
-            }
-            else if (!enable_tokenizer && strlen(c+2))
-            {
-               GenericObject::Log_Error ("at line % 5i : Symbol \"%s\" is a Multi-Line array, each entry shall be on a NEW LINE (\"%s\" not allowed after \"[\" on the same line)", iline, Symbol, c+2);
-               error++;
-            }
-            else
-            {
+         GetArrayToken (c);
+         outside_square_brackets = false;
+         if (c && strcmp (c, "["))
+         {
+            GenericObject::Log_Error ("at line % 5i : \"[\" was expected to open \"%s\" array", iline, Symbol);
+            error++;
+         }
+         else if (!enable_tokenizer && strlen(c+2))
+         {
+            GenericObject::Log_Error ("at line % 5i : Symbol \"%s\" is a Multi-Line array, each entry shall be on a NEW LINE (\"%s\" not allowed after \"[\" on the same line)", iline, Symbol, c+2);
+            error++;
+         }
+         else
+         {
 // Read the array tokens
-               for (itoken = 0; itoken < Ntokens; itoken++)
+            for (itoken = 0; itoken < Ntokens; itoken++)
+            {
+               GetArrayToken (c);
+               if (c && !strcmp (c, "]"))
                {
-                  GetArrayToken (c);
-                  if (c && !strcmp (c, "]"))
-                  {
-                     GenericObject::Log_Error ("at line % 5i : reached unexpected array terminator \"]\" on symbol \"%s\"", iline, Symbol);
-                     error++;
-                  }
-                  else strncpy (buffer+TOKEN_SIZE*itoken, c, TOKEN_SIZE-1);
+                  GenericObject::Log_Error ("at line % 5i : reached unexpected array terminator \"]\" on symbol \"%s\"", iline, Symbol);
+                  error++;
                }
+               else strncpy (buffer+TOKEN_SIZE*itoken, c, TOKEN_SIZE-1);
+            }
 
 // Check last token in array data (it must be "]")
-               GetArrayToken (c);
-               if (c && strcmp (c, "]"))
-               {
-                  GenericObject::Log_Error ("at line % 5i : \"]\" was expected to close \"%s\" array", iline, Symbol);
-                  error = true;
-               }
+            GetArrayToken (c);
+            if (c && strcmp (c, "]"))
+            {
+               GenericObject::Log_Error ("at line % 5i : \"]\" was expected to close \"%s\" array", iline, Symbol);
+               error = true;
             }
          }
       }
@@ -403,74 +650,74 @@ typ_return InputFile::readSymbol (const char* ModelName, const char* Symbol, int
 int InputFile::GetRowsNumber (const char* Symbol, int n_columns)
 //-------------------------------------------------------------------------
 {
+   const typ_cache_entry   *entry = CacheFind (Cache_Rows, Symbol, n_columns);
    char  *c, line_copy[LINE_SIZE];
    bool  found;
-   int   ntoken = -1, result = 0;
+   int   ntoken = -1, result = 0, old_error = error;
 
-   if (!f)
+   if (!text)
       return Error;
 
-// Reset the input file status
-   clearerr (f);
-   fseek (f, 0, SEEK_SET);
-   iline = 0;
+// Number of rows from the cache
+   if (entry)
+   {
+      if (entry->found)
+         memcpy (&result, cache_data + entry->data, sizeof(int));
+      GenericObject::Log_Write (entry->found ? "%s (cache)\n" : "%s (Optional) not found and set to default\n", Symbol);
+      return result;
+   }
 
-// Look for "Symbol" in the input file (case sensitive)
-   found = false;
-   ReadLine ();
-   while (!found && !feof(f))
+// Look for "Symbol" in the symbol index (case sensitive) and read its line
+   found = SeekSymbol (Symbol);
+   if (found)
    {
+      ReadLine ();
       memset (line_copy, '\0', LINE_SIZE);
       strcpy (line_copy, line);
-      c = strtok (line, SEPARATORS);
-      if (!c || strcmp (c, Symbol)) ReadLine ();
-      else
-      {
-         found = true;
-         outside_square_brackets = true;
+      c = strtok_r (line, SEPARATORS, &token_state);
+      outside_square_brackets = true;
 
 // Check the second token in current line (it must be "=")
-         c = strtok (NULL, SEPARATORS);
-         if (!c || *c != '=')
+      c = strtok_r (NULL, SEPARATORS, &token_state);
+      if (!c || *c != '=')
+      {
+         GenericObject::Log_Error ("at line % 5i : \"=\" was expected after symbol \"%s\"", iline, Symbol);
+         error++;
+      }
+
+// Check first token in array data (it must be "[")
+      else
+      {
+         GetArrayToken (c);
+         outside_square_brackets = false;
+         if (c && *c != '[')
          {
-            GenericObject::Log_Error ("at line % 5i : \"=\" was expected after symbol \"%s\"", iline, Symbol);
+            GenericObject::Log_Error ("at line % 5i : \"[\" was expected to open \"%s\" array", iline, Symbol);
+            error++;
+         }
+         else if (!enable_tokenizer && strlen(c+2))
+         {
+            GenericObject::Log_Error ("at line % 5i : Symbol \"%s\" is a Multi-Line array, each entry shall be a SINGLE NEW LINE (\"%s\" not allowed after \"[\" on the same line)", iline, Symbol, c+2);
             error++;
          }
 
-// Check first token in array data (it must be "[")
+// Count the number of tokens
          else
          {
-            GetArrayToken (c);
-            outside_square_brackets = false;
-            if (c && *c != '[')
+            while (c && !strchr(c,']'))
             {
-               GenericObject::Log_Error ("at line % 5i : \"[\" was expected to open \"%s\" array", iline, Symbol);
-               error++;
+               if (enable_tokenizer)
+                  c = strtok_r (NULL, SEPARATORS, &token_state);
+               else
+                  c = NULL;
+               if (!c) GetArrayToken (c);
+               ntoken++;
             }
-            else if (!enable_tokenizer && strlen(c+2))
+            if (!enable_tokenizer && c && strcmp(c,"]"))
             {
-               GenericObject::Log_Error ("at line % 5i : Symbol \"%s\" is a Multi-Line array, each entry shall be a SINGLE NEW LINE (\"%s\" not allowed after \"[\" on the same line)", iline, Symbol, c+2);
+               GenericObject::Log_Error ("at line % 5i : Symbol \"%s\" is a Multi-Line array, each entry shall be a SINGLE NEW LINE (\"%s\" not allowed before \"]\" on the same line)", iline, Symbol, c);
                error++;
             }
-
-// Count the number of tokens
-            else
-            {
-               while (c && !strchr(c,']'))
-               {
-                  if (enable_tokenizer)
-                     c = strtok (NULL, SEPARATORS);
-                  else
-                     c = NULL;
-                  if (!c) GetArrayToken (c);
-                  ntoken++;
-               }
-               if (!enable_tokenizer && c && strcmp(c,"]"))
-               {
-                  GenericObject::Log_Error ("at line % 5i : Symbol \"%s\" is a Multi-Line array, each entry shall be a SINGLE NEW LINE (\"%s\" not allowed before \"]\" on the same line)", iline, Symbol, c);
-                  error++;
-               }
-            }
          }
       }
    }
@@ -498,6 +745,8 @@ int InputFile::GetRowsNumber (const char* Symbol, int n_columns)
          GenericObject::Log_Write ("%s\n", line_copy);
    }
 
+   if (old_error == error)
+      CacheStore (Cache_Rows, Symbol, n_columns, found, &result, sizeof(int));
    return result;
 }
 
@@ -518,21 +767,21 @@ typ_return InputFile::ReadLine ()
    char  c, *p, opc[] = "=[]";
    int   i, len;
 
-   if (!f)
+   if (!text)
       return Error;
 
 // Read a new text line from the input file
    memset (line, '\0', LINE_SIZE);
    i = 0;
-   c = (char) fgetc (f);
+   c = GetChar ();
 // Skip initial empty characters/lines, if present
-   while (!feof(f) && strchr (SEPARATORS, c))
-      c = (char) fgetc (f);
+   while (!end_of_file && strchr (SEPARATORS, c))
+      c = GetChar ();
 // Acquire a new text line till new line or carriage return
-   while (!feof(f) && !strchr ("\r\n", c) && i < LINE_SIZE)
+   while (!end_of_file && !strchr ("\r\n", c) && i < LINE_SIZE)
    {
       line[i++] = c;
-      c = (char) fgetc (f);
+      c = GetChar ();
    }
 // Remove terminal empty characters, if present
    p = line + i - 1;
@@ -566,19 +815,19 @@ typ_return InputFile::GetArrayToken (char*& c)
 
    typ_return  result = Nominal;
 
-   if (!f)
+   if (!text)
       return Error;
 
    if (enable_tokenizer || outside_square_brackets)
-      c = strtok (NULL, SEPARATORS);
+      c = strtok_r (NULL, SEPARATORS, &token_state);
    else
       c = NULL;
 
-   while (!c && !feof(f)) // Continue on a new line
+   while (!c && !end_of_file) // Continue on a new line
    {
       ReadLine ();
       if (enable_tokenizer || outside_square_brackets)
-         c = strtok (line, SEPARATORS);
+         c = strtok_r (line, SEPARATORS, &token_state);
       else
       {
          c = line + strspn(line, SEPARATORS);      // Remove initial empty characters
@@ -592,7 +841,7 @@ typ_return InputFile::GetArrayToken (char*& c)
             c = NULL;
       }
    }
-   if (feof(f))
+   if (end_of_file)
    {
       GenericObject::Log_Error ("at line % 5i : reached unexpected END of FILE\n", iline);
       error++;
@@ -600,3 +849,419 @@ typ_return InputFile::GetArrayToken (char*& c)
    }
    return result;
 }
+
+//-------------------------------------------------------------------------
+const char* InputFile::ScanToken (unsigned long &length)
+//-------------------------------------------------------------------------
+{
+   const char  *token;
+   bool        new_line = (position == 0 || text[position-1] == '\n' || text[position-1] == '\r');
+
+// Skip the separators and the comments ("//" like C++), counting the not empty lines as "ReadLine" does
+   for (;;)
+   {
+      while (position < text_size && strchr (SEPARATORS, text[position]))
+         new_line = (text[position++] == '\n') || new_line;
+      if (position + 1 < text_size && text[position] == '/' && text[position+1] == '/')
+      {
+         if (new_line)
+            iline++;
+         new_line = false;
+         while (position < text_size && text[position] != '\n')
+            position++;
+      }
+      else
+         break;
+   }
+   if (position >= text_size)
+   {
+      end_of_file = true;
+      length      = 0;
+      return NULL;
+   }
+   if (new_line)
+      iline++;
+
+// The operating characters are tokens on their own, as "ReadLine" puts blank spaces around them
+   token = text + position;
+   if (strchr ("=[]", *token))
+      length = 1;
+   else
+   {
+      for (length = 0; position + length < text_size; length++)
+         if (strchr (SEPARATORS "=[]", token[length]) || (token[length] == '/' && position + length + 1 < text_size && token[length+1] == '/'))
+            break;
+   }
+   position += length;
+   return token;
+}
+
+//-------------------------------------------------------------------------
+bool InputFile::ParseReal (const char* token, unsigned long length, double &value)
+//-------------------------------------------------------------------------
+{
+   static const double  power_of_ten[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                          1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+   const char           *p = token, *end = token + length;
+   unsigned long long   mantissa = 0;
+   char                 copy[TOKEN_SIZE], *stop;
+   bool                 negative = false, exponent_negative = false, exact = true;
+   int                  digits = 0, exponent = 0, exponent_value = 0;
+
+   if (length == 0)
+      return false;
+
+// [sign] digits [. digits] [E [sign] digits]
+   if (*p == '+' || *p == '-')
+      negative = (*p++ == '-');
+   for (; p < end && '0' <= *p && *p <= '9'; p++, digits++)
+   {
+      if (mantissa < 100000000000000000ULL)
+         mantissa = 10*mantissa + (*p - '0');
+      else
+      {
+         exponent++;
+         exact = exact && (*p == '0');
+      }
+   }
+   if (p < end && *p == '.')
+   {
+      for (p++; p < end && '0' <= *p && *p <= '9'; p++, digits++)
+      {
+         if (mantissa < 100000000000000000ULL)
+         {
+            mantissa = 10*mantissa + (*p - '0');
+            exponent--;
+         }
+         else
+            exact = exact && (*p == '0');
+      }
+   }
+   if (digits == 0)
+      return false;
+   if (p < end && (*p == 'e' || *p == 'E'))
+   {
+      if (++p < end && (*p == '+' || *p == '-'))
+         exponent_negative = (*p++ == '-');
+      if (p == end)
+         return false;
+      for (; p < end && '0' <= *p && *p <= '9'; p++)
+         if (exponent_value < 100000)
+            exponent_value = 10*exponent_value + (*p - '0');
+      exponent += exponent_negative ? -exponent_value : exponent_value;
+   }
+   if (p != end)
+      return false;
+
+// Exact mantissa and power of ten: a single correctly rounded operation
+   if (exact && mantissa < (1ULL << 53) && -22 <= exponent && exponent <= 22)
+   {
+      value = (double) mantissa;
+      value = (exponent < 0) ? value / power_of_ten[-exponent] : value * power_of_ten[exponent];
+      value = negative ? -value : value;
+      return true;
+   }
+
+// Other values: "strtod" on a copy using the decimal point of the current locale
+   if (length >= TOKEN_SIZE)
+      return false;
+   memcpy (copy, token, length);
+   copy[length] = '\0';
+   stop = strchr (copy, '.');
+   if (stop)
+      *stop = *localeconv ()->decimal_point;
+   value = strtod (copy, &stop);
+   return (*stop == '\0');
+}
+
+//-------------------------------------------------------------------------
+bool InputFile::SeekSymbol (const char* Symbol)
+//-------------------------------------------------------------------------
+{
+   const ConfigStore::typ_Symbol *entry;
+   const ConfigStore             *layer;
+
+   if (!store)
+      return false;
+   entry = store->Find (Symbol, layer);
+   if (!entry)
+      return false;
+   text        = layer->Get_Text ();
+   text_size   = layer->Get_Text_Size ();
+   position    = entry->position;
+   iline       = entry->line;
+   end_of_file = false;
+   return true;
+}
+
+//-------------------------------------------------------------------------
+void InputFile::CacheRead ()
+//-------------------------------------------------------------------------
+{
+   typ_cache_header  header;
+   struct stat       status;
+   char              name[LINE_SIZE + sizeof(INPUTFILE_CACHE_SUFFIX)];
+   FILE              *cache;
+   unsigned long     i;
+   bool              valid = false;
+
+// Read the cache as a whole, if it has been built from the same input file content
+   sprintf (name, "%s%s", current_input_file_name, INPUTFILE_CACHE_SUFFIX);
+   cache = fopen (name, "rb");
+   if (!cache)
+      return;
+   if (fread (&header, sizeof(header), 1, cache) == 1
+    && !memcmp (header.magic, INPUTFILE_CACHE_MAGIC, sizeof(header.magic))
+    && header.version    == INPUTFILE_CACHE_VERSION
+    && header.token_size == TOKEN_SIZE
+    && header.text_hash  == store->Get_Hash ()
+    && header.text_size  == text_size
+    && !fstat (fileno (cache), &status) && (unsigned long long) status.st_size >= sizeof(header)
+    && header.n_entries  <= (status.st_size - sizeof(header)) / sizeof(typ_cache_entry)
+    && header.data_size  == status.st_size - sizeof(header) - header.n_entries * sizeof(typ_cache_entry))
+   {
+      cache_entry = new typ_cache_entry[header.n_entries + 1];
+      cache_data  = new char[header.data_size + 1];
+      valid = (fread (cache_entry, sizeof(typ_cache_entry), header.n_entries, cache) == header.n_entries
+            && fread (cache_data, 1, header.data_size, cache) == header.data_size);
+   }
+   fclose (cache);
+
+// Every entry shall be within the read cache data (damaged cache file)
+   if (valid)
+   {
+      cache_data_size = header.data_size;
+      for (i = 0; valid && i < header.n_entries; i++)
+         valid = CacheCheck (cache_entry[i]);
+   }
+
+   if (valid)
+   {
+      n_cache_entries        = header.n_entries;
+      cache_entries_capacity = header.n_entries + 1;
+      cache_data_capacity    = header.data_size + 1;
+      CacheIndex ();
+      GenericObject::Log_Write ("Input file cache \"%s\" : %lu symbols loaded\n", name, n_cache_entries);
+   }
+   else
+   {
+      CacheFree ();
+      GenericObject::Log_Write ("Input file cache \"%s\" does not match the input file, it will be rebuilt\n", name);
+   }
+}
+
+//-------------------------------------------------------------------------
+void InputFile::CacheWrite ()
+//-------------------------------------------------------------------------
+{
+   typ_cache_header  header;
+   char              name[LINE_SIZE + sizeof(INPUTFILE_CACHE_SUFFIX)], temporary_name[LINE_SIZE + sizeof(INPUTFILE_CACHE_SUFFIX) + 16];
+   FILE              *cache;
+   bool              written;
+
+   memset (&header, '\0', sizeof(header));
+   memcpy (header.magic, INPUTFILE_CACHE_MAGIC, sizeof(header.magic));
+   header.version    = INPUTFILE_CACHE_VERSION;
+   header.token_size = TOKEN_SIZE;
+   header.text_hash  = store->Get_Hash ();
+   header.text_size  = text_size;
+   header.n_entries  = n_cache_entries;
+   header.data_size  = cache_data_size;
+
+// Write a temporary file then rename it, so that concurrent runs always read a complete cache
+   sprintf (name, "%s%s", current_input_file_name, INPUTFILE_CACHE_SUFFIX);
+   sprintf (temporary_name, "%s.%d", name, (int) getpid ());
+   cache = fopen (temporary_name, "wb");
+   if (!cache)
+      return;
+   written = (fwrite (&header, sizeof(header), 1, cache) == 1
+           && fwrite (cache_entry, sizeof(typ_cache_entry), n_cache_entries, cache) == n_cache_entries
+           && fwrite (cache_data, 1, cache_data_size, cache) == cache_data_size);
+   written = (fclose (cache) == 0) && written;
+   if (written && rename (temporary_name, name) == 0)
+      GenericObject::Log_Write ("Input file cache \"%s\" : %lu symbols saved\n", name, n_cache_entries);
+   else
+      remove (temporary_name);
+}
+
+//-------------------------------------------------------------------------
+void InputFile::CacheFree ()
+//-------------------------------------------------------------------------
+{
+   delete [] cache_entry;
+   delete [] cache_data;
+   delete [] cache_table;
+   cache_entry            = NULL;
+   cache_data             = NULL;
+   cache_table            = NULL;
+   n_cache_entries        = 0;
+   cache_entries_capacity = 0;
+   cache_data_size        = 0;
+   cache_data_capacity    = 0;
+   cache_table_size       = 0;
+   cache_modified         = false;
+}
+
+//-------------------------------------------------------------------------
+void InputFile::CacheIndex ()
+//-------------------------------------------------------------------------
+{
+   unsigned long  i, j;
+
+   delete [] cache_table;
+   for (cache_table_size = 64; cache_table_size < 4*n_cache_entries; cache_table_size <<= 1)
+      ;
+   cache_table = new unsigned long[cache_table_size];
+   memset (cache_table, '\0', cache_table_size * sizeof(unsigned long));
+   for (i = 0; i < n_cache_entries; i++)
+   {
+      for (j = cache_entry[i].hash & (cache_table_size-1); cache_table[j]; j = (j+1) & (cache_table_size-1))
+         ;
+      cache_table[j] = i + 1;
+   }
+}
+
+//-------------------------------------------------------------------------
+bool InputFile::CacheCheck (const typ_cache_entry &entry) const
+//-------------------------------------------------------------------------
+{
+   const char     *token, *end, *token_end;
+   unsigned long  item_size;
+   int            i;
+
+// Symbol (NUL-terminated) and data within the cache data
+   if (entry.symbol >= cache_data_size || !memchr (cache_data + entry.symbol, '\0', cache_data_size - entry.symbol)
+    || entry.data > cache_data_size || entry.size > cache_data_size - entry.data || entry.n_tokens < 0)
+      return false;
+
+// Data size of the kind: the readers copy it without any further check
+   switch (entry.kind)
+   {
+      case Cache_Doubles:
+      case Cache_Integers:
+         item_size = (entry.kind == Cache_Doubles) ? sizeof(double) : sizeof(int);
+         return !entry.found || entry.size == entry.n_tokens * item_size;
+      case Cache_Table_Doubles:
+      case Cache_Table_Integers:
+         item_size = (entry.kind == Cache_Table_Doubles) ? sizeof(double) : sizeof(int);
+         return entry.size <= entry.n_tokens * item_size && entry.size % item_size == 0;
+      case Cache_Rows:
+         return !entry.found || entry.size == sizeof(int);
+      case Cache_Tokens:
+         for (i = 0, token = cache_data + entry.data, end = token + entry.size; entry.found && i < entry.n_tokens; i++, token = token_end + 1)
+         {
+            token_end = (const char*) memchr (token, '\0', end - token);
+            if (!token_end || token_end - token >= TOKEN_SIZE)
+               return false;
+         }
+         return true;
+      default:
+         return false;
+   }
+}
+
+//-------------------------------------------------------------------------
+const InputFile::typ_cache_entry* InputFile::CacheFind (typ_cache_kind kind, const char* Symbol, int Ntokens)
+//-------------------------------------------------------------------------
+{
+   const typ_cache_entry   *entry;
+   unsigned int            hash;
+   unsigned long           i;
+
+   if (!cache_table)
+      return NULL;
+   hash = ConfigStore::Hash (Symbol);
+   for (i = hash & (cache_table_size-1); cache_table[i]; i = (i+1) & (cache_table_size-1))
+   {
+      entry = &cache_entry[cache_table[i]-1];
+      if (entry->hash == hash && entry->kind == kind && entry->n_tokens == Ntokens && entry->tokenizer == enable_tokenizer
+       && !strcmp (cache_data + entry->symbol, Symbol))
+         return entry;
+   }
+   return NULL;
+}
+
+//-------------------------------------------------------------------------
+void InputFile::CacheStore (typ_cache_kind kind, const char* Symbol, int Ntokens, bool found, const void* data, unsigned int size)
+//-------------------------------------------------------------------------
+{
+   typ_cache_entry   *entry;
+   unsigned long     symbol_size = strlen (Symbol) + 1, needed, capacity, i;
+   char              *new_data;
+
+   if (!cache_enabled || cache_frozen || !text || CacheFind (kind, Symbol, Ntokens))
+      return;
+
+// Room for the entry, the symbol and the data
+   if (n_cache_entries == cache_entries_capacity)
+   {
+      capacity = cache_entries_capacity ? 2*cache_entries_capacity : 64;
+      entry    = new typ_cache_entry[capacity];
+      if (n_cache_entries)
+         memcpy (entry, cache_entry, n_cache_entries * sizeof(typ_cache_entry));
+      delete [] cache_entry;
+      cache_entry            = entry;
+      cache_entries_capacity = capacity;
+   }
+   needed = CACHE_ALIGN(cache_data_size + symbol_size) + size;
+   if (needed > cache_data_capacity)
+   {
+      for (capacity = cache_data_capacity ? cache_data_capacity : 4096; capacity < needed; capacity <<= 1)
+         ;
+      new_data = new char[capacity];
+      if (cache_data_size)
+         memcpy (new_data, cache_data, cache_data_size);
+      delete [] cache_data;
+      cache_data          = new_data;
+      cache_data_capacity = capacity;
+   }
+
+   entry = &cache_entry[n_cache_entries++];
+   memset (entry, '\0', sizeof(typ_cache_entry));
+   entry->hash      = ConfigStore::Hash (Symbol);
+   entry->kind      = (unsigned char) kind;
+   entry->tokenizer = enable_tokenizer;
+   entry->found     = found;
+   entry->n_tokens  = Ntokens;
+   entry->size      = size;
+   entry->symbol    = cache_data_size;
+   entry->data      = CACHE_ALIGN(cache_data_size + symbol_size);
+   memcpy (cache_data + entry->symbol, Symbol, symbol_size);
+   memset (cache_data + entry->symbol + symbol_size, '\0', entry->data - entry->symbol - symbol_size);
+   if (size)
+      memcpy (cache_data + entry->data, data, size);
+   cache_data_size = needed;
+   cache_modified  = true;
+
+// Entry added to the hash table, rebuilt (4 times the entries) when more than half full
+   if (!cache_table || 2*n_cache_entries > cache_table_size)
+      CacheIndex ();
+   else
+   {
+      for (i = entry->hash & (cache_table_size-1); cache_table[i]; i = (i+1) & (cache_table_size-1))
+         ;
+      cache_table[i] = n_cache_entries;
+   }
+}
+
+//-------------------------------------------------------------------------
+bool InputFile::CacheLoad (typ_cache_kind kind, const char* Symbol, void* v, int VarSize, unsigned int item_size, bool mustexist, typ_return &found)
+//-------------------------------------------------------------------------
+{
+   const typ_cache_entry   *entry = CacheFind (kind, Symbol, VarSize);
+
+   if (!entry || (!entry->found && mustexist))
+      return false;
+   if (entry->found)
+   {
+      memcpy (v, cache_data + entry->data, VarSize * item_size);
+      GenericObject::Log_Write ("%s (cache)\n", Symbol);
+      found = Nominal;
+   }
+   else
+   {
+      GenericObject::Log_Write ("%s (Optional) not found and set to default := ", Symbol);
+      found = Error;
+   }
+   return true;
+}
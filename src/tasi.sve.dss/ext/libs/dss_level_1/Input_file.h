@@ -21,16 +21,37 @@
    LG/D.Pascucci 2013/09/26  Removed "readMultilineSymbol" methods since reundant with respect to
                              the "readSymbol" ones. Inside the method "readSymbol" the special branch
                              (Ntokens == 1) is now constrained also to the "enable_tokenizer" flag.
+   DSS Team       2026/10/19  The input file is memory-mapped and indexed once at "open" (hash table of the first
+                              token of each instruction line, e.g. "Model.SYMBOL"): "readSymbol" and "GetRowsNumber"
+                              jump to the indexed line instead of re-scanning the whole file.
+   DSS Team       2026/10/19  Optional binary cache of the parsed symbols ("EnableCache"): the typed arrays loaded by
+                              "load", the tokens of "readSymbol" and the "GetRowsNumber" results are saved at "close"
+                              into "<input file>.cache", validated at the next "open" by a hash of the input file content.
+   DSS Team       2026/10/19  Added "loadTable": streaming loader of large numeric arrays, parsed in one pass straight
+                              from the mapped input file into the caller array (no token buffer, no "GetRowsNumber").
+   DSS Team       2026/10/19  The input file text and its symbol index are kept by an immutable, shared "ConfigStore": an
+                              "InputFile" is now a reader of a store ("open" loads it, "attach" reads an already loaded one)
+                              and keeps only the reading state, so several readers can query the same store concurrently.
+   DSS Team       2026/10/19  Added "FreezeCache": the reader uses the binary cache but does not add symbols to it nor rewrite it
+                              (readers of the parallel Models initialization, each reading a part of the symbols only).
+   DSS Team       2026/10/19  The cache entries read from a cache file are checked ("CacheCheck"), a new cached symbol
+                              is added to the cache hash table in place.
 
 ******************************************************************************/
 
 #include "GenericTypes.h"
 
+class ConfigStore;
+
 #define  TOKEN_SIZE              256                                 //!< Maximum allowed size for a single input token
 #define  LINE_SIZE               1024                                //!< Maximum allowed size for a single input instruction
 #define  INPUTFILE_DEFAULT       "dss.set"                           //!< Default Input File Name (if not provided)
 #define  REAL_NUMBERS            "0123456789.Ee+-"                   //!< Allowed characters set for Real Numbers
 #define  SEPARATORS              " ,;\t\r\n"                         //!< Allowed token separators
+#define  INPUTFILE_EOF           ((char) EOF)                        //!< Character returned when reading past the end of the input file
+#define  INPUTFILE_CACHE_SUFFIX  ".cache"                            //!< Suffix of the binary cache file name (appended to the input file name)
+#define  INPUTFILE_CACHE_MAGIC   "DSSCACHE"                          //!< Binary cache file identifier (8 characters)
+#define  INPUTFILE_CACHE_VERSION 1                                   //!< Binary cache file format version
 
 /**
 * Class definition to handle the HW Models Input File.
@@ -38,6 +59,48 @@
 class InputFile
 {
 
+/*-------------------------------------------------------------------------
+   Data Type declarations
+-------------------------------------------------------------------------*/
+
+   friend class ConfigStore;                                         // The stores are indexed reading their text by an "InputFile"
+
+private:
+
+   enum typ_cache_kind  /** Kind of a cached symbol */
+   {
+      Cache_Doubles = 'D',                                           //!< "load" of a double array
+      Cache_Integers = 'I',                                          //!< "load" of an integer (or bool) array
+      Cache_Tokens = 'S',                                            //!< "readSymbol" tokens (NUL-terminated strings)
+      Cache_Rows = 'R',                                              //!< "GetRowsNumber" result
+      Cache_Table_Doubles = 'd',                                     //!< "loadTable" of a double array
+      Cache_Table_Integers = 'i'                                     //!< "loadTable" of an integer array
+   };
+
+   struct typ_cache_header  /** Binary cache file header */
+   {
+      char           magic[8];                                       //!< INPUTFILE_CACHE_MAGIC
+      unsigned int   version;                                        //!< INPUTFILE_CACHE_VERSION
+      unsigned int   token_size;                                     //!< TOKEN_SIZE
+      unsigned long long text_hash;                                  //!< Hash of the input file content
+      unsigned long long text_size;                                  //!< Input file size [bytes]
+      unsigned long long n_entries;                                  //!< Number of the cached symbols
+      unsigned long long data_size;                                  //!< Size of the cached data [bytes]
+   };
+
+   struct typ_cache_entry  /** Binary cache entry, its symbol and data are stored in the cache data */
+   {
+      unsigned int   hash;                                           //!< Hash code of the symbol
+      unsigned char  kind;                                           //!< Kind of the cached symbol (typ_cache_kind)
+      unsigned char  tokenizer;                                      //!< "enable_tokenizer" flag when the symbol has been parsed
+      unsigned char  found;                                          //!< Flag to say the symbol has been found (else it is optional and missing)
+      unsigned char  spare;                                          //!< Spare (alignment)
+      int            n_tokens;                                       //!< Number of the requested tokens
+      unsigned int   size;                                           //!< Size of the data [bytes]
+      unsigned long long symbol;                                     //!< Position of the symbol in the cache data
+      unsigned long long data;                                       //!< Position of the data in the cache data (8-byte aligned)
+   };
+
 /*-------------------------------------------------------------------------
    Data declarations
 -------------------------------------------------------------------------*/
@@ -52,7 +115,23 @@ public:
 
 private:
 
-   FILE        *f;                                                   //!< Input File Handler
+   ConfigStore *store;                                               //!< Configuration store being read (NULL if the file is not open)
+   const char  *text;                                                //!< Text of the store layer being read (NULL if the file is not open)
+   unsigned long text_size;                                          //!< Text size [bytes] of the store layer being read
+   unsigned long position;                                           //!< Current reading position in the text
+   bool        end_of_file;                                          //!< Flag set when reading past the end of the text
+   char        *token_state;                                         //!< "strtok_r" state of the line being tokenized
+   typ_cache_entry *cache_entry;                                     //!< Cached symbols
+   unsigned long n_cache_entries;                                    //!< Number of the cached symbols
+   unsigned long cache_entries_capacity;                             //!< Allocated "cache_entry" items
+   char        *cache_data;                                          //!< Cached symbols and data
+   unsigned long cache_data_size;                                    //!< Used "cache_data" size [bytes]
+   unsigned long cache_data_capacity;                                //!< Allocated "cache_data" size [bytes]
+   unsigned long *cache_table;                                       //!< Hash table of the cached symbols ("cache_entry" index + 1, 0 if empty)
+   unsigned long cache_table_size;                                   //!< Number of the "cache_table" items (power of two)
+   bool        cache_modified;                                       //!< Flag to say new symbols have been cached since "open"
+   bool        cache_frozen;                                         //!< Flag to say the cache is read only ("FreezeCache")
+   static bool cache_enabled;                                        //!< Flag to enable the binary cache (shared by all the input files)
    bool        enable_tokenizer;                                     //!< Flag to Enable/Inhibit the input line tokenization
    bool        outside_square_brackets;                              //!< Flag to notify searching outside the data body
 
@@ -68,6 +147,10 @@ public:
    ~InputFile ();
 /** Public Method to open the <b>Models Input Text File</b>; if the input file name is not provided the default [dss.set] is used */
    typ_return  open  (const char* filename = 0 /*! <b>Models Input Text File Name</b>; if it is not provided the default [dss.set] is used*/);
+/** Public Method to read an already loaded <b>Configuration Store</b> (a reference is held until "close") */
+   typ_return  attach (ConfigStore* config /*! <b>Configuration Store</b> to be read*/);
+/** Public Method returning the <b>Configuration Store</b> being read (NULL if the file is not open) */
+   inline ConfigStore* Get_Store () {return store;};
 /** Public Method to close the <b>Models Input Text File</b> */
    typ_return  close ();
 /** Public Method to load from the Models Input Text File an <b>Array of (double) Values</b> */
@@ -90,6 +173,14 @@ public:
    typ_return  readSymbol (const char* Symbol /*! <b>Data Name</b> to be found in the input file*/, int Ntokens /*! <b>Number of tokens</b> expected to be related to the provided Symbol */, bool mustexist=true /*! Logical flag to specify wether the data <b>is mandatory or is optional</b> */);
 /** Public Method to find in the Models Input Text File the provided <b>Symbol related to a specific Model</b>, to allocate and copy in the buffer the relevant content and to count the total number of the identified tokens in it*/
    typ_return  readSymbol (const char* ModelName /*! <b>Model Name</b> to be found in the input file (before dot)*/,const char* Symbol /*! <b>Data Name</b> to be found in the input file (after dot)*/, int Ntokens /*! <b>Number of tokens</b> expected to be related to the provided Symbol */, bool mustexist=true /*! Logical flag to specify wether the data <b>is mandatory or is optional</b> */);
+/** Public Function to load from the Models Input Text File a <b>Table of (double) Values</b> of unknown size, parsed straight into the caller array; it returns the <b>number of the loaded values</b> (0 if not found or on error) */
+   int         loadTable (double v[] /*! double <b>Array to be Loaded</b> */, const char* VarName /*! <b>Data Name</b> to be found in the input file*/, int MaxSize /*! <b>Array Size</b>, i.e. the maximum number of values */, int n_columns = 1 /*! <b>Number of Columns</b>: the number of values shall be an integer multiple of it */, bool mustexist=true /*! Logical flag to specify wether the data <b>is mandatory or is optional</b> */);
+/** Public Function to load from the Models Input Text File a <b>Table of (double) Values related to a specific Model</b>; it returns the <b>number of the loaded values</b> (0 if not found or on error) */
+   int         loadTable (double v[] /*! double <b>Array to be Loaded</b> */, const char* ModelName /*! <b>Model Name</b> to be found in the input file (before dot)*/, const char* VarName /*! <b>Data Name</b> to be found in the input file (after dot)*/, int MaxSize /*! <b>Array Size</b>, i.e. the maximum number of values */, int n_columns = 1 /*! <b>Number of Columns</b>: the number of values shall be an integer multiple of it */, bool mustexist=true /*! Logical flag to specify wether the data <b>is mandatory or is optional</b> */);
+/** Public Function to load from the Models Input Text File a <b>Table of (integer) Values</b> of unknown size, parsed straight into the caller array; it returns the <b>number of the loaded values</b> (0 if not found or on error) */
+   int         loadTable (int v[] /*! integer <b>Array to be Loaded</b> */, const char* VarName /*! <b>Data Name</b> to be found in the input file*/, int MaxSize /*! <b>Array Size</b>, i.e. the maximum number of values */, int n_columns = 1 /*! <b>Number of Columns</b>: the number of values shall be an integer multiple of it */, bool mustexist=true /*! Logical flag to specify wether the data <b>is mandatory or is optional</b> */);
+/** Public Function to load from the Models Input Text File a <b>Table of (integer) Values related to a specific Model</b>; it returns the <b>number of the loaded values</b> (0 if not found or on error) */
+   int         loadTable (int v[] /*! integer <b>Array to be Loaded</b> */, const char* ModelName /*! <b>Model Name</b> to be found in the input file (before dot)*/, const char* VarName /*! <b>Data Name</b> to be found in the input file (after dot)*/, int MaxSize /*! <b>Array Size</b>, i.e. the maximum number of values */, int n_columns = 1 /*! <b>Number of Columns</b>: the number of values shall be an integer multiple of it */, bool mustexist=true /*! Logical flag to specify wether the data <b>is mandatory or is optional</b> */);
 /** Public Function to return the <b>Number of Rows</b> assuming the provided <b>Symbol</b> identifies a Matrix having the provided number of columns (it shall be: GetRowsNumber * n_columns = Ntokens) */
    int         GetRowsNumber (const char* Symbol /*! <b>Matrix Data Name</b> to be found in the input file*/, int n_columns /*! <b>Number of Columns</b> in the Symbol Matrix*/);
 /** Public Function to return the <b>Number of Rows</b> assuming the provided <b>Symbol related to a specific Model</b> identifies a Matrix having the provided number of columns (it shall be: GetRowsNumber * n_columns = Ntokens) */
@@ -98,11 +189,45 @@ public:
    inline void EnableLineTokenizer () {enable_tokenizer = true;};
 /** Public Method to Disable the instruction lines tokenization, i.e. to acquire each input line as a single token */
    inline void DisableLineTokenizer () {enable_tokenizer = false;};
+/** Public Method to Enable/Disable the <b>binary cache</b> of the parsed symbols ("<input file>.cache") for the input files open afterwards */
+   static inline void EnableCache (bool enable /*! true to enable the binary cache*/) {cache_enabled = enable;};
+/** Public Method to use the <b>binary cache</b> read only: the cached symbols are used, but no new symbol is cached and the cache file is not rewritten at "close" */
+   inline void FreezeCache () {cache_frozen = true;};
 
 private:
 
 /** Private Method to read a new instruction from the Models Input Text File */
    typ_return  ReadLine ();
+/** Private Method to read the next character of the Models Input Text File (INPUTFILE_EOF past the end) */
+   inline char GetChar () {if (position < text_size) return text[position++]; end_of_file = true; return INPUTFILE_EOF;};
+/** Private Method to complete "open" and "attach" */
+   typ_return  Attach (ConfigStore* config);
+/** Private Method to move the reading position to the line of the provided <b>Symbol</b>, in the store layer defining it; it returns false if the symbol is not found */
+   bool        SeekSymbol (const char* Symbol /*! <b>Data Name</b> to be found in the input file*/);
+/** Private Method to find the provided <b>Symbol</b> in the input file and to copy in the buffer its tokens (not cached) */
+   typ_return  ReadSymbolText (const char* Symbol, int Ntokens, bool mustexist);
+/** Private Method returning the <b>cache entry</b> of a symbol (NULL if not cached) */
+   const typ_cache_entry* CacheFind (typ_cache_kind kind, const char* Symbol, int Ntokens);
+/** Private Method to store a symbol in the cache */
+   void        CacheStore (typ_cache_kind kind, const char* Symbol, int Ntokens, bool found, const void* data, unsigned int size);
+/** Private Method to load a typed array from the cache; it returns false if the array has to be read from the input file */
+   bool        CacheLoad (typ_cache_kind kind, const char* Symbol, void* v, int VarSize, unsigned int item_size, bool mustexist, typ_return &found);
+/** Private Method to rebuild the hash table of the cached symbols */
+   void        CacheIndex ();
+/** Private Method to check a cache entry read from a cache file: symbol and data within the cache data, data size of its kind */
+   bool        CacheCheck (const typ_cache_entry &entry /*! <b>Cache entry</b>*/) const;
+/** Private Method to read the cache file, if valid for the open input file */
+   void        CacheRead ();
+/** Private Method to write the cache file (only if new symbols have been cached) */
+   void        CacheWrite ();
+/** Private Method to release the cache */
+   void        CacheFree ();
+/** Private Method serving "loadTable": either "dv" or "iv" is the array to be loaded */
+   int         LoadTable (const char* Symbol, double* dv, int* iv, int MaxSize, int n_columns, bool mustexist);
+/** Private Method returning the next token of the Models Input Text File from the reading position ("=", "[", "]" or a value), NULL at the end of file */
+   const char* ScanToken (unsigned long &length /*! <b>Length</b> of the returned token*/);
+/** Private Method to convert a <b>real number</b> token (C locale, whatever the process locale is); it returns false if the token is not a real number */
+   static bool ParseReal (const char* token /*! Token (not NUL-terminated)*/, unsigned long length /*! Token length*/, double &value /*! <b>Converted value</b>*/);
 /** Private Method to update the <b>token pointer [c]</b> to the next token found in the Models Input Text File */
    typ_return  GetArrayToken (char*& c /*! pointer to the <b>current token</b> updated to the next available one by this method */);
 
@@ -0,0 +1,161 @@
+/******************************************************************************
+
+    PROJECT:      DSS - S/C Dynamics Simulation Software
+    FILE:         LZCodec.cpp
+    RELEASE:      0.01
+    AUTHOR:       DSS Team
+    DATE:         2026/10/19
+
+    OVERVIEW
+    ========
+    Source Code for the LZ Codec
+
+    CHANGE LOG
+    ==========
+
+******************************************************************************/
+
+#include <string.h>
+#include "LZCodec.h"
+
+//-------------------------------------------------------------------------
+static inline unsigned int Read_32 (const unsigned char *p)
+//-------------------------------------------------------------------------
+{
+   unsigned int   v;
+
+   memcpy (&v, p, sizeof(v));
+   return v;
+}
+
+//-------------------------------------------------------------------------
+static inline unsigned int Hash_32 (unsigned int v)
+//-------------------------------------------------------------------------
+{
+   return (v * 2654435761u) >> (32 - LZ_CODEC_HASH_BITS);
+}
+
+//-------------------------------------------------------------------------
+unsigned char* LZCodec::Put_Sequence (unsigned char *output, const unsigned char *output_end, const unsigned char *literals, int literals_length, int offset, int match_length)
+//-------------------------------------------------------------------------
+{
+   unsigned char  *token = output++;
+   int            n;
+
+// Token and literals (the worst case length bytes are checked together with the literals)
+   if (output + literals_length + literals_length/255 + 1 + (match_length ? 2 + match_length/255 + 1 : 0) > output_end)
+      return NULL;
+   *token = (unsigned char) ((literals_length < 15 ? literals_length : 15) << 4);
+   if (literals_length >= 15)
+   {
+      for (n = literals_length - 15; n >= 255; n -= 255)
+         *output++ = 255;
+      *output++ = (unsigned char) n;
+   }
+   memcpy (output, literals, literals_length);
+   output += literals_length;
+   if (!match_length)
+      return output;
+
+// Offset and match length
+   *output++ = (unsigned char) offset;
+   *output++ = (unsigned char) (offset >> 8);
+   match_length -= LZ_CODEC_MIN_MATCH;
+   *token |= (unsigned char) (match_length < 15 ? match_length : 15);
+   if (match_length >= 15)
+   {
+      for (n = match_length - 15; n >= 255; n -= 255)
+         *output++ = 255;
+      *output++ = (unsigned char) n;
+   }
+   return output;
+}
+
+//-------------------------------------------------------------------------
+int LZCodec::Compress (unsigned char *output, int output_size, const unsigned char *input, int input_size)
+//-------------------------------------------------------------------------
+{
+   int                  table[1 << LZ_CODEC_HASH_BITS], position = 0, anchor = 0, reference, length, h;
+   unsigned int         v;
+   unsigned char        *out = output;
+   const unsigned char  *out_end = output + output_size;
+
+   memset (table, 0xFF, sizeof(table)); // No previous position (-1)
+
+// Single-probe match finder: each position replaces the previous one with the same hash
+   while (position + LZ_CODEC_MIN_MATCH <= input_size)
+   {
+      v         = Read_32 (input + position);
+      h         = Hash_32 (v);
+      reference = table[h];
+      table[h]  = position;
+      if (reference < 0 || position - reference > LZ_CODEC_MAX_OFFSET || Read_32 (input + reference) != v)
+      {
+         position += 1 + ((position - anchor) >> 6); // Faster skip through the non-compressible data
+         continue;
+      }
+      for (length = LZ_CODEC_MIN_MATCH; position + length < input_size && input[reference + length] == input[position + length]; length++)
+         ;
+      out = Put_Sequence (out, out_end, input + anchor, position - anchor, position - reference, length);
+      if (!out)
+         return 0;
+      position += length;
+      anchor    = position;
+   }
+
+// The remaining bytes are the literals of the last sequence
+   out = Put_Sequence (out, out_end, input + anchor, input_size - anchor, 0, 0);
+   return out ? (int) (out - output) : 0;
+}
+
+//-------------------------------------------------------------------------
+int LZCodec::Decompress (unsigned char *output, int output_size, const unsigned char *input, int input_size)
+//-------------------------------------------------------------------------
+{
+   const unsigned char  *in = input, *in_end = input + input_size;
+   int                  out = 0, length, offset, n;
+
+   while (in < in_end)
+   {
+// Literals
+      length = *in >> 4;
+      n      = *in++ & 15;
+      if (length == 15)
+         do
+         {
+            if (in >= in_end)
+               return -1;
+            length += *in;
+         } while (*in++ == 255);
+      if (length > in_end - in || length > output_size - out)
+         return -1;
+      memcpy (output + out, in, length);
+      in  += length;
+      out += length;
+      if (in == in_end) // Last sequence
+         return out;
+
+// Match, possibly overlapping the bytes it produces
+      if (in_end - in < 2)
+         return -1;
+      offset = in[0] | (in[1] << 8);
+      in    += 2;
+      length = n + LZ_CODEC_MIN_MATCH;
+      if (n == 15)
+         do
+         {
+            if (in >= in_end)
+               return -1;
+            length += *in;
+         } while (*in++ == 255);
+      if (offset == 0 || offset > out || length > output_size - out)
+         return -1;
+      if (offset >= length)
+         memcpy (output + out, output + out - offset, length);
+      else
+         for (n = 0; n < length; n++)
+            output[out + n] = output[out + n - offset];
+      out += length;
+   }
+   return -1; // The last sequence has literals only
+}
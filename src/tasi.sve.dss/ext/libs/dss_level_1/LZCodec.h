@@ -0,0 +1,59 @@
+#if !defined(__LZCodec_h) // Use file only if it's not already included.
+#define __LZCodec_h
+
+/******************************************************************************
+
+    PROJECT:      DSS - S/C Dynamics Simulation Software
+    FILE:         LZCodec.h
+    RELEASE:      0.01
+    AUTHOR:       DSS Team
+    DATE:         2026/10/19
+
+    OVERVIEW
+    ========
+    Header file for the LZ Codec: fast byte-oriented LZ77 compression of
+    small buffers (e.g. the checkpoint blocks), in the LZ4 block layout.
+    Each sequence is a token (literals length and match length - 4, four
+    bits each, 15 meaning that more length bytes follow, 255 each plus the
+    last one), the literals, the 2-byte little endian match offset and the
+    additional match length bytes; the last sequence has literals only.
+    The matches are found by a single-probe hash table of the 4-byte
+    sequences, so compression runs at memory speed on repetitive data and
+    gives up quickly on random data. The decoder checks every length and
+    offset against the buffers, so a corrupted input is rejected.
+
+    CHANGE LOG
+    ==========
+
+******************************************************************************/
+
+#define  LZ_CODEC_HASH_BITS               11                            //!< Number of the bits of the <b>match finder</b> hash table index
+#define  LZ_CODEC_MAX_OFFSET              65535                         //!< Maximum <b>match distance</b>
+#define  LZ_CODEC_MIN_MATCH               4                             //!< Minimum <b>match length</b>
+
+/**
+* Class definition for the <b>LZ Codec</b>.
+*/
+
+class LZCodec
+{
+
+/*-------------------------------------------------------------------------
+   Function declarations
+-------------------------------------------------------------------------*/
+
+public:
+
+/** Static Public Method to <b>compress</b> a buffer. Returns the compressed size, 0 if it does not fit in the output buffer (e.g. not compressible)*/
+   static int                    Compress (unsigned char *output /*! out - <b>Compressed</b> data*/, int output_size /*! Size of the output buffer*/, const unsigned char *input /*! Data to be <b>compressed</b>*/, int input_size /*! Size of the data*/);
+/** Static Public Method to <b>decompress</b> a buffer. Returns the decompressed size, -1 if the input is corrupted or the output buffer is too small*/
+   static int                    Decompress (unsigned char *output /*! out - <b>Decompressed</b> data*/, int output_size /*! Size of the output buffer*/, const unsigned char *input /*! <b>Compressed</b> data*/, int input_size /*! Size of the compressed data*/);
+
+private:
+
+/** Static Private Method writing a <b>sequence</b> (literals, then a match if "match_length" is not 0). Returns the next output position, NULL if it does not fit*/
+   static unsigned char*         Put_Sequence (unsigned char *output, const unsigned char *output_end, const unsigned char *literals, int literals_length, int offset, int match_length);
+
+};
+
+#endif // __LZCodec_h end
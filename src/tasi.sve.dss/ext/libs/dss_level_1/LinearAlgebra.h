@@ -0,0 +1,303 @@
+#if !defined(__LinearAlgebra_h) // Use file only if it's not already included.
+#define __LinearAlgebra_h
+
+/******************************************************************************
+
+    PROJECT:      DSS - S/C Dynamics Simulation Software
+    FILE:         LinearAlgebra.h
+    RELEASE:      0.01
+    AUTHOR:       DSS Team
+    DATE:         2026/10/19
+
+    OVERVIEW
+    ========
+    Header-only fixed-size Linear Algebra templates of the Mathematical
+    Library: vectors "Vec<N>", row-major matrices "Mat<N,M>" (same layout
+    as the "double [N][M]" arrays of the Models) and quaternions "Quat"
+    (scalar component first, as in the MathLib functions).
+    The sizes are template parameters, so the kernels are fully unrolled
+    by the compiler; the matrix product kernel uses SSE2 where available
+    (define DSS_SCALAR_MATH to force the scalar code).
+    The SSE2 kernels compute two independent outputs per instruction and
+    keep the scalar summation order, so their results are the same as the
+    scalar code ones.
+    The existing arrays are used in place through "View":
+
+       Vec3::View (w_unit) = Mat3::View (BRF2UNIT) * Vec3::View (w_brf);
+
+    CHANGE LOG
+    ==========
+
+******************************************************************************/
+
+#include <string.h>
+#include <math.h>
+
+#if defined(__SSE2__) && !defined(DSS_SCALAR_MATH)
+   #include <emmintrin.h>
+   #define DSS_SSE2_MATH                                                //!< SSE2 kernels enabled
+#endif
+
+/**
+* Matrix product <b>kernel</b>: c (NxK) = a (NxM) * b (MxK), row-major arrays; c shall not overlap a or b.
+*/
+
+template <int N, int M, int K>
+struct Mat_Kernel
+{
+   static inline void Product (double *c, const double *a, const double *b)
+   {
+      int i, j, k;
+#if defined(DSS_SSE2_MATH)
+      __m128d acc;
+
+      if (K >= 2) // Two columns of a row of c at a time
+         for (i = 0; i < N; i++)
+         {
+            for (j = 0; j+1 < K; j += 2)
+            {
+               acc = _mm_mul_pd (_mm_set1_pd (a[i*M]), _mm_loadu_pd (b + j));
+               for (k = 1; k < M; k++)
+                  acc = _mm_add_pd (acc, _mm_mul_pd (_mm_set1_pd (a[i*M+k]), _mm_loadu_pd (b + k*K+j)));
+               _mm_storeu_pd (c + i*K+j, acc);
+            }
+            if (K & 1)
+            {
+               c[i*K+K-1] = a[i*M] * b[K-1];
+               for (k = 1; k < M; k++)
+                  c[i*K+K-1] += a[i*M+k] * b[k*K+K-1];
+            }
+         }
+      else // Column vector: two rows of c at a time
+      {
+         for (i = 0; i+1 < N; i += 2)
+         {
+            acc = _mm_mul_pd (_mm_set_pd (a[(i+1)*M], a[i*M]), _mm_set1_pd (b[0]));
+            for (k = 1; k < M; k++)
+               acc = _mm_add_pd (acc, _mm_mul_pd (_mm_set_pd (a[(i+1)*M+k], a[i*M+k]), _mm_set1_pd (b[k])));
+            _mm_storeu_pd (c + i, acc);
+         }
+         if (N & 1)
+         {
+            c[N-1] = a[(N-1)*M] * b[0];
+            for (k = 1; k < M; k++)
+               c[N-1] += a[(N-1)*M+k] * b[k];
+         }
+      }
+#else
+      for (i = 0; i < N; i++)
+         for (j = 0; j < K; j++)
+         {
+            c[i*K+j] = a[i*M] * b[j];
+            for (k = 1; k < M; k++)
+               c[i*K+j] += a[i*M+k] * b[k*K+j];
+         }
+#endif
+   }
+};
+
+/**
+* Fixed-size <b>vector</b> of N doubles.
+*/
+
+template <int N>
+struct Vec
+{
+   enum {Size = N};                          //!< Number of the elements
+
+   double v[N];                              //!< Elements
+
+   inline Vec ()                                       {}
+   explicit inline Vec (const double *a)               {memcpy (v, a, sizeof(v));}
+/** Constructor of a 3 elements vector*/
+   inline Vec (double x, double y, double z)           {v[0] = x; v[1] = y; v[2] = z;}
+
+/** Vector of the provided array, used in place (no copy)*/
+   static inline Vec&         View (double *a)         {return *reinterpret_cast<Vec*> (a);}
+   static inline const Vec&   View (const double *a)   {return *reinterpret_cast<const Vec*> (a);}
+   static inline Vec          Zero ()                  {Vec r; memset (r.v, '\0', sizeof(r.v)); return r;}
+
+   inline double&             operator[] (int i)       {return v[i];}
+   inline const double&       operator[] (int i) const {return v[i];}
+   inline void                Store (double *a) const  {memcpy (a, v, sizeof(v));}
+
+   inline Vec operator+ (const Vec &b) const {Vec r; for (int i = 0; i < N; i++) r.v[i] = v[i] + b.v[i]; return r;}
+   inline Vec operator- (const Vec &b) const {Vec r; for (int i = 0; i < N; i++) r.v[i] = v[i] - b.v[i]; return r;}
+   inline Vec operator* (double s)     const {Vec r; for (int i = 0; i < N; i++) r.v[i] = v[i] * s;      return r;}
+
+/** Dot product*/
+   inline double Dot (const Vec &b) const {double r = v[0] * b.v[0]; for (int i = 1; i < N; i++) r += v[i] * b.v[i]; return r;}
+/** Euclidean norm*/
+   inline double Norm ()            const {return sqrt (Dot (*this));}
+/** Normalization in "r"; false (and "r" set to zero) if the norm is less than 1.E-14*/
+   inline bool Normalize (Vec &r)   const
+   {
+      double module = Norm ();
+      if (module < 1.E-14)
+      {
+         r = Zero ();
+         return false;
+      }
+      for (int i = 0; i < N; i++)
+         r.v[i] = v[i] / module;
+      return true;
+   }
+};
+
+/**
+* Fixed-size row-major <b>matrix</b> of NxM doubles.
+*/
+
+template <int N, int M>
+struct Mat
+{
+   enum {Rows = N, Cols = M, Size = N*M};    //!< Number of the rows, of the columns and of the elements
+
+   double m[N][M];                           //!< Elements, row-major
+
+   inline Mat ()                                       {}
+   explicit inline Mat (const double *a)               {memcpy (m, a, sizeof(m));}
+
+/** Matrix of the provided array, used in place (no copy)*/
+   static inline Mat&         View (double *a)         {return *reinterpret_cast<Mat*> (a);}
+   static inline const Mat&   View (const double *a)   {return *reinterpret_cast<const Mat*> (a);}
+   static inline Mat&         View (double a[N][M])    {return *reinterpret_cast<Mat*> (a);}
+   static inline Mat          Zero ()                  {Mat r; memset (r.m, '\0', sizeof(r.m)); return r;}
+   static inline Mat          Identity ()              {Mat r = Zero (); for (int i = 0; i < N && i < M; i++) r.m[i][i] = 1.; return r;}
+
+   inline double*             operator[] (int i)       {return m[i];}
+   inline const double*       operator[] (int i) const {return m[i];}
+   inline void                Store (double *a) const  {memcpy (a, m, sizeof(m));}
+
+   inline Mat operator+ (const Mat &b) const {Mat r; for (int i = 0; i < N*M; i++) r.m[0][i] = m[0][i] + b.m[0][i]; return r;}
+   inline Mat operator- (const Mat &b) const {Mat r; for (int i = 0; i < N*M; i++) r.m[0][i] = m[0][i] - b.m[0][i]; return r;}
+   inline Mat operator* (double s)     const {Mat r; for (int i = 0; i < N*M; i++) r.m[0][i] = m[0][i] * s;         return r;}
+
+/** Matrix product*/
+   template <int K>
+   inline Mat<N,K> operator* (const Mat<M,K> &b) const {Mat<N,K> r; Mat_Kernel<N,M,K>::Product (r.m[0], m[0], b.m[0]); return r;}
+/** Matrix-vector product*/
+   inline Vec<N>   operator* (const Vec<M> &b)   const {Vec<N>   r; Mat_Kernel<N,M,1>::Product (r.v,    m[0], b.v);    return r;}
+
+/** Transposed matrix*/
+   inline Mat<M,N> Transposed () const {Mat<M,N> r; for (int i = 0; i < N; i++) for (int j = 0; j < M; j++) r.m[j][i] = m[i][j]; return r;}
+};
+
+typedef Vec<3>    Vec3;                      //!< 3 elements vector
+typedef Mat<3,3>  Mat3;                      //!< 3x3 matrix (e.g. rotation matrix)
+
+/** Cross product of 3 elements vectors*/
+inline Vec3 Cross (const Vec3 &a, const Vec3 &b)
+{
+   return Vec3 (a.v[1] * b.v[2] - a.v[2] * b.v[1],
+                a.v[2] * b.v[0] - a.v[0] * b.v[2],
+                a.v[0] * b.v[1] - a.v[1] * b.v[0]);
+}
+
+/** Determinant of a 3x3 matrix*/
+inline double Det (const Mat3 &a)
+{
+   return   a.m[0][0] * a.m[1][1] * a.m[2][2] - a.m[0][0] * a.m[1][2] * a.m[2][1]
+          - a.m[1][0] * a.m[0][1] * a.m[2][2] + a.m[0][1] * a.m[1][2] * a.m[2][0]
+          + a.m[1][0] * a.m[2][1] * a.m[0][2] - a.m[0][2] * a.m[2][0] * a.m[1][1];
+}
+
+/** Inverse of a 3x3 matrix in "r"; false (and "r" set to zero) if the determinant is less than 1.E-14*/
+inline bool Inverse (Mat3 &r, const Mat3 &a)
+{
+   double det = Det (a);
+
+   if (det < 1.E-14)
+   {
+      r = Mat3::Zero ();
+      return false;
+   }
+   r.m[0][0]= (a.m[2][2]*a.m[1][1]-a.m[2][1]*a.m[1][2]) / det;
+   r.m[0][1]=-(a.m[2][2]*a.m[0][1]-a.m[2][1]*a.m[0][2]) / det;
+   r.m[0][2]= (a.m[1][2]*a.m[0][1]-a.m[1][1]*a.m[0][2]) / det;
+   r.m[1][0]=-(a.m[2][2]*a.m[1][0]-a.m[2][0]*a.m[1][2]) / det;
+   r.m[1][1]= (a.m[2][2]*a.m[0][0]-a.m[2][0]*a.m[0][2]) / det;
+   r.m[1][2]=-(a.m[1][2]*a.m[0][0]-a.m[1][0]*a.m[0][2]) / det;
+   r.m[2][0]= (a.m[2][1]*a.m[1][0]-a.m[2][0]*a.m[1][1]) / det;
+   r.m[2][1]=-(a.m[2][1]*a.m[0][0]-a.m[2][0]*a.m[0][1]) / det;
+   r.m[2][2]= (a.m[1][1]*a.m[0][0]-a.m[1][0]*a.m[0][1]) / det;
+   return true;
+}
+
+/**
+* <b>Quaternion</b>, q[0] is the scalar component.
+*/
+
+struct Quat
+{
+   double q[4];                              //!< Components, scalar first
+
+   inline Quat ()                                      {}
+   explicit inline Quat (const double *a)              {memcpy (q, a, sizeof(q));}
+   inline Quat (double q0, double q1, double q2, double q3) {q[0] = q0; q[1] = q1; q[2] = q2; q[3] = q3;}
+
+/** Quaternion of the provided array, used in place (no copy)*/
+   static inline Quat&        View (double *a)         {return *reinterpret_cast<Quat*> (a);}
+   static inline const Quat&  View (const double *a)   {return *reinterpret_cast<const Quat*> (a);}
+
+   inline double&             operator[] (int i)       {return q[i];}
+   inline const double&       operator[] (int i) const {return q[i];}
+   inline void                Store (double *a) const  {memcpy (a, q, sizeof(q));}
+
+/** Conjugate (inverse of a unit quaternion)*/
+   inline Quat    Conjugate ()  const {return Quat (q[0], -q[1], -q[2], -q[3]);}
+/** Norm*/
+   inline double  Norm ()       const {return sqrt (q[0]*q[0] + q[1]*q[1] + q[2]*q[2] + q[3]*q[3]);}
+/** Unit quaternion (the input is not checked against a zero norm, as in the MathLib functions)*/
+   inline Quat    Normalized () const {double n = Norm (); return Quat (q[0] / n, q[1] / n, q[2] / n, q[3] / n);}
+
+/** Rotation matrix Fixed->Body of the (unit) quaternion Fixed->Body*/
+   inline Mat3 Rotation () const
+   {
+      Mat3 r;
+      r.m[0][0] = q[0]*q[0] + q[1]*q[1] - q[2]*q[2] - q[3]*q[3];
+      r.m[0][1] = 2.*( q[1]*q[2] + q[3]*q[0]);
+      r.m[0][2] = 2.*( q[1]*q[3] - q[2]*q[0]);
+      r.m[1][0] = 2.*( q[1]*q[2] - q[3]*q[0]);
+      r.m[1][1] = q[0]*q[0] - q[1]*q[1] + q[2]*q[2] - q[3]*q[3];
+      r.m[1][2] = 2.*( q[1]*q[0] + q[2]*q[3]);
+      r.m[2][0] = 2.*( q[1]*q[3] + q[2]*q[0]);
+      r.m[2][1] = 2.*(-q[1]*q[0] + q[2]*q[3]);
+      r.m[2][2] = q[0]*q[0] - q[1]*q[1] - q[2]*q[2] + q[3]*q[3];
+      return r;
+   }
+
+/** Composition: rotation "first" followed by rotation "second"*/
+   static inline Quat Compose (const Quat &first, const Quat &second)
+   {
+      Quat           r;
+      const double   *a = first.q, *b = second.q;
+#if defined(DSS_SSE2_MATH)
+      // r = a[0]*(b0, b1, b2, b3) + a[1]*(-b1, b0, -b3, b2) + a[2]*(-b2, b3, b0, -b1) + a[3]*(-b3, -b2, b1, b0)
+      __m128d  b01 = _mm_loadu_pd (b), b23 = _mm_loadu_pd (b + 2);
+      __m128d  b10 = _mm_shuffle_pd (b01, b01, 1), b32 = _mm_shuffle_pd (b23, b23, 1);
+      __m128d  neg_lo = _mm_set_pd (0., -0.), neg_hi = _mm_set_pd (-0., 0.), neg = _mm_set1_pd (-0.);
+      __m128d  a0 = _mm_set1_pd (a[0]), a1 = _mm_set1_pd (a[1]), a2 = _mm_set1_pd (a[2]), a3 = _mm_set1_pd (a[3]);
+      __m128d  lo, hi;
+
+      lo = _mm_mul_pd (a0, b01);
+      hi = _mm_mul_pd (a0, b23);
+      lo = _mm_add_pd (lo, _mm_mul_pd (a1, _mm_xor_pd (b10, neg_lo)));
+      hi = _mm_add_pd (hi, _mm_mul_pd (a1, _mm_xor_pd (b32, neg_lo)));
+      lo = _mm_add_pd (lo, _mm_mul_pd (a2, _mm_xor_pd (b23, neg_lo)));
+      hi = _mm_add_pd (hi, _mm_mul_pd (a2, _mm_xor_pd (b01, neg_hi)));
+      lo = _mm_add_pd (lo, _mm_mul_pd (a3, _mm_xor_pd (b32, neg)));
+      hi = _mm_add_pd (hi, _mm_mul_pd (a3, b10));
+      _mm_storeu_pd (r.q, lo);
+      _mm_storeu_pd (r.q + 2, hi);
+#else
+      r.q[0] = b[0]*a[0] - b[1]*a[1] - b[2]*a[2] - b[3]*a[3];
+      r.q[1] = b[1]*a[0] + b[0]*a[1] + b[3]*a[2] - b[2]*a[3];
+      r.q[2] = b[2]*a[0] - b[3]*a[1] + b[0]*a[2] + b[1]*a[3];
+      r.q[3] = b[3]*a[0] + b[2]*a[1] - b[1]*a[2] + b[0]*a[3];
+#endif
+      return r;
+   }
+};
+
+#endif // __LinearAlgebra_h end
@@ -0,0 +1,298 @@
+/******************************************************************************
+
+    PROJECT:      DSS - S/C Dynamics Simulation Software
+    FILE:         LogBackend.cpp
+    RELEASE:      0.01
+    AUTHOR:       DSS Team
+    DATE:         2026/10/19
+
+    OVERVIEW
+    ========
+    Source Code for the asynchronous Log Backend
+
+    CHANGE LOG
+    ==========
+
+******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sched.h>
+#include <sys/time.h>
+#include "LogBackend.h"
+
+// Static Data Initialization
+
+LogBackend*                LogBackend::Active                 = NULL;
+unsigned long              LogBackend::Generations            = 0;
+__thread LogBackend::typ_Ring* LogBackend::Thread_Ring        = NULL;
+__thread unsigned long     LogBackend::Thread_Ring_Generation = 0;
+struct sigaction           LogBackend::Previous_Action[32];
+
+static const int           Crash_Signals[] = {SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT};
+
+//-------------------------------------------------------------------------
+LogBackend::LogBackend (FILE *log_file, typ_flush_policy flush_policy, double flush_period_s)
+//-------------------------------------------------------------------------
+{
+   struct sigaction  action;
+   unsigned int      i;
+
+   fflush (log_file); // The lines already written by the stream go first
+   fd            = fileno (log_file);
+   policy        = flush_policy;
+   flush_period  = flush_period_s > 0.0 ? flush_period_s : 0.1;
+   rings         = NULL;
+   next_sequence = 0;
+   generation    = __atomic_add_fetch (&Generations, 1, __ATOMIC_RELAXED);
+   draining      = 0;
+   buffered      = 0;
+   buffer        = new char [LOG_WRITE_BUFFER_SIZE];
+   pthread_mutex_init (&wake_mutex, NULL);
+   pthread_cond_init  (&wake_condition, NULL);
+
+// Start the writer thread
+   running = 1;
+   if (!buffer || pthread_create (&writer, NULL, Writer_Thread, this))
+   {
+      running = 0;
+      return;
+   }
+
+// Install the crash handler
+   Active = this;
+   memset (&action, '\0', sizeof(action));
+   action.sa_handler = Crash_Handler;
+   sigemptyset (&action.sa_mask);
+   action.sa_flags   = SA_RESETHAND;
+   for (i = 0; i < sizeof(Crash_Signals)/sizeof(int); i++)
+      sigaction (Crash_Signals[i], &action, &Previous_Action[Crash_Signals[i]]);
+}
+
+//-------------------------------------------------------------------------
+LogBackend::~LogBackend ()
+//-------------------------------------------------------------------------
+{
+   typ_Ring    *ring;
+   unsigned int i;
+
+// Stop the writer thread, which writes all the queued records before exiting
+   if (running)
+   {
+      pthread_mutex_lock (&wake_mutex);
+      __atomic_store_n (&running, 0, __ATOMIC_RELEASE);
+      pthread_cond_signal (&wake_condition);
+      pthread_mutex_unlock (&wake_mutex);
+      pthread_join (writer, NULL);
+
+// Restore the previous signal actions
+      Active = NULL;
+      for (i = 0; i < sizeof(Crash_Signals)/sizeof(int); i++)
+         sigaction (Crash_Signals[i], &Previous_Action[Crash_Signals[i]], NULL);
+   }
+
+// Delete the rings
+   while ((ring = rings))
+   {
+      rings = ring->next;
+      delete ring;
+   }
+   if (buffer)
+      delete [] buffer;
+   pthread_cond_destroy  (&wake_condition);
+   pthread_mutex_destroy (&wake_mutex);
+}
+
+//-------------------------------------------------------------------------
+LogBackend::typ_Ring* LogBackend::Get_Thread_Ring ()
+//-------------------------------------------------------------------------
+{
+   typ_Ring    *ring;
+
+   if (Thread_Ring && Thread_Ring_Generation == generation)
+      return Thread_Ring;
+
+// First record logged by this thread: allocate its ring and link it to the rings list
+   ring = new typ_Ring;
+   if (!ring)
+      return NULL;
+   ring->head = ring->tail = 0;
+   ring->next = __atomic_load_n (&rings, __ATOMIC_ACQUIRE);
+   while (!__atomic_compare_exchange_n (&rings, &ring->next, ring, false, __ATOMIC_RELEASE, __ATOMIC_ACQUIRE))
+      ;
+   Thread_Ring            = ring;
+   Thread_Ring_Generation = generation;
+   return ring;
+}
+
+//-------------------------------------------------------------------------
+void LogBackend::Push (typ_level level, double epoch, const char *text)
+//-------------------------------------------------------------------------
+{
+   typ_Ring       *ring = Get_Thread_Ring ();
+   typ_Record     *record;
+   unsigned long  tail;
+
+   if (!ring)
+      return;
+
+// Wait for a free record, waking up the writer, if the ring is full
+   tail = ring->tail;
+   while (tail - __atomic_load_n (&ring->head, __ATOMIC_ACQUIRE) >= LOG_RING_SIZE)
+   {
+      pthread_mutex_lock (&wake_mutex);
+      pthread_cond_signal (&wake_condition);
+      pthread_mutex_unlock (&wake_mutex);
+      sched_yield ();
+   }
+
+   record           = ring->record + (tail & (LOG_RING_SIZE-1));
+   record->sequence = __atomic_fetch_add (&next_sequence, 1, __ATOMIC_RELAXED);
+   record->epoch    = epoch;
+   record->level    = level;
+   strncpy (record->text, text, LOG_RECORD_TEXT_SIZE-1);
+   record->text[LOG_RECORD_TEXT_SIZE-1] = '\0';
+   __atomic_store_n (&ring->tail, tail+1, __ATOMIC_RELEASE); // Publish the record to the writer
+
+// Wake up the writer when the ring is getting full, or at once if required by the flush policy
+   if (tail+1 - __atomic_load_n (&ring->head, __ATOMIC_ACQUIRE) >= LOG_RING_SIZE/2
+    || (policy == Flush_On_Warning && level >= Warning))
+   {
+      pthread_mutex_lock (&wake_mutex);
+      pthread_cond_signal (&wake_condition);
+      pthread_mutex_unlock (&wake_mutex);
+   }
+}
+
+//-------------------------------------------------------------------------
+int LogBackend::Drain ()
+//-------------------------------------------------------------------------
+{
+   typ_Ring       *ring, *oldest;
+   typ_Record     *record;
+   int            level = -1;
+
+// Merge the rings: the oldest available record among all the rings is taken first
+   for (;;)
+   {
+      oldest = NULL;
+      for (ring = __atomic_load_n (&rings, __ATOMIC_ACQUIRE); ring; ring = ring->next)
+         if (ring->head != __atomic_load_n (&ring->tail, __ATOMIC_ACQUIRE)
+          && (!oldest || ring->record[ring->head & (LOG_RING_SIZE-1)].sequence < oldest->record[oldest->head & (LOG_RING_SIZE-1)].sequence))
+            oldest = ring;
+      if (!oldest)
+         break;
+      record = oldest->record + (oldest->head & (LOG_RING_SIZE-1));
+      Format (record);
+      if (record->level > level)
+         level = record->level;
+      __atomic_store_n (&oldest->head, oldest->head+1, __ATOMIC_RELEASE); // Release the record to the logging thread
+   }
+   return level;
+}
+
+//-------------------------------------------------------------------------
+void LogBackend::Format (const typ_Record *record)
+//-------------------------------------------------------------------------
+{
+   int   length;
+
+   if (LOG_WRITE_BUFFER_SIZE - buffered < LOG_RECORD_TEXT_SIZE + 64)
+      Write_Buffer ();
+   switch (record->level)
+   {
+      case Raw:      length = snprintf (buffer+buffered, LOG_WRITE_BUFFER_SIZE-buffered, "%s", record->text); break;
+      case Message:  length = snprintf (buffer+buffered, LOG_WRITE_BUFFER_SIZE-buffered, "% 12.3f            : %s\n", record->epoch, record->text); break;
+      case Warning:  length = snprintf (buffer+buffered, LOG_WRITE_BUFFER_SIZE-buffered, "% 12.3f >> WARNING : %s\n", record->epoch, record->text); break;
+      default:       length = snprintf (buffer+buffered, LOG_WRITE_BUFFER_SIZE-buffered, "% 12.3f >> ERROR :   %s\n", record->epoch, record->text); break;
+   }
+   if (length > 0)
+      buffered += (length < LOG_WRITE_BUFFER_SIZE-buffered) ? length : LOG_WRITE_BUFFER_SIZE-buffered-1;
+}
+
+//-------------------------------------------------------------------------
+void LogBackend::Write_Buffer ()
+//-------------------------------------------------------------------------
+{
+   int      written = 0;
+   ssize_t  n;
+
+   while (written < buffered)
+   {
+      n = write (fd, buffer+written, buffered-written);
+      if (n <= 0)
+         break;
+      written += n;
+   }
+   buffered = 0;
+}
+
+//-------------------------------------------------------------------------
+void* LogBackend::Writer_Thread (void *backend)
+//-------------------------------------------------------------------------
+{
+   LogBackend        *log = (LogBackend*) backend;
+   struct timeval    now;
+   struct timespec   deadline;
+   double            last_flush, current;
+   int               level;
+   bool              stop = false;
+
+   gettimeofday (&now, NULL);
+   last_flush = now.tv_sec + 1.0e-6*now.tv_usec;
+   while (!stop)
+   {
+      stop = !__atomic_load_n (&log->running, __ATOMIC_ACQUIRE);
+
+// Drain the rings in one batch
+      while (__sync_lock_test_and_set (&log->draining, 1))
+         sched_yield ();
+      level = log->Drain ();
+      gettimeofday (&now, NULL);
+      current = now.tv_sec + 1.0e-6*now.tv_usec;
+      if (log->buffered
+       && (stop
+        || log->policy == Flush_Every_Batch
+        || (log->policy == Flush_On_Warning && level >= Warning)
+        || current - last_flush >= log->flush_period))
+      {
+         log->Write_Buffer ();
+         last_flush = current;
+      }
+      __sync_lock_release (&log->draining);
+
+// Wait for the next batch (woken up earlier when a ring is getting full)
+      if (!stop)
+      {
+         current += (log->policy == Flush_Every_Batch) ? 0.002 : log->flush_period;
+         deadline.tv_sec  = (time_t) current;
+         deadline.tv_nsec = (long) ((current - deadline.tv_sec) * 1.0e9);
+         pthread_mutex_lock (&log->wake_mutex);
+         if (__atomic_load_n (&log->running, __ATOMIC_ACQUIRE))
+            pthread_cond_timedwait (&log->wake_condition, &log->wake_mutex, &deadline);
+         pthread_mutex_unlock (&log->wake_mutex);
+      }
+   }
+   return NULL;
+}
+
+//-------------------------------------------------------------------------
+void LogBackend::Crash_Handler (int signal_number)
+//-------------------------------------------------------------------------
+{
+   LogBackend  *log = Active;
+   int         spin;
+
+// Drain the queued records (the writer is waited for a while, in case it is draining), then raise again the signal
+   if (log)
+   {
+      for (spin = 0; spin < 100000 && __sync_lock_test_and_set (&log->draining, 1); spin++)
+         sched_yield ();
+      log->Drain ();
+      log->Write_Buffer ();
+   }
+   if (signal_number >= 0 && signal_number < 32)
+      sigaction (signal_number, &Previous_Action[signal_number], NULL);
+   raise (signal_number);
+}
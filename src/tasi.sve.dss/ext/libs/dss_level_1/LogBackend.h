@@ -0,0 +1,143 @@
+#if !defined(__LogBackend_h) // Use file only if it's not already included.
+#define __LogBackend_h
+
+/******************************************************************************
+
+    PROJECT:      DSS - S/C Dynamics Simulation Software
+    FILE:         LogBackend.h
+    RELEASE:      0.01
+    AUTHOR:       DSS Team
+    DATE:         2026/10/19
+
+    OVERVIEW
+    ========
+    Header file for the asynchronous Log Backend.
+    The logging threads copy the (already built) message text into their own
+    lock-free single-producer/single-consumer ring buffer; a background writer
+    thread merges the rings in logging order, formats the Log File lines
+    (epoch and severity prefix) and writes them in batches, so that the
+    simulation thread does not perform any I/O system call while logging.
+    The flush policy says when the formatted batches are written to the file.
+    On SIGSEGV, SIGBUS, SIGFPE, SIGILL and SIGABRT a crash handler drains the
+    rings before the default signal action, so that the log is not lost.
+
+    CHANGE LOG
+    ==========
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <signal.h>
+#include <pthread.h>
+#include "GenericTypes.h"
+
+#define  LOG_RECORD_TEXT_SIZE             1024                          //!< Maximum length of a <b>logged message</b> (including the terminator)
+#define  LOG_RING_SIZE                    256                           //!< Number of the records of each <b>per-thread ring buffer</b> (power of two)
+#define  LOG_WRITE_BUFFER_SIZE            65536                         //!< Size of the <b>writer buffer</b> of the formatted lines
+
+/**
+* Class definition for the <b>asynchronous Log Backend</b>.
+*/
+
+class LogBackend
+{
+
+/*-------------------------------------------------------------------------
+   Data Type declarations
+-------------------------------------------------------------------------*/
+
+public:
+
+   enum typ_level       /** <b>Log record</b> type, defining the line format */
+   {
+      Raw = 0,                               //!< Raw text, written as it is (Log_Write)
+      Message,                               //!< Message (Log_Message)
+      Warning,                               //!< WARNING message (Log_Warning)
+      Error                                  //!< ERROR message (Log_Error)
+   };
+
+   enum typ_flush_policy   /** <b>Flush policy</b> of the formatted lines */
+   {
+      Flush_Every_Batch = 0,                 //!< The lines are written to the file at the end of each writer batch
+      Flush_Periodic,                        //!< The lines are written to the file when the flush period has elapsed (or the writer buffer is full)
+      Flush_On_Warning                       //!< As Flush_Periodic, but a batch containing a WARNING or an ERROR is written immediately
+   };
+
+private:
+
+   struct typ_Record    /** Data structure type to store a <b>log record</b> */
+   {
+      unsigned long     sequence;            //!< Global <b>logging order</b>
+      double            epoch;               //!< <b>Current Epoch</b> [s] when logged
+      int               level;               //!< <b>Log record</b> type
+      char              text[LOG_RECORD_TEXT_SIZE];   //!< Message text
+   };
+
+   struct typ_Ring      /** Data structure type to store a <b>per-thread ring buffer</b> */
+   {
+      unsigned long     head;                //!< Next record to be read (writer side)
+      unsigned long     tail;                //!< Next record to be written (logging thread side)
+      typ_Ring          *next;               //!< Next ring of the rings list
+      typ_Record        record[LOG_RING_SIZE];   //!< Ring records
+   };
+
+/*-------------------------------------------------------------------------
+   Data declarations
+-------------------------------------------------------------------------*/
+
+private:
+
+   int                        fd;                              //!<  Log File descriptor
+   typ_flush_policy           policy;                          //!<  Flush policy
+   double                     flush_period;                    //!<  Flush period [s] (Flush_Periodic and Flush_On_Warning policies)
+   typ_Ring                   *rings;                          //!<  List of the per-thread rings (lock-free insertion)
+   unsigned long              next_sequence;                   //!<  Logging order of the next record
+   unsigned long              generation;                      //!<  Backend instance identifier, used to invalidate the per-thread ring pointers
+   volatile int               running;                         //!<  Flag to keep the writer thread running
+   volatile int               draining;                        //!<  Spin flag owned by who is draining the rings (writer or crash handler)
+   pthread_t                  writer;                          //!<  Background writer thread
+   pthread_mutex_t            wake_mutex;                      //!<  Mutex of the writer wake-up condition
+   pthread_cond_t             wake_condition;                  //!<  Writer wake-up condition, signalled when a ring is getting full
+   char                       *buffer;                         //!<  Writer buffer of the formatted lines
+   int                        buffered;                        //!<  Number of the bytes in the writer buffer
+
+   static LogBackend          *Active;                         //!<  Backend the crash handler drains (NULL if none)
+   static unsigned long       Generations;                     //!<  Number of the created backend instances
+   static __thread typ_Ring   *Thread_Ring;                    //!<  Ring of the calling thread
+   static __thread unsigned long Thread_Ring_Generation;       //!<  Backend instance the ring of the calling thread belongs to
+   static struct sigaction    Previous_Action[32];             //!<  Signal actions replaced by the crash handler
+
+/*-------------------------------------------------------------------------
+   Function declarations
+-------------------------------------------------------------------------*/
+
+public:
+
+/** Class <b>Constructor</b>: it starts the writer thread on the provided file and installs the crash handler*/
+   LogBackend (FILE *log_file /*! Open <b>Log File</b>, it shall not be written directly until the backend is deleted*/, typ_flush_policy flush_policy = Flush_Every_Batch /*! <b>Flush policy</b>*/, double flush_period_s = 0.1 /*! Flush period [s]*/);
+/** Class <b>Destructor</b>: it stops the writer thread, after having written all the queued records, and removes the crash handler*/
+   ~LogBackend ();
+
+/** Public Method (thread-safe) to <b>queue a log record</b> of the calling thread; it blocks only when the thread ring is full*/
+   void                          Push (typ_level level /*! <b>Log record</b> type*/, double epoch /*! <b>Current Epoch</b> [s]*/, const char *text /*! Message text*/);
+/** Public Method to say whether the <b>writer thread</b> is running*/
+   inline bool                   Is_Running ()     {return running != 0;};
+
+private:
+
+/** Private Method returning the <b>ring of the calling thread</b>, allocated at the first call*/
+   typ_Ring*                     Get_Thread_Ring ();
+/** Private Method to move all the queued records, in logging order, into the writer buffer (written to the file when full). Returns the highest drained level, -1 if nothing has been drained*/
+   int                           Drain ();
+/** Private Method to format one record into the writer buffer*/
+   void                          Format (const typ_Record *record);
+/** Private Method to write the writer buffer into the file*/
+   void                          Write_Buffer ();
+/** Static Private Method implementing the <b>writer thread</b>*/
+   static void*                  Writer_Thread (void *backend);
+/** Static Private Method implementing the <b>crash handler</b>*/
+   static void                   Crash_Handler (int signal_number);
+
+};
+
+#endif // __LogBackend_h end
@@ -0,0 +1,357 @@
+/******************************************************************************
+
+    PROJECT:      DSS - S/C Dynamics Simulation Software
+    FILE:         LookupTable.cpp
+    RELEASE:      0.01
+    AUTHOR:       DSS Team
+    DATE:         2026/10/19
+
+    OVERVIEW
+    ========
+    Source Code for the Lookup Table
+
+    CHANGE LOG
+    ==========
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "LookupTable.h"
+#include "LinearAlgebra.h"
+#include "GenericObject.h"
+
+//-------------------------------------------------------------------------
+LookupTable::LookupTable ()
+//-------------------------------------------------------------------------
+{
+   memset (this, '\0', sizeof(LookupTable));
+}
+
+//-------------------------------------------------------------------------
+LookupTable::~LookupTable ()
+//-------------------------------------------------------------------------
+{
+   delete [] data;
+}
+
+//-------------------------------------------------------------------------
+typ_return LookupTable::Load (InputFile *reader, const char *model_name, const char *table_name, typ_interpolation interpolation_type, typ_bounds bounds_type)
+//-------------------------------------------------------------------------
+{
+   char        symbol[LINE_SIZE], axis_symbol[LINE_SIZE+8];
+   int         sizes[LOOKUP_TABLE_MAX_DIMENSIONS], dimensions, total, n, i;
+   const double *axes[LOOKUP_TABLE_MAX_DIMENSIONS];
+   double      *buffer;
+   typ_return  result = Nominal;
+
+   if (model_name)
+      snprintf (symbol, LINE_SIZE, "%s.%s", model_name, table_name);
+   else
+      snprintf (symbol, LINE_SIZE, "%s", table_name);
+
+// Number of the breakpoints of the axes provided (AXIS1, AXIS2, ...)
+   for (dimensions = 0, total = 1, n = 0; dimensions < LOOKUP_TABLE_MAX_DIMENSIONS; dimensions++)
+   {
+      sprintf (axis_symbol, "%s_AXIS%i", symbol, dimensions+1);
+      sizes[dimensions] = reader->GetRowsNumber (axis_symbol, 1);
+      if (sizes[dimensions] <= 0)
+         break;
+      total *= sizes[dimensions];
+      n     += sizes[dimensions];
+   }
+   if (!dimensions)
+   {
+      GenericObject::Log_Error ("LookupTable \"%s\" : breakpoints \"%s_AXIS1\" not found", symbol, symbol);
+      return Error;
+   }
+
+// Breakpoints and values, then checked and copied by "Set"
+   buffer = new double[n + total];
+   for (i = n = 0; i < dimensions && result == Nominal; n += sizes[i++])
+   {
+      sprintf (axis_symbol, "%s_AXIS%i", symbol, i+1);
+      axes[i] = buffer + n;
+      if (reader->loadTable (buffer + n, axis_symbol, sizes[i]) != sizes[i])
+         result = Error;
+   }
+   if (result == Nominal && reader->loadTable (buffer + n, symbol, total) != total)
+   {
+      GenericObject::Log_Error ("LookupTable \"%s\" : %i values are expected", symbol, total);
+      result = Error;
+   }
+   if (result == Nominal)
+      result = Set (dimensions, sizes, axes, buffer + n, interpolation_type, bounds_type);
+   delete [] buffer;
+   return result;
+}
+
+//-------------------------------------------------------------------------
+typ_return LookupTable::Set (int dimensions, const int sizes[], const double *axes[], const double table_values[], typ_interpolation interpolation_type, typ_bounds bounds_type)
+//-------------------------------------------------------------------------
+{
+   int   i, j, n, total;
+
+   if (dimensions < 1 || dimensions > LOOKUP_TABLE_MAX_DIMENSIONS)
+   {
+      GenericObject::Log_Error ("LookupTable : %i variables not allowed [1..%i]", dimensions, LOOKUP_TABLE_MAX_DIMENSIONS);
+      return Error;
+   }
+   for (i = n = 0, total = 1; i < dimensions; i++)
+   {
+      if (sizes[i] < 2)
+      {
+         GenericObject::Log_Error ("LookupTable : axis %i shall have at least 2 breakpoints", i+1);
+         return Error;
+      }
+      for (j = 1; j < sizes[i]; j++)
+         if (!(axes[i][j] > axes[i][j-1]))
+         {
+            GenericObject::Log_Error ("LookupTable : axis %i breakpoints shall be strictly increasing (breakpoint %i)", i+1, j+1);
+            return Error;
+         }
+      n     += sizes[i];
+      total *= sizes[i];
+   }
+
+// Owned copy: the breakpoints of the axes, then the values
+   delete [] data;
+   data = new double[n + total];
+   memset (size,   '\0', sizeof(size));
+   memset (stride, '\0', sizeof(stride));
+   memset (axis,   '\0', sizeof(axis));
+   for (i = n = 0; i < dimensions; n += size[i++])
+   {
+      size[i] = sizes[i];
+      axis[i] = data + n;
+      memcpy (axis[i], axes[i], size[i] * sizeof(double));
+   }
+   values = data + n;
+   memcpy (values, table_values, total * sizeof(double));
+   for (i = dimensions-1, j = 1; i >= 0; j *= size[i--])
+      stride[i] = j;
+   n_dimensions  = dimensions;
+   interpolation = interpolation_type;
+   bounds        = bounds_type;
+   return Nominal;
+}
+
+//-------------------------------------------------------------------------
+inline int LookupTable::Bracket (int axis_index, double x, int hint) const
+//-------------------------------------------------------------------------
+{
+   const double   *a = axis[axis_index];
+   int            last = size[axis_index] - 2, lo, hi, mid;
+
+// The interval of the previous evaluation, or one of its neighbours
+   if (hint < 0 || hint > last)
+      hint = 0;
+   if (x >= a[hint])
+   {
+      if (hint == last || x < a[hint+1])
+         return hint;
+      if (hint+1 == last || x < a[hint+2])
+         return hint+1;
+      lo = hint+2;
+      hi = last;
+   }
+   else
+   {
+      if (hint == 0 || x >= a[hint-1])
+         return (hint > 0) ? hint-1 : 0;
+      lo = 0;
+      hi = hint-2;
+      if (hi < 0)
+         return 0;
+   }
+
+// Binary search of the last breakpoint not above "x" (the first one if "x" is below all)
+   while (lo < hi)
+   {
+      mid = (lo + hi + 1) / 2;
+      if (a[mid] <= x)
+         lo = mid;
+      else
+         hi = mid - 1;
+   }
+   return lo;
+}
+
+//-------------------------------------------------------------------------
+inline void LookupTable::Locate (const double x[], typ_cursor &cursor, int offset[][4], double weight[][4], int n_weights[]) const
+//-------------------------------------------------------------------------
+{
+   const double   *a;
+   double         h, t, t2, t3, c;
+   int            i, j, k, last;
+
+   for (j = 0; j < LOOKUP_TABLE_MAX_DIMENSIONS; j++)
+   {
+      if (j >= n_dimensions) // Not used axis: one value with unit weight
+      {
+         n_weights[j] = 1;
+         offset[j][0] = 0;
+         weight[j][0] = 1.;
+         continue;
+      }
+      a    = axis[j];
+      last = size[j] - 1;
+      i    = Bracket (j, x[j], cursor.index[j]);
+      cursor.index[j] = i;
+      h    = a[i+1] - a[i];
+      t    = (x[j] - a[i]) / h;
+      if (bounds == Clamp)
+         t = (t < 0.) ? 0. : ((t > 1.) ? 1. : t);
+
+      if (interpolation == Linear)
+      {
+         n_weights[j] = 2;
+         offset[j][0] = i * stride[j];
+         offset[j][1] = (i+1) * stride[j];
+         weight[j][0] = 1. - t;
+         weight[j][1] = t;
+         continue;
+      }
+
+// Cubic Hermite on breakpoints i-1..i+2 (clipped to the axis), the slopes at i and i+1 by central differences
+      n_weights[j] = 4;
+      for (k = 0; k < 4; k++)
+         offset[j][k] = ((i-1+k < 0) ? 0 : ((i-1+k > last) ? last : i-1+k)) * stride[j];
+      if (t < 0. || t > 1.) // Linear extrapolation
+      {
+         weight[j][0] = 0.;
+         weight[j][1] = 1. - t;
+         weight[j][2] = t;
+         weight[j][3] = 0.;
+         continue;
+      }
+      t2 = t * t;
+      t3 = t2 * t;
+      weight[j][0] = 0.;
+      weight[j][1] =  2.*t3 - 3.*t2 + 1.;
+      weight[j][2] = -2.*t3 + 3.*t2;
+      weight[j][3] = 0.;
+      c = (t3 - 2.*t2 + t) * h; // Slope at i: (v[i+1]-v[i-1])/(a[i+1]-a[i-1]), one-sided at the first breakpoint
+      if (i > 0)
+      {
+         weight[j][2] += c / (a[i+1] - a[i-1]);
+         weight[j][0] -= c / (a[i+1] - a[i-1]);
+      }
+      else
+      {
+         weight[j][2] += c / h;
+         weight[j][1] -= c / h;
+      }
+      c = (t3 - t2) * h; // Slope at i+1: (v[i+2]-v[i])/(a[i+2]-a[i]), one-sided at the last breakpoint
+      if (i+2 <= last)
+      {
+         weight[j][3] += c / (a[i+2] - a[i]);
+         weight[j][1] -= c / (a[i+2] - a[i]);
+      }
+      else
+      {
+         weight[j][2] += c / h;
+         weight[j][1] -= c / h;
+      }
+   }
+}
+
+//-------------------------------------------------------------------------
+double LookupTable::Evaluate (const double x[], typ_cursor &cursor) const
+//-------------------------------------------------------------------------
+{
+   int      offset[LOOKUP_TABLE_MAX_DIMENSIONS][4], n_weights[LOOKUP_TABLE_MAX_DIMENSIONS], k0, k1, k2;
+   double   weight[LOOKUP_TABLE_MAX_DIMENSIONS][4], y = 0.;
+
+   if (!n_dimensions)
+      return 0.;
+   if (interpolation == Linear) // Corners of the cell, in the same order as the general sum below
+   {
+      const double   *v = values;
+      double         t, w[LOOKUP_TABLE_MAX_DIMENSIONS][2];
+      int            i, j;
+
+      for (j = 0; j < n_dimensions; j++)
+      {
+         i = Bracket (j, x[j], cursor.index[j]);
+         cursor.index[j] = i;
+         t = (x[j] - axis[j][i]) / (axis[j][i+1] - axis[j][i]);
+         if (bounds == Clamp)
+            t = (t < 0.) ? 0. : ((t > 1.) ? 1. : t);
+         w[j][0] = 1. - t;
+         w[j][1] = t;
+         v += i * stride[j];
+      }
+      switch (n_dimensions)
+      {
+      case 1:
+         return y + w[0][0] * v[0] + w[0][1] * v[stride[0]];
+      case 2:
+         k1 = stride[1];
+         k0 = stride[0];
+         return y + w[0][0] * w[1][0] * v[0]  + w[0][0] * w[1][1] * v[k1]
+                  + w[0][1] * w[1][0] * v[k0] + w[0][1] * w[1][1] * v[k0+k1];
+      default:
+         k2 = stride[2];
+         k1 = stride[1];
+         k0 = stride[0];
+         return y + w[0][0] * w[1][0] * w[2][0] * v[0]     + w[0][0] * w[1][0] * w[2][1] * v[k2]
+                  + w[0][0] * w[1][1] * w[2][0] * v[k1]    + w[0][0] * w[1][1] * w[2][1] * v[k1+k2]
+                  + w[0][1] * w[1][0] * w[2][0] * v[k0]    + w[0][1] * w[1][0] * w[2][1] * v[k0+k2]
+                  + w[0][1] * w[1][1] * w[2][0] * v[k0+k1] + w[0][1] * w[1][1] * w[2][1] * v[k0+k1+k2];
+      }
+   }
+   Locate (x, cursor, offset, weight, n_weights);
+   for (k0 = 0; k0 < n_weights[0]; k0++)
+      for (k1 = 0; k1 < n_weights[1]; k1++)
+         for (k2 = 0; k2 < n_weights[2]; k2++)
+            y += weight[0][k0] * weight[1][k1] * weight[2][k2] * values[offset[0][k0] + offset[1][k1] + offset[2][k2]];
+   return y;
+}
+
+//-------------------------------------------------------------------------
+void LookupTable::Evaluate_Batch (int n_points, const double *x[], double y[], typ_cursor &cursor) const
+//-------------------------------------------------------------------------
+{
+   double   point[LOOKUP_TABLE_MAX_DIMENSIONS];
+   int      i = 0, j;
+
+   if (!n_dimensions)
+   {
+      memset (y, '\0', n_points * sizeof(double));
+      return;
+   }
+#if defined(DSS_SSE2_MATH)
+   // Two points at a time: same weights and values order as "Evaluate", the values gathered in pairs
+   int      offset[2][LOOKUP_TABLE_MAX_DIMENSIONS][4], n_weights[LOOKUP_TABLE_MAX_DIMENSIONS], k0, k1, k2, p;
+   double   weight[2][LOOKUP_TABLE_MAX_DIMENSIONS][4];
+   __m128d  w01, acc;
+
+   for (; i+1 < n_points; i += 2)
+   {
+      for (p = 0; p < 2; p++)
+      {
+         for (j = 0; j < n_dimensions; j++)
+            point[j] = x[j][i+p];
+         Locate (point, cursor, offset[p], weight[p], n_weights); // The number of the weights depends on the table only
+      }
+      acc = _mm_setzero_pd ();
+      for (k0 = 0; k0 < n_weights[0]; k0++)
+         for (k1 = 0; k1 < n_weights[1]; k1++)
+         {
+            w01 = _mm_mul_pd (_mm_set_pd (weight[1][0][k0], weight[0][0][k0]), _mm_set_pd (weight[1][1][k1], weight[0][1][k1]));
+            for (k2 = 0; k2 < n_weights[2]; k2++)
+               acc = _mm_add_pd (acc, _mm_mul_pd (_mm_mul_pd (w01, _mm_set_pd (weight[1][2][k2], weight[0][2][k2])),
+                                                  _mm_set_pd (values[offset[1][0][k0] + offset[1][1][k1] + offset[1][2][k2]],
+                                                              values[offset[0][0][k0] + offset[0][1][k1] + offset[0][2][k2]])));
+         }
+      _mm_storeu_pd (y + i, acc);
+   }
+#endif
+   for (; i < n_points; i++)
+   {
+      for (j = 0; j < n_dimensions; j++)
+         point[j] = x[j][i];
+      y[i] = Evaluate (point, cursor);
+   }
+}
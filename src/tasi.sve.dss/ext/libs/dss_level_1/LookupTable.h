@@ -0,0 +1,121 @@
+#if !defined(__LookupTable_h) // Use file only if it's not already included.
+#define __LookupTable_h
+
+/******************************************************************************
+
+    PROJECT:      DSS - S/C Dynamics Simulation Software
+    FILE:         LookupTable.h
+    RELEASE:      0.01
+    AUTHOR:       DSS Team
+    DATE:         2026/10/19
+
+    OVERVIEW
+    ========
+    Header file for the Lookup Table of the Mathematical Library: tabulated
+    function of 1, 2 or 3 variables on a rectangular grid, interpolated
+    linearly or by cubic Hermite polynomials (slopes by finite differences
+    of the neighbour points, non-uniform grids allowed).
+    A table <TABLE> of a Model is loaded from the set file symbols
+
+       <Name>.<TABLE>_AXIS1 = [ x1 ... ]       breakpoints, strictly increasing
+       <Name>.<TABLE>_AXIS2 = [ x2 ... ]       (2D and 3D tables only)
+       <Name>.<TABLE>_AXIS3 = [ x3 ... ]       (3D tables only)
+       <Name>.<TABLE>       = [ values ... ]   row-major, the last axis runs fastest
+
+    The bracketing interval of each axis is searched starting from the one
+    found by the previous evaluation, kept by the caller in a "typ_cursor"
+    (zero is a valid cursor): slowly varying queries cost O(1). The table
+    is read only by the evaluations, so it can be shared by threads having
+    their own cursors.
+
+    CHANGE LOG
+    ==========
+
+******************************************************************************/
+
+#include "GenericTypes.h"
+#include "Input_file.h"
+
+#define  LOOKUP_TABLE_MAX_DIMENSIONS      3                             //!< Maximum number of the <b>table variables</b>
+
+/**
+* Class definition for the <b>Lookup Table</b>.
+*/
+
+class LookupTable
+{
+
+/*-------------------------------------------------------------------------
+   Data Type declarations
+-------------------------------------------------------------------------*/
+
+public:
+
+   enum typ_interpolation     /** <b>Interpolation</b> between the breakpoints */
+   {
+      Linear,                                //!< Multi-linear (2 breakpoints per axis)
+      Cubic                                  //!< Cubic Hermite, C1 (4 breakpoints per axis)
+   };
+
+   enum typ_bounds            /** Behaviour <b>outside the breakpoints</b> */
+   {
+      Clamp,                                 //!< The variables are clipped to the breakpoints range
+      Extrapolate                            //!< Linear extrapolation of the first/last interval
+   };
+
+   struct typ_cursor          /** Bracketing intervals of the last evaluation, <b>owned by the caller</b> (zero when not used yet) */
+   {
+      int               index[LOOKUP_TABLE_MAX_DIMENSIONS];    //!< Interval of each axis (first breakpoint)
+   };
+
+/*-------------------------------------------------------------------------
+   Data declarations
+-------------------------------------------------------------------------*/
+
+private:
+
+   int                        n_dimensions;                    //!<  Number of the <b>table variables</b> (0 if not loaded)
+   int                        size[LOOKUP_TABLE_MAX_DIMENSIONS];   //!<  Number of the <b>breakpoints</b> of each axis (at least 2)
+   int                        stride[LOOKUP_TABLE_MAX_DIMENSIONS]; //!<  Distance of the consecutive values along each axis
+   double                     *axis[LOOKUP_TABLE_MAX_DIMENSIONS];  //!<  <b>Breakpoints</b> of each axis (in "data")
+   double                     *values;                         //!<  Table <b>values</b> (in "data")
+   double                     *data;                           //!<  Owned storage of the breakpoints and of the values
+   typ_interpolation          interpolation;                   //!<  <b>Interpolation</b> type
+   typ_bounds                 bounds;                          //!<  Behaviour <b>outside the breakpoints</b>
+
+/*-------------------------------------------------------------------------
+   Function declarations
+-------------------------------------------------------------------------*/
+
+public:
+
+   LookupTable ();
+   ~LookupTable ();
+
+/** Public Method to <b>load the table</b> from the set file symbols <model_name>.<table_name>_AXISn and <model_name>.<table_name> (<table_name>... without model name). Returns Error if missing or inconsistent*/
+   typ_return                    Load (InputFile *reader /*! Set file <b>reader</b>*/, const char *model_name /*! <b>Model name</b>, NULL for a global table*/, const char *table_name /*! <b>Table name</b>*/, typ_interpolation interpolation_type = Linear /*! <b>Interpolation</b> type*/, typ_bounds bounds_type = Clamp /*! Behaviour <b>outside the breakpoints</b>*/);
+/** Public Method to <b>set the table</b> from arrays (copied). Returns Error if inconsistent*/
+   typ_return                    Set (int dimensions /*! Number of the <b>variables</b> [1..3]*/, const int sizes[] /*! Number of the <b>breakpoints</b> of each axis*/, const double *axes[] /*! <b>Breakpoints</b> of each axis, strictly increasing*/, const double table_values[] /*! <b>Values</b>, row-major*/, typ_interpolation interpolation_type = Linear /*! <b>Interpolation</b> type*/, typ_bounds bounds_type = Clamp /*! Behaviour <b>outside the breakpoints</b>*/);
+
+/** Public Method returning the table <b>value</b> at the provided variables*/
+   double                        Evaluate (const double x[] /*! <b>Variables</b>, one per axis*/, typ_cursor &cursor /*! Caller <b>cursor</b>, updated*/) const;
+/** Public Method returning the 1D table <b>value</b> at the provided variable*/
+   inline double                 Evaluate (double x /*! <b>Variable</b>*/, typ_cursor &cursor /*! Caller <b>cursor</b>, updated*/) const {return Evaluate (&x, cursor);};
+/** Public Method evaluating the table at <b>n points</b>, two at a time with SSE2 (same results as "Evaluate")*/
+   void                          Evaluate_Batch (int n_points /*! Number of the <b>points</b>*/, const double *x[] /*! <b>Variables</b> of the points, one array per axis*/, double y[] /*! out - <b>Values</b>*/, typ_cursor &cursor /*! Caller <b>cursor</b>, updated point by point*/) const;
+
+/** Public Method returning the <b>number of the table variables</b> (0 if not loaded)*/
+   inline int                    Get_N_Dimensions ()           const {return n_dimensions;};
+/** Public Method returning the <b>number of the breakpoints</b> of an axis*/
+   inline int                    Get_Size (int axis_index)     const {return size[axis_index];};
+
+private:
+
+/** Private Method returning the <b>bracketing interval</b> of "x" along an axis, searched from the "hint" one*/
+   int                           Bracket (int axis_index, double x, int hint) const;
+/** Private Method computing, for each axis, the <b>offsets and weights</b> of the values contributing to the point*/
+   void                          Locate (const double x[], typ_cursor &cursor, int offset[][4], double weight[][4], int n_weights[]) const;
+
+};
+
+#endif // __LookupTable_h end
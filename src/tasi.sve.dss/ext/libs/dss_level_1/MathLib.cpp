@@ -12,19 +12,50 @@
 
     CHANGE LOG
     ==========
+   DSS Team       2026/10/19  VEC_CROSS, VEC_DOT, VEC_NORM, MAT_PROD, MAT_DET, MAT_INV, MAT_TRANSPOSE, QUAT_TO_ROT,
+                              QUAT_COMPOSE and QUAT_INV wrap the "LinearAlgebra.h" templates; MAT_PROD and VEC_DOT /
+                              VEC_NORM keep the generic loops for the sizes without a fixed-size kernel
+   DSS Team       2026/10/19  QUAT_PROP computes the closed-form propagation with a fused sincos, shared with the new
+                              batched (structure of arrays) quaternion functions, SSE2 on two quaternions at a time
 
 ******************************************************************************/
 
 #include "MathLib.h"
 
+//-------------------------------------------------------------------------
+static inline void Quat_Prop (double q_out[4], const double q_in[4], const double w_brf[3], double dT)
+// CLOSED-FORM QUATERNION PROPAGATION AND NORMALIZATION, q_out may be q_in
+//-------------------------------------------------------------------------
+{
+   double   norm_w, x, c = 1., k = 0., q0, q1, q2, q3, inv_norm;
+
+   norm_w = sqrt (w_brf[0]*w_brf[0] + w_brf[1]*w_brf[1] + w_brf[2]*w_brf[2]);
+   x      = norm_w * dT / 2.0;
+   if (fabs (x) > 1.E-9)
+   {
+      sincos (x, &k, &c);
+      k /= norm_w;
+   }
+
+// q_out = (c * I + sin(x)/|w| * Omega(w)) * q_in
+   q0 = c*q_in[0] - k*(w_brf[0]*q_in[1] + w_brf[1]*q_in[2] + w_brf[2]*q_in[3]);
+   q1 = c*q_in[1] + k*(w_brf[0]*q_in[0] + w_brf[2]*q_in[2] - w_brf[1]*q_in[3]);
+   q2 = c*q_in[2] + k*(w_brf[1]*q_in[0] - w_brf[2]*q_in[1] + w_brf[0]*q_in[3]);
+   q3 = c*q_in[3] + k*(w_brf[2]*q_in[0] + w_brf[1]*q_in[1] - w_brf[0]*q_in[2]);
+
+   inv_norm = 1. / sqrt (q0*q0 + q1*q1 + q2*q2 + q3*q3);
+   q_out[0] = q0 * inv_norm;
+   q_out[1] = q1 * inv_norm;
+   q_out[2] = q2 * inv_norm;
+   q_out[3] = q3 * inv_norm;
+}
+
 //-------------------------------------------------------------------------
 typ_return VEC_CROSS (double v1Xv2_out[3], double v1_in[3], double v2_in[3])
 // 3x1 VECTORS CROSS PRODUCT
 //-------------------------------------------------------------------------
 {
-   v1Xv2_out[0] = v1_in[1] * v2_in[2] - v1_in[2] * v2_in[1];
-   v1Xv2_out[1] = v1_in[2] * v2_in[0] - v1_in[0] * v2_in[2];
-   v1Xv2_out[2] = v1_in[0] * v2_in[1] - v1_in[1] * v2_in[0];
+   Vec3::View (v1Xv2_out) = Cross (Vec3::View (v1_in), Vec3::View (v2_in));
    return Nominal;
 }
 
@@ -36,6 +67,8 @@ double VEC_DOT (double* v1_in, double* v2_in, const int n_in)
    int      i;
    double   v1v2_out = 0.0;
 
+   if (n_in == 3)
+      return Vec3::View (v1_in).Dot (Vec3::View (v2_in));
    for (i = 0; i < n_in; i++)
       v1v2_out += v1_in[i] * v2_in[i];
    return v1v2_out;
@@ -49,6 +82,8 @@ typ_return VEC_NORM  (double* normalized_out, double* vector_in, const int n_in)
    int      i;
    double   module = 0.0;
 
+   if (n_in == 3)
+      return Vec3::View (vector_in).Normalize (Vec3::View (normalized_out)) ? Nominal : Error;
    for (i = 0; i < n_in; i++)
       module += vector_in[i] * vector_in[i];
    module = Sqrt (module);
@@ -70,6 +105,23 @@ typ_return MAT_PROD (double* m1m2_out, double* m1_in, double* m2_in, const int n
 {
    int   i, j, k;
 
+// Fixed-size kernels of the sizes used by the Models (3x3 rotations, quaternion matrices)
+   if (n1_in == 3 && n2_in == 3 && n3_in == 1)
+   {
+      Vec3::View (m1m2_out) = Mat3::View (m1_in) * Vec3::View (m2_in);
+      return Nominal;
+   }
+   if (n1_in == 3 && n2_in == 3 && n3_in == 3)
+   {
+      Mat3::View (m1m2_out) = Mat3::View (m1_in) * Mat3::View (m2_in);
+      return Nominal;
+   }
+   if (n1_in == 4 && n2_in == 4 && n3_in == 1)
+   {
+      Vec<4>::View (m1m2_out) = Mat<4,4>::View (m1_in) * Vec<4>::View (m2_in);
+      return Nominal;
+   }
+
    for (i = 0; i < n1_in; i++)
       for (j = 0; j < n3_in; j++)
       {
@@ -85,9 +137,7 @@ double MAT_DET (double matrix_in[3][3])
 // 3x3 MATRIX DETERMINANT
 //-------------------------------------------------------------------------
 {
-   return   matrix_in[0][0] * matrix_in[1][1] * matrix_in[2][2] - matrix_in[0][0] * matrix_in[1][2] * matrix_in[2][1]
-          - matrix_in[1][0] * matrix_in[0][1] * matrix_in[2][2] + matrix_in[0][1] * matrix_in[1][2] * matrix_in[2][0]
-          + matrix_in[1][0] * matrix_in[2][1] * matrix_in[0][2] - matrix_in[0][2] * matrix_in[2][0] * matrix_in[1][1];
+   return Det (Mat3::View (matrix_in));
 }
 
 //-------------------------------------------------------------------------
@@ -95,27 +145,11 @@ typ_return MAT_INV (double inverse_out[3][3], double matrix_in[3][3])
 // 3x3 MATRIX INVERSION
 //-------------------------------------------------------------------------
 {
-   int      i, j;
-   double   det;
+   Mat3  inverse;
+   bool  invertible = Inverse (inverse, Mat3::View (matrix_in));
 
-   det = MAT_DET (matrix_in);
-   if (det < 1.E-14)
-   {
-      for (i = 0; i < 3; i++)
-         for (j = 0; j < 3; j++)
-            inverse_out[i][j] = 0.0;
-      return Error;
-   }
-   inverse_out[0][0]= (matrix_in[2][2]*matrix_in[1][1]-matrix_in[2][1]*matrix_in[1][2]) / det;
-   inverse_out[0][1]=-(matrix_in[2][2]*matrix_in[0][1]-matrix_in[2][1]*matrix_in[0][2]) / det;
-   inverse_out[0][2]= (matrix_in[1][2]*matrix_in[0][1]-matrix_in[1][1]*matrix_in[0][2]) / det;
-   inverse_out[1][0]=-(matrix_in[2][2]*matrix_in[1][0]-matrix_in[2][0]*matrix_in[1][2]) / det;
-   inverse_out[1][1]= (matrix_in[2][2]*matrix_in[0][0]-matrix_in[2][0]*matrix_in[0][2]) / det;
-   inverse_out[1][2]=-(matrix_in[1][2]*matrix_in[0][0]-matrix_in[1][0]*matrix_in[0][2]) / det;
-   inverse_out[2][0]= (matrix_in[2][1]*matrix_in[1][0]-matrix_in[2][0]*matrix_in[1][1]) / det;
-   inverse_out[2][1]=-(matrix_in[2][1]*matrix_in[0][0]-matrix_in[2][0]*matrix_in[0][1]) / det;
-   inverse_out[2][2]= (matrix_in[1][1]*matrix_in[0][0]-matrix_in[1][0]*matrix_in[0][1]) / det;
-   return Nominal;
+   Mat3::View (inverse_out) = inverse;
+   return invertible ? Nominal : Error;
 }
 
 //-------------------------------------------------------------------------
@@ -123,10 +157,7 @@ typ_return MAT_TRANSPOSE (double trans_out[3][3], double matrix_in[3][3])
 // 3x3 MATRIX TRANSPOSITION
 //-------------------------------------------------------------------------
 {
-   for (int i = 0; i < 3; i++)
-         for (int j = 0; j < 3; j++)
-            trans_out[i][j] = matrix_in[j][i];
-
+   Mat3::View (trans_out) = Mat3::View (matrix_in).Transposed ();
    return Nominal;
 }
 
@@ -173,24 +204,11 @@ void QUAT_TO_ROT (double R_fixed2body[3][3] /*! out - Rotation Matrix Fixed->Bod
                   double q[4]               /*! in&out - Quaternion vector, q[0] is the scalar component */)
 //-------------------------------------------------------------------
 {
-   int      i;
-   double   dum;
-
 // Quaternion normalization
-   dum = Sqrt (q[0]*q[0] + q[1]*q[1] + q[2]*q[2] + q[3]*q[3]);
-   for (i = 0; i < 4; i++)
-      q[i] /= dum;
+   Quat::View (q) = Quat::View (q).Normalized ();
 
 // Rotation matrix from the FIXED to the BODY-local reference frame
-   R_fixed2body[0][0] = q[0]*q[0] + q[1]*q[1] - q[2]*q[2] - q[3]*q[3];
-   R_fixed2body[0][1] = 2.*( q[1]*q[2] + q[3]*q[0]);
-   R_fixed2body[0][2] = 2.*( q[1]*q[3] - q[2]*q[0]);
-   R_fixed2body[1][0] = 2.*( q[1]*q[2] - q[3]*q[0]);
-   R_fixed2body[1][1] = q[0]*q[0] - q[1]*q[1] + q[2]*q[2] - q[3]*q[3];
-   R_fixed2body[1][2] = 2.*( q[1]*q[0] + q[2]*q[3]);
-   R_fixed2body[2][0] = 2.*( q[1]*q[3] + q[2]*q[0]);
-   R_fixed2body[2][1] = 2.*(-q[1]*q[0] + q[2]*q[3]);
-   R_fixed2body[2][2] = q[0]*q[0] - q[1]*q[1] - q[2]*q[2] + q[3]*q[3];
+   Mat3::View (R_fixed2body) = Quat::View (q).Rotation ();
 }
 
 //-------------------------------------------------------------------
@@ -245,35 +263,8 @@ void ROT_TO_QUAT (double q[4]                     /*! out - Quaternion vector, q
 void QUAT_PROP(typ_return &result, double q_in[4], double w_brf[3], double dT, double q_out[4])
 //---------------------------------------------------------------------------------------------
 {
-   double   norm_w, dum;
-   double   x, c, s;
-   int      i;
-
    result = Nominal;
-
-   norm_w = Sqrt(w_brf[0]*w_brf[0] + w_brf[1]*w_brf[1] + w_brf[2]*w_brf[2]);
-   x      = norm_w * dT /2.0;
-   if(fabs(x) > 1.E-9)
-   {
-      c = cos(x);
-      s = sin(x);
-
-      double Om[4][4] = {{c,                 -w_brf[0]*s/norm_w,  -w_brf[1]*s/norm_w,  -w_brf[2]*s/norm_w},
-                         {w_brf[0]*s/norm_w,  c,                   w_brf[2]*s/norm_w,  -w_brf[1]*s/norm_w},
-                         {w_brf[1]*s/norm_w, -w_brf[2]*s/norm_w,   c,                   w_brf[0]*s/norm_w},
-                         {w_brf[2]*s/norm_w,  w_brf[1]*s/norm_w,  -w_brf[0]*s/norm_w,   c}};
-
-      result = MAT_PROD(&q_out[0], &Om[0][0], &q_in[0], 4, 4, 1);
-   }
-   else
-   {
-      for(i=0; i<4; i++)
-         q_out[i] = q_in[i];
-   }
-
-   dum = Sqrt (q_out[0]*q_out[0] + q_out[1]*q_out[1] + q_out[2]*q_out[2] + q_out[3]*q_out[3]);
-   for (i = 0; i < 4; i++)
-      q_out[i] /= dum;
+   Quat_Prop (q_out, q_in, w_brf, dT);
 }
 
 //---------------------------------------------------------------------------------------------
@@ -302,40 +293,252 @@ void QUAT_COMPOSE(double q_out[4], double q_1[4], double q_2[4])
 // QUAT3_OUT = QUAT1_IN(FIRST ROTATION) @ QUAT2_IN(SECOND ROTATION)
 //---------------------------------------------------------------------------------------------
 {
-   double CSI[4][4];
+   Quat::View (q_out) = Quat::Compose (Quat::View (q_1), Quat::View (q_2));
+}
 
-   CSI[0][0] = (+q_2[0]);
-   CSI[0][1] = (-q_2[1]);
-   CSI[0][2] = (-q_2[2]);
-   CSI[0][3] = (-q_2[3]);
+//---------------------------------------------------------------------------------------------
+void QUAT_INV(double q_out[4], double q_in[4])
+//---------------------------------------------------------------------------------------------
+{
+   Quat::View (q_out) = Quat::View (q_in).Conjugate ();
+}
 
-   CSI[1][0] = (+q_2[1]);
-   CSI[1][1] = (+q_2[0]);
-   CSI[1][2] = (+q_2[3]);
-   CSI[1][3] = (-q_2[2]);
+/*----------------------------------------------------------------------*
+*       BATCHED QUATERNION FUNCTIONS
+*       The SSE2 loops process two quaternions at a time with the same
+*       operations of the single quaternion functions, the remaining one
+*       is processed by the scalar code.
+*----------------------------------------------------------------------*/
 
-   CSI[2][0] = (+q_2[2]);
-   CSI[2][1] = (-q_2[3]);
-   CSI[2][2] = (+q_2[0]);
-   CSI[2][3] = (+q_2[1]);
+//---------------------------------------------------------------------------------------------
+void QUAT_PROP_BATCH (typ_return &result, const int n, double *q_in[4], double *w_brf[3], double dT, double *q_out[4])
+//---------------------------------------------------------------------------------------------
+{
+   double   q[4], w[3];
+   int      i = 0, j;
 
-   CSI[3][0] = (+q_2[3]);
-   CSI[3][1] = (+q_2[2]);
-   CSI[3][2] = (-q_2[1]);
-   CSI[3][3] = (+q_2[0]);
+   result = Nominal;
+#if defined(DSS_SSE2_MATH)
+   double   norm_w[2], x[2], k[2], c[2];
+   __m128d  w0, w1, w2, q0, q1, q2, q3, o0, o1, o2, o3, norm_v, kv, cv, inv_norm;
 
-   MAT_PROD (q_out, CSI[0], q_1, 4, 4, 1);
+   for (; i+1 < n; i += 2)
+   {
+      w0     = _mm_loadu_pd (w_brf[0] + i);
+      w1     = _mm_loadu_pd (w_brf[1] + i);
+      w2     = _mm_loadu_pd (w_brf[2] + i);
+      norm_v = _mm_sqrt_pd (_mm_add_pd (_mm_add_pd (_mm_mul_pd (w0, w0), _mm_mul_pd (w1, w1)), _mm_mul_pd (w2, w2)));
+      _mm_storeu_pd (norm_w, norm_v);
+      _mm_storeu_pd (x, _mm_div_pd (_mm_mul_pd (norm_v, _mm_set1_pd (dT)), _mm_set1_pd (2.0)));
+      for (j = 0; j < 2; j++)
+      {
+         c[j] = 1.;
+         k[j] = 0.;
+         if (fabs (x[j]) > 1.E-9)
+         {
+            sincos (x[j], &k[j], &c[j]);
+            k[j] /= norm_w[j];
+         }
+      }
+      kv = _mm_loadu_pd (k);
+      cv = _mm_loadu_pd (c);
+
+      q0 = _mm_loadu_pd (q_in[0] + i);
+      q1 = _mm_loadu_pd (q_in[1] + i);
+      q2 = _mm_loadu_pd (q_in[2] + i);
+      q3 = _mm_loadu_pd (q_in[3] + i);
+      o0 = _mm_sub_pd (_mm_mul_pd (cv, q0), _mm_mul_pd (kv, _mm_add_pd (_mm_add_pd (_mm_mul_pd (w0, q1), _mm_mul_pd (w1, q2)), _mm_mul_pd (w2, q3))));
+      o1 = _mm_add_pd (_mm_mul_pd (cv, q1), _mm_mul_pd (kv, _mm_sub_pd (_mm_add_pd (_mm_mul_pd (w0, q0), _mm_mul_pd (w2, q2)), _mm_mul_pd (w1, q3))));
+      o2 = _mm_add_pd (_mm_mul_pd (cv, q2), _mm_mul_pd (kv, _mm_add_pd (_mm_sub_pd (_mm_mul_pd (w1, q0), _mm_mul_pd (w2, q1)), _mm_mul_pd (w0, q3))));
+      o3 = _mm_add_pd (_mm_mul_pd (cv, q3), _mm_mul_pd (kv, _mm_sub_pd (_mm_add_pd (_mm_mul_pd (w2, q0), _mm_mul_pd (w1, q1)), _mm_mul_pd (w0, q2))));
+
+      inv_norm = _mm_div_pd (_mm_set1_pd (1.), _mm_sqrt_pd (_mm_add_pd (_mm_add_pd (_mm_add_pd (_mm_mul_pd (o0, o0), _mm_mul_pd (o1, o1)), _mm_mul_pd (o2, o2)), _mm_mul_pd (o3, o3))));
+      _mm_storeu_pd (q_out[0] + i, _mm_mul_pd (o0, inv_norm));
+      _mm_storeu_pd (q_out[1] + i, _mm_mul_pd (o1, inv_norm));
+      _mm_storeu_pd (q_out[2] + i, _mm_mul_pd (o2, inv_norm));
+      _mm_storeu_pd (q_out[3] + i, _mm_mul_pd (o3, inv_norm));
+   }
+#endif
+   for (; i < n; i++)
+   {
+      for (j = 0; j < 4; j++)
+         q[j] = q_in[j][i];
+      for (j = 0; j < 3; j++)
+         w[j] = w_brf[j][i];
+      Quat_Prop (q, q, w, dT);
+      for (j = 0; j < 4; j++)
+         q_out[j][i] = q[j];
+   }
+}
 
+//---------------------------------------------------------------------------------------------
+void QUAT_TO_ROT_BATCH (const int n, double *R_fixed2body[3][3], double *q[4])
+//---------------------------------------------------------------------------------------------
+{
+   double   qi[4], R[3][3];
+   int      i = 0, j, l;
+
+   QUAT_NORM_BATCH (n, q);
+#if defined(DSS_SSE2_MATH)
+   __m128d  q0, q1, q2, q3, two = _mm_set1_pd (2.);
+
+   for (; i+1 < n; i += 2)
+   {
+      q0 = _mm_loadu_pd (q[0] + i);
+      q1 = _mm_loadu_pd (q[1] + i);
+      q2 = _mm_loadu_pd (q[2] + i);
+      q3 = _mm_loadu_pd (q[3] + i);
+      _mm_storeu_pd (R_fixed2body[0][0] + i, _mm_sub_pd (_mm_sub_pd (_mm_add_pd (_mm_mul_pd (q0, q0), _mm_mul_pd (q1, q1)), _mm_mul_pd (q2, q2)), _mm_mul_pd (q3, q3)));
+      _mm_storeu_pd (R_fixed2body[0][1] + i, _mm_mul_pd (two, _mm_add_pd (_mm_mul_pd (q1, q2), _mm_mul_pd (q3, q0))));
+      _mm_storeu_pd (R_fixed2body[0][2] + i, _mm_mul_pd (two, _mm_sub_pd (_mm_mul_pd (q1, q3), _mm_mul_pd (q2, q0))));
+      _mm_storeu_pd (R_fixed2body[1][0] + i, _mm_mul_pd (two, _mm_sub_pd (_mm_mul_pd (q1, q2), _mm_mul_pd (q3, q0))));
+      _mm_storeu_pd (R_fixed2body[1][1] + i, _mm_sub_pd (_mm_add_pd (_mm_sub_pd (_mm_mul_pd (q0, q0), _mm_mul_pd (q1, q1)), _mm_mul_pd (q2, q2)), _mm_mul_pd (q3, q3)));
+      _mm_storeu_pd (R_fixed2body[1][2] + i, _mm_mul_pd (two, _mm_add_pd (_mm_mul_pd (q1, q0), _mm_mul_pd (q2, q3))));
+      _mm_storeu_pd (R_fixed2body[2][0] + i, _mm_mul_pd (two, _mm_add_pd (_mm_mul_pd (q1, q3), _mm_mul_pd (q2, q0))));
+      _mm_storeu_pd (R_fixed2body[2][1] + i, _mm_mul_pd (two, _mm_sub_pd (_mm_mul_pd (q2, q3), _mm_mul_pd (q1, q0))));
+      _mm_storeu_pd (R_fixed2body[2][2] + i, _mm_add_pd (_mm_sub_pd (_mm_sub_pd (_mm_mul_pd (q0, q0), _mm_mul_pd (q1, q1)), _mm_mul_pd (q2, q2)), _mm_mul_pd (q3, q3)));
+   }
+#endif
+   for (; i < n; i++)
+   {
+      for (j = 0; j < 4; j++)
+         qi[j] = q[j][i];
+      Mat3::View (R) = Quat::View (qi).Rotation ();
+      for (j = 0; j < 3; j++)
+         for (l = 0; l < 3; l++)
+            R_fixed2body[j][l][i] = R[j][l];
+   }
 }
 
 //---------------------------------------------------------------------------------------------
-void QUAT_INV(double q_out[4], double q_in[4])
+void QUAT_COMPOSE_BATCH (const int n, double *q_out[4], double *q_1[4], double *q_2[4])
+// QUAT3_OUT = QUAT1_IN(FIRST ROTATION) @ QUAT2_IN(SECOND ROTATION)
+//---------------------------------------------------------------------------------------------
+{
+   double   q1[4], q2[4], q[4];
+   int      i = 0, j;
+
+#if defined(DSS_SSE2_MATH)
+   __m128d  a0, a1, a2, a3, b0, b1, b2, b3;
+
+   for (; i+1 < n; i += 2)
+   {
+      a0 = _mm_loadu_pd (q_1[0] + i);
+      a1 = _mm_loadu_pd (q_1[1] + i);
+      a2 = _mm_loadu_pd (q_1[2] + i);
+      a3 = _mm_loadu_pd (q_1[3] + i);
+      b0 = _mm_loadu_pd (q_2[0] + i);
+      b1 = _mm_loadu_pd (q_2[1] + i);
+      b2 = _mm_loadu_pd (q_2[2] + i);
+      b3 = _mm_loadu_pd (q_2[3] + i);
+      _mm_storeu_pd (q_out[0] + i, _mm_sub_pd (_mm_sub_pd (_mm_sub_pd (_mm_mul_pd (b0, a0), _mm_mul_pd (b1, a1)), _mm_mul_pd (b2, a2)), _mm_mul_pd (b3, a3)));
+      _mm_storeu_pd (q_out[1] + i, _mm_sub_pd (_mm_add_pd (_mm_add_pd (_mm_mul_pd (b1, a0), _mm_mul_pd (b0, a1)), _mm_mul_pd (b3, a2)), _mm_mul_pd (b2, a3)));
+      _mm_storeu_pd (q_out[2] + i, _mm_add_pd (_mm_add_pd (_mm_sub_pd (_mm_mul_pd (b2, a0), _mm_mul_pd (b3, a1)), _mm_mul_pd (b0, a2)), _mm_mul_pd (b1, a3)));
+      _mm_storeu_pd (q_out[3] + i, _mm_add_pd (_mm_sub_pd (_mm_add_pd (_mm_mul_pd (b3, a0), _mm_mul_pd (b2, a1)), _mm_mul_pd (b1, a2)), _mm_mul_pd (b0, a3)));
+   }
+#endif
+   for (; i < n; i++)
+   {
+      for (j = 0; j < 4; j++)
+      {
+         q1[j] = q_1[j][i];
+         q2[j] = q_2[j][i];
+      }
+      Quat::View (q) = Quat::Compose (Quat::View (q1), Quat::View (q2));
+      for (j = 0; j < 4; j++)
+         q_out[j][i] = q[j];
+   }
+}
+
+//---------------------------------------------------------------------------------------------
+void CONTINUITY_QUAT_BATCH (typ_return &result, const int n, double *Q_dot[4], double *Q_old[4], bool assign_q_old)
 //---------------------------------------------------------------------------------------------
 {
-   q_out[0] =  q_in[0];
-   q_out[1] = -q_in[1];
-   q_out[2] = -q_in[2];
-   q_out[3] = -q_in[3];
+   double   q[4], q_old[4];
+   int      i = 0, j;
+
+   result = Nominal;
+#if defined(DSS_SSE2_MATH)
+   __m128d  q0, q1, q2, q3, d, distance, flip;
+
+   for (; i+1 < n; i += 2)
+   {
+      q0 = _mm_loadu_pd (Q_dot[0] + i);
+      q1 = _mm_loadu_pd (Q_dot[1] + i);
+      q2 = _mm_loadu_pd (Q_dot[2] + i);
+      q3 = _mm_loadu_pd (Q_dot[3] + i);
+      d        = _mm_sub_pd (q0, _mm_loadu_pd (Q_old[0] + i));
+      distance = _mm_mul_pd (d, d);
+      d        = _mm_sub_pd (q1, _mm_loadu_pd (Q_old[1] + i));
+      distance = _mm_add_pd (distance, _mm_mul_pd (d, d));
+      d        = _mm_sub_pd (q2, _mm_loadu_pd (Q_old[2] + i));
+      distance = _mm_add_pd (distance, _mm_mul_pd (d, d));
+      d        = _mm_sub_pd (q3, _mm_loadu_pd (Q_old[3] + i));
+      distance = _mm_add_pd (distance, _mm_mul_pd (d, d));
+
+      // Sign bit set in the lanes farther than 1.0 from the previous quaternion
+      flip = _mm_and_pd (_mm_cmpgt_pd (_mm_sqrt_pd (distance), _mm_set1_pd (1.0)), _mm_set1_pd (-0.));
+      q0 = _mm_xor_pd (q0, flip);
+      q1 = _mm_xor_pd (q1, flip);
+      q2 = _mm_xor_pd (q2, flip);
+      q3 = _mm_xor_pd (q3, flip);
+      _mm_storeu_pd (Q_dot[0] + i, q0);
+      _mm_storeu_pd (Q_dot[1] + i, q1);
+      _mm_storeu_pd (Q_dot[2] + i, q2);
+      _mm_storeu_pd (Q_dot[3] + i, q3);
+      if (assign_q_old)
+      {
+         _mm_storeu_pd (Q_old[0] + i, q0);
+         _mm_storeu_pd (Q_old[1] + i, q1);
+         _mm_storeu_pd (Q_old[2] + i, q2);
+         _mm_storeu_pd (Q_old[3] + i, q3);
+      }
+   }
+#endif
+   for (; i < n; i++)
+   {
+      for (j = 0; j < 4; j++)
+      {
+         q[j]     = Q_dot[j][i];
+         q_old[j] = Q_old[j][i];
+      }
+      CONTINUITY_QUAT (result, q, q_old, assign_q_old);
+      for (j = 0; j < 4; j++)
+      {
+         Q_dot[j][i] = q[j];
+         Q_old[j][i] = q_old[j];
+      }
+   }
 }
 
+//---------------------------------------------------------------------------------------------
+void QUAT_NORM_BATCH (const int n, double *q[4])
+// NORMALIZATION AS QUAT_TO_ROT: EACH COMPONENT IS DIVIDED BY THE NORM
+//---------------------------------------------------------------------------------------------
+{
+   double   norm;
+   int      i = 0, j;
+
+#if defined(DSS_SSE2_MATH)
+   __m128d  q0, q1, q2, q3, norm_v;
 
+   for (; i+1 < n; i += 2)
+   {
+      q0 = _mm_loadu_pd (q[0] + i);
+      q1 = _mm_loadu_pd (q[1] + i);
+      q2 = _mm_loadu_pd (q[2] + i);
+      q3 = _mm_loadu_pd (q[3] + i);
+      norm_v = _mm_sqrt_pd (_mm_add_pd (_mm_add_pd (_mm_add_pd (_mm_mul_pd (q0, q0), _mm_mul_pd (q1, q1)), _mm_mul_pd (q2, q2)), _mm_mul_pd (q3, q3)));
+      _mm_storeu_pd (q[0] + i, _mm_div_pd (q0, norm_v));
+      _mm_storeu_pd (q[1] + i, _mm_div_pd (q1, norm_v));
+      _mm_storeu_pd (q[2] + i, _mm_div_pd (q2, norm_v));
+      _mm_storeu_pd (q[3] + i, _mm_div_pd (q3, norm_v));
+   }
+#endif
+   for (; i < n; i++)
+   {
+      norm = sqrt (q[0][i]*q[0][i] + q[1][i]*q[1][i] + q[2][i]*q[2][i] + q[3][i]*q[3][i]);
+      for (j = 0; j < 4; j++)
+         q[j][i] /= norm;
+   }
+}
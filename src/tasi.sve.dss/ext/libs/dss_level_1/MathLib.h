@@ -22,6 +22,11 @@
    Marco Anania   2015/06/30 QUAT_PROP extended to support negative time propagation
                              QUAT_COMPOSE function introduced
                              QUAT_INV function introduced
+   DSS Team       2026/10/19  The vector, matrix and quaternion functions are wrappers of the fixed-size templates of
+                              "LinearAlgebra.h" (SSE2 kernels), which new code can use directly
+   DSS Team       2026/10/19  Added the batched (structure of arrays) quaternion functions QUAT_PROP_BATCH,
+                              QUAT_TO_ROT_BATCH, QUAT_COMPOSE_BATCH, CONTINUITY_QUAT_BATCH and QUAT_NORM_BATCH
+                              QUAT_PROP computes the closed-form propagation (no Omega matrix)
 
 ******************************************************************************/
 
@@ -30,6 +35,7 @@
 #include <string.h>
 #include <math.h>
 #include "GenericTypes.h"
+#include "LinearAlgebra.h"
 
 /*----------------------------------------------------------------------*
 *       MATHEMATICAL AND MISCELLANEOUS FUNCTIONS
@@ -102,7 +108,7 @@ double      MAT_DET   (double  matrix_in[3][3] /*! input matrix*/);
 typ_return  MAT_INV   (double  inverse_out[3][3] /*! inverted output matrix*/, double matrix_in[3][3] /*! input matrix*/);
 /** 3x3 MATRIX TRANSPOSITION */
 typ_return MAT_TRANSPOSE (double trans_out[3][3], double matrix_in[3][3]);
-/** NORMAL RANDOM SAMPLE GENERATOR */
+/** NORMAL RANDOM SAMPLE GENERATOR (global "rand()", not thread-safe: the Models use their own "Random_Stream") */
 double      RandomNormal (double mean /*! mean value*/, double sigma /*! standard deviation*/);
 /** Reduce a periodical value within the User-provided range */
 double      InRange (double   value       /*! in - Value to be reduced within the User-provided range */,
@@ -128,5 +134,29 @@ void QUAT_COMPOSE(double q_out[4], double q_1[4], double q_2[4]);
 /** Function for quaternion inversion */
 void QUAT_INV(double q_out[4], double q_in[4]);
 
+/*----------------------------------------------------------------------*
+*       BATCHED QUATERNION FUNCTIONS
+*       The n quaternions of a batch are stored as a structure of arrays:
+*       q[k][i] is the component k of the quaternion i (q[0] is the
+*       array of the scalar components), e.g. for the appendages of a
+*       multibody model or for the runs of an ensemble.
+*       Each function gives the same results as the single quaternion one.
+*----------------------------------------------------------------------*/
+
+/** Function to propagate n quaternions (as QUAT_PROP) */
+void QUAT_PROP_BATCH (typ_return &result, const int n /*! number of quaternions*/, double *q_in[4] /*! in - quaternions*/, double *w_brf[3] /*! in - angular rates [rad/s]*/, double dT /*! propagation time [s], also negative*/, double *q_out[4] /*! out - propagated quaternions, may be q_in*/);
+
+/** Function to get the Rotation Matrices from n quaternions (as QUAT_TO_ROT). It normalizes the input quaternions */
+void QUAT_TO_ROT_BATCH (const int n /*! number of quaternions*/, double *R_fixed2body[3][3] /*! out - Rotation Matrices Fixed->Body, R_fixed2body[r][c][i] element (r,c) of the matrix i*/, double *q[4] /*! in&out - quaternions*/);
+
+/** Function for the composition of n quaternion pairs (as QUAT_COMPOSE) */
+void QUAT_COMPOSE_BATCH (const int n /*! number of quaternions*/, double *q_out[4] /*! out - composed quaternions, may be q_1 or q_2*/, double *q_1[4] /*! in - first rotations*/, double *q_2[4] /*! in - second rotations*/);
+
+/** Function to assure the continuity of n quaternions (as CONTINUITY_QUAT) */
+void CONTINUITY_QUAT_BATCH (typ_return &result, const int n /*! number of quaternions*/, double *Q_dot[4] /*! in&out - quaternions*/, double *Q_old[4] /*! in&out - previous quaternions*/, bool assign_q_old = true);
+
+/** Function to normalize n quaternions */
+void QUAT_NORM_BATCH (const int n /*! number of quaternions*/, double *q[4] /*! in&out - quaternions*/);
+
 #endif // __MathLib_h end
 
@@ -0,0 +1,177 @@
+/******************************************************************************
+
+    PROJECT:      DSS - S/C Dynamics Simulation Software
+    FILE:         RandomStream.cpp
+    RELEASE:      0.01
+    AUTHOR:       DSS Team
+    DATE:         2026/10/19
+
+    OVERVIEW
+    ========
+    Source Code for the Random Stream
+
+    CHANGE LOG
+    ==========
+   DSS Team       2026/10/19  "Normal" builds the ziggurat tables (once), so that a stream never seeded samples them.
+
+******************************************************************************/
+
+#include <math.h>
+#include <string.h>
+#include "RandomStream.h"
+
+#define  PHILOX_M0         0xD2511F53u                                  //!< Philox4x32 round multipliers
+#define  PHILOX_M1         0xCD9E8D57u
+#define  PHILOX_W0         0x9E3779B9u                                  //!< Philox4x32 key increments (Weyl sequence)
+#define  PHILOX_W1         0xBB67AE85u
+#define  ZIGGURAT_R        3.442619855899                               //!< Ziggurat (128 layers) start of the tail
+#define  ZIGGURAT_V        9.91256303526217e-3                          //!< Ziggurat (128 layers) area of each layer
+
+// Static Data Initialization
+
+double         RandomStream::Zig_X[RANDOM_STREAM_ZIGGURAT_LAYERS+1];
+double         RandomStream::Zig_R[RANDOM_STREAM_ZIGGURAT_LAYERS];
+pthread_once_t RandomStream::Tables_Once = PTHREAD_ONCE_INIT;
+
+//-------------------------------------------------------------------------
+void RandomStream::Seed (unsigned int stream_key, unsigned long long seed, unsigned int substream)
+//-------------------------------------------------------------------------
+{
+   key[0]     = stream_key;
+   key[1]     = (unsigned int) seed;
+   counter[0] = 0;
+   counter[1] = 0;
+   counter[2] = substream;
+   counter[3] = (unsigned int) (seed >> 32);
+   next_word  = 4*RANDOM_STREAM_BUFFER_BLOCKS;
+}
+
+//-------------------------------------------------------------------------
+void RandomStream::Philox (unsigned int block[4], const unsigned int counter[4], const unsigned int key[2])
+//-------------------------------------------------------------------------
+{
+   unsigned int         c0 = counter[0], c1 = counter[1], c2 = counter[2], c3 = counter[3];
+   unsigned int         k0 = key[0], k1 = key[1];
+   unsigned long long   p0, p1;
+   int                  round;
+
+   for (round = 0; round < 10; round++)
+   {
+      p0 = (unsigned long long) PHILOX_M0 * c0;
+      p1 = (unsigned long long) PHILOX_M1 * c2;
+      c0 = (unsigned int) (p1 >> 32) ^ c1 ^ k0;
+      c2 = (unsigned int) (p0 >> 32) ^ c3 ^ k1;
+      c1 = (unsigned int) p1;
+      c3 = (unsigned int) p0;
+      k0 += PHILOX_W0;
+      k1 += PHILOX_W1;
+   }
+   block[0] = c0;
+   block[1] = c1;
+   block[2] = c2;
+   block[3] = c3;
+}
+
+//-------------------------------------------------------------------------
+void RandomStream::Refill ()
+//-------------------------------------------------------------------------
+{
+   int   i;
+
+// The 64-bit block number is the first two counter words
+   for (i = 0; i < RANDOM_STREAM_BUFFER_BLOCKS; i++)
+   {
+      Philox (&words[4*i], counter, key);
+      if (++counter[0] == 0)
+         counter[1]++;
+   }
+   next_word = 0;
+}
+
+//-------------------------------------------------------------------------
+double RandomStream::Normal ()
+//-------------------------------------------------------------------------
+{
+   unsigned int         a, b, layer;
+   unsigned long long   bits;
+   double               u, x, f0, f1;
+
+   pthread_once (&Tables_Once, Build_Tables);
+   for (;;)
+   {
+// Layer from 7 bits, signed uniform (-1,1) from the other 52 bits of two words
+      a     = Word ();
+      b     = Word ();
+      layer = a & (RANDOM_STREAM_ZIGGURAT_LAYERS-1);
+      bits  = ((unsigned long long) (a >> 7) << 27) | (b >> 5);
+      u     = (bits + 0.5) * (1.0 / 2251799813685248.0) - 1.0;
+
+// Inside the rectangle of the layer (about 99% of the samples)
+      if (fabs (u) < Zig_R[layer])
+         return u * Zig_X[layer];
+      if (layer == 0)
+         return Normal_Tail (ZIGGURAT_R, u < 0.);
+
+// Wedge of the layer, accepted under the density
+      x  = u * Zig_X[layer];
+      f0 = exp (-0.5 * (Zig_X[layer]   * Zig_X[layer]   - x * x));
+      f1 = exp (-0.5 * (Zig_X[layer+1] * Zig_X[layer+1] - x * x));
+      if (f1 + Uniform () * (f0 - f1) < 1.0)
+         return x;
+   }
+}
+
+//-------------------------------------------------------------------------
+double RandomStream::Normal_Tail (double x_min, bool negative)
+//-------------------------------------------------------------------------
+{
+   double   x, y;
+
+   do
+   {
+      x = log (Uniform ()) / x_min;
+      y = log (Uniform ());
+   } while (-2. * y < x * x);
+   return negative ? x - x_min : x_min - x;
+}
+
+//-------------------------------------------------------------------------
+void RandomStream::Uniform_Block (double *samples, int n_samples)
+//-------------------------------------------------------------------------
+{
+   int   i;
+
+   for (i = 0; i < n_samples; i++)
+      samples[i] = Uniform ();
+}
+
+//-------------------------------------------------------------------------
+void RandomStream::Normal_Block (double *samples, int n_samples, double mean, double sigma)
+//-------------------------------------------------------------------------
+{
+   int   i;
+
+   for (i = 0; i < n_samples; i++)
+      samples[i] = mean + sigma * Normal ();
+}
+
+//-------------------------------------------------------------------------
+void RandomStream::Build_Tables ()
+//-------------------------------------------------------------------------
+{
+   double   f;
+   int      i;
+
+// Layers of equal area V under the normal density (not normalized), the base layer includes the tail beyond R
+   f        = exp (-0.5 * ZIGGURAT_R * ZIGGURAT_R);
+   Zig_X[0] = ZIGGURAT_V / f;
+   Zig_X[1] = ZIGGURAT_R;
+   Zig_X[RANDOM_STREAM_ZIGGURAT_LAYERS] = 0.;
+   for (i = 2; i < RANDOM_STREAM_ZIGGURAT_LAYERS; i++)
+   {
+      Zig_X[i] = sqrt (-2. * log (ZIGGURAT_V / Zig_X[i-1] + f));
+      f        = exp (-0.5 * Zig_X[i] * Zig_X[i]);
+   }
+   for (i = 0; i < RANDOM_STREAM_ZIGGURAT_LAYERS; i++)
+      Zig_R[i] = Zig_X[i+1] / Zig_X[i];
+}
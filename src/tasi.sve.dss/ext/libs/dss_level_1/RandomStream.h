@@ -0,0 +1,99 @@
+#if !defined(__RandomStream_h) // Use file only if it's not already included.
+#define __RandomStream_h
+
+/******************************************************************************
+
+    PROJECT:      DSS - S/C Dynamics Simulation Software
+    FILE:         RandomStream.h
+    RELEASE:      0.01
+    AUTHOR:       DSS Team
+    DATE:         2026/10/19
+
+    OVERVIEW
+    ========
+    Header file for the Random Stream: counter-based pseudo-random numbers
+    generator (Philox4x32-10, Salmon et al., "Parallel Random Numbers: As
+    Easy as 1, 2, 3", SC11) with a ziggurat normal sampler (Marsaglia and
+    Tsang, 128 layers, Doornik's variant).
+    Each block of random words is a pure function of the key (stream key
+    and seed) and of the block counter, so a stream gives the same numbers
+    whatever thread runs it and whatever the other streams do: each Model
+    owns its stream, keyed by the hash of its name (see GenericObject
+    "Random_Stream").
+    The stream state is plain data (no constructor, no pointers): it is
+    valid when zeroed, it is reset by "Seed" and it is saved and restored
+    together with the Model instance memory. The ziggurat tables are shared
+    by all the streams and built by the first "Normal" of the process.
+
+    CHANGE LOG
+    ==========
+   DSS Team       2026/10/19  The ziggurat tables are built by "Normal" instead of "Seed": a zeroed, never seeded
+                              stream sampled on empty tables.
+
+******************************************************************************/
+
+#include <pthread.h>
+
+#define  RANDOM_STREAM_BUFFER_BLOCKS      4                             //!< Number of the Philox <b>blocks</b> (4 words each) generated at a time
+#define  RANDOM_STREAM_ZIGGURAT_LAYERS    128                           //!< Number of the <b>ziggurat layers</b> of the normal sampler
+
+/**
+* Class definition for the counter-based <b>Random Stream</b>.
+*/
+
+class RandomStream
+{
+
+/*-------------------------------------------------------------------------
+   Data declarations
+-------------------------------------------------------------------------*/
+
+private:
+
+   unsigned int               key[2];                          //!<  Philox <b>key</b>: stream key and seed low word
+   unsigned int               counter[4];                      //!<  Philox <b>counter</b> of the next block: block number (2 words), substream, seed high word
+   unsigned int               words[4*RANDOM_STREAM_BUFFER_BLOCKS]; //!<  Generated <b>random words</b> not used yet
+   int                        next_word;                       //!<  Index of the next random word to be used (buffer empty when 4*RANDOM_STREAM_BUFFER_BLOCKS)
+
+   static double              Zig_X[RANDOM_STREAM_ZIGGURAT_LAYERS+1]; //!<  Ziggurat layers <b>abscissae</b>
+   static double              Zig_R[RANDOM_STREAM_ZIGGURAT_LAYERS];   //!<  Ziggurat layers <b>ratios</b> X[i+1]/X[i]
+   static pthread_once_t      Tables_Once;                     //!<  Once-only initialization of the ziggurat tables
+
+/*-------------------------------------------------------------------------
+   Function declarations
+-------------------------------------------------------------------------*/
+
+public:
+
+/** Public Method to (re)start the stream: the numbers depend only on the stream key, the seed and the substream*/
+   void                          Seed (unsigned int stream_key /*! <b>Stream key</b>, e.g. the hash of the Model name*/, unsigned long long seed /*! <b>Seed</b>*/, unsigned int substream = 0 /*! <b>Substream</b>, for independent streams of the same owner*/);
+
+/** Public Method returning a <b>random 32-bit word</b>*/
+   inline unsigned int           Word ()                 {if (next_word >= 4*RANDOM_STREAM_BUFFER_BLOCKS) Refill (); return words[next_word++];};
+/** Public Method returning a <b>uniform</b> sample in (0,1), 53-bit resolution*/
+   inline double                 Uniform ()              {unsigned int a = Word () >> 5, b = Word () >> 6; return (a * 67108864.0 + b + 0.5) * (1.0 / 9007199254740992.0);};
+/** Public Method returning a <b>standard normal</b> sample (ziggurat)*/
+   double                        Normal ();
+/** Public Method returning a <b>normal</b> sample*/
+   inline double                 Normal (double mean /*! <b>Mean</b> value*/, double sigma /*! <b>Standard deviation</b>*/) {return mean + sigma * Normal ();};
+
+/** Public Method filling a buffer with <b>uniform</b> samples in (0,1)*/
+   void                          Uniform_Block (double *samples /*! <b>Samples</b> buffer*/, int n_samples /*! Number of the samples*/);
+/** Public Method filling a buffer with <b>normal</b> samples*/
+   void                          Normal_Block (double *samples /*! <b>Samples</b> buffer*/, int n_samples /*! Number of the samples*/, double mean = 0. /*! <b>Mean</b> value*/, double sigma = 1. /*! <b>Standard deviation</b>*/);
+
+/** Static Public Method computing the Philox4x32-10 <b>block</b> of a counter and a key*/
+   static void                   Philox (unsigned int block[4] /*! out - <b>Random words</b>*/, const unsigned int counter[4] /*! <b>Counter</b>*/, const unsigned int key[2] /*! <b>Key</b>*/);
+
+private:
+
+/** Private Method generating the next RANDOM_STREAM_BUFFER_BLOCKS blocks of random words*/
+   void                          Refill ();
+/** Private Method returning a sample of the normal <b>tail</b> beyond "x_min"*/
+   double                        Normal_Tail (double x_min, bool negative);
+/** Static Private Method computing the <b>ziggurat tables</b>*/
+   static void                   Build_Tables ();
+
+};
+
+#endif // __RandomStream_h end
@@ -0,0 +1,100 @@
+/******************************************************************************
+
+    PROJECT:      DSS - S/C Dynamics Simulation Software
+    FILE:         SerialLinkQueue.cpp
+    RELEASE:      0.01
+    AUTHOR:       DSS Team
+    DATE:         2026/10/19
+
+    OVERVIEW
+    ========
+    Source Code for the Serial Link Queue
+
+    CHANGE LOG
+    ==========
+
+******************************************************************************/
+
+#include <string.h>
+#include "SerialLinkQueue.h"
+
+#define  RECORD_SIZE(payload_size)  ((sizeof(typ_Record) + (payload_size) + SERIAL_LINK_RECORD_ALIGN-1) & ~(unsigned long)(SERIAL_LINK_RECORD_ALIGN-1))
+
+//-------------------------------------------------------------------------
+SerialLinkQueue::SerialLinkQueue (unsigned long ring_size)
+//-------------------------------------------------------------------------
+{
+   for (capacity = SERIAL_LINK_RECORD_ALIGN; capacity < ring_size || capacity < 2*RECORD_SIZE(SERIAL_LINK_MAX_PAYLOAD); capacity <<= 1)
+      ;
+   buffer = (char*) new double[capacity / sizeof(double)]; // double-aligned records
+   head   = 0;
+   tail   = 0;
+}
+
+//-------------------------------------------------------------------------
+SerialLinkQueue::~SerialLinkQueue ()
+//-------------------------------------------------------------------------
+{
+   delete[] (double*) buffer;
+}
+
+//-------------------------------------------------------------------------
+bool SerialLinkQueue::Push (double time, typ_kind kind, int count, const void *payload, unsigned int payload_size)
+//-------------------------------------------------------------------------
+{
+   typ_Record     *record;
+   unsigned long  size, position, pad_size, used;
+
+   if (payload_size > SERIAL_LINK_MAX_PAYLOAD)
+      return false;
+   size     = RECORD_SIZE(payload_size);
+   position = head & (capacity-1);
+   pad_size = (position + size > capacity) ? capacity - position : 0; // The record does not wrap: skip the ring end
+   used     = head - __atomic_load_n (&tail, __ATOMIC_ACQUIRE);
+   if (used + pad_size + size > capacity)
+      return false;
+
+   if (pad_size)
+   {
+      record       = (typ_Record*) (buffer + position);
+      record->size = (unsigned int) pad_size;
+      record->kind = Pad;
+      position     = 0;
+   }
+   record        = (typ_Record*) (buffer + position);
+   record->time  = time;
+   record->size  = (unsigned int) size;
+   record->kind  = (unsigned short) kind;
+   record->count = (unsigned short) count;
+   if (payload_size)
+      memcpy (Payload (record), payload, payload_size);
+
+   __atomic_store_n (&head, head + pad_size + size, __ATOMIC_RELEASE); // Publish the record(s)
+   return true;
+}
+
+//-------------------------------------------------------------------------
+SerialLinkQueue::typ_Record* SerialLinkQueue::Front ()
+//-------------------------------------------------------------------------
+{
+   typ_Record     *record;
+
+   while (tail != __atomic_load_n (&head, __ATOMIC_ACQUIRE))
+   {
+      record = (typ_Record*) (buffer + (tail & (capacity-1)));
+      if (record->kind != Pad)
+         return record;
+      __atomic_store_n (&tail, tail + record->size, __ATOMIC_RELEASE);
+   }
+   return NULL;
+}
+
+//-------------------------------------------------------------------------
+void SerialLinkQueue::Pop ()
+//-------------------------------------------------------------------------
+{
+   typ_Record     *record = Front ();
+
+   if (record)
+      __atomic_store_n (&tail, tail + record->size, __ATOMIC_RELEASE);
+}
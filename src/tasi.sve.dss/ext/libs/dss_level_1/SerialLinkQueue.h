@@ -0,0 +1,105 @@
+#if !defined(__SerialLinkQueue_h) // Use file only if it's not already included.
+#define __SerialLinkQueue_h
+
+/******************************************************************************
+
+    PROJECT:      DSS - S/C Dynamics Simulation Software
+    FILE:         SerialLinkQueue.h
+    RELEASE:      0.01
+    AUTHOR:       DSS Team
+    DATE:         2026/10/19
+
+    OVERVIEW
+    ========
+    Header file for the Serial Link Queue: lock-free single-producer/
+    single-consumer byte ring buffer carrying the time-tagged records of a
+    queued Inter-Object digital data Serial Link channel.
+    Each record is a typ_Record header followed by its payload, both padded
+    to SERIAL_LINK_RECORD_ALIGN bytes; a record never wraps around the ring
+    end, the space left at the end is filled by a Pad record. The producer
+    publishes a record by advancing "head" (release), the consumer frees it
+    by advancing "tail" (release), so that the two sides can run on
+    different threads without locks.
+
+    CHANGE LOG
+    ==========
+
+******************************************************************************/
+
+#include "GenericTypes.h"
+
+#define  SERIAL_LINK_QUEUE_SIZE           65536                         //!< Default <b>ring size</b> [bytes] of a queued Serial Link channel
+#define  SERIAL_LINK_MAX_PAYLOAD          4096                          //!< Maximum <b>payload</b> [bytes] of a Serial Link record
+#define  SERIAL_LINK_RECORD_ALIGN         16                            //!< <b>Alignment</b> [bytes] of the records in the ring
+#define  SERIAL_LINK_TIME_TOLERANCE       1.0e-9                        //!< Tolerance [s] on the <b>delivery time</b> of the records
+
+/**
+* Class definition for the <b>Serial Link Queue</b>.
+*/
+
+class SerialLinkQueue
+{
+
+/*-------------------------------------------------------------------------
+   Data Type declarations
+-------------------------------------------------------------------------*/
+
+public:
+
+   enum typ_kind        /** <b>Record type</b> */
+   {
+      Pad = 0,                               //!< Filler up to the ring end (internal)
+      Data_Words,                            //!< Unsolicited 16-bit data (Serial_TransmitData)
+      Data_Bytes,                            //!< Unsolicited 8-bit data (Serial_TransmitData)
+      Request_Words,                         //!< Request of solicited 16-bit data (Serial_ReceiveData)
+      Request_Bytes,                         //!< Request of solicited 8-bit data (Serial_ReceiveData)
+      Reply_Words,                           //!< Solicited 16-bit data (Serial_ProduceData answer)
+      Reply_Bytes                            //!< Solicited 8-bit data (Serial_ProduceData answer)
+   };
+
+   struct typ_Record    /** Data structure type of the <b>record header</b> (SERIAL_LINK_RECORD_ALIGN bytes), followed by the payload */
+   {
+      double            time;                //!< <b>Delivery time</b> [s]: transmission time plus link latency
+      unsigned int      size;                //!< Record size [bytes], header and padding included
+      unsigned short    kind;                //!< <b>Record type</b> (typ_kind)
+      unsigned short    count;               //!< Number of the <b>data words or bytes</b>
+   };
+
+/*-------------------------------------------------------------------------
+   Data declarations
+-------------------------------------------------------------------------*/
+
+private:
+
+   char                       *buffer;                         //!<  Ring buffer
+   unsigned long              capacity;                        //!<  Ring size [bytes] (power of two)
+   char                       pad_producer[64];                //!<  Keeps "head" and "tail" on different cache lines
+   unsigned long              head;                            //!<  Bytes written so far (producer side)
+   char                       pad_consumer[64];                //!<  Keeps "head" and "tail" on different cache lines
+   unsigned long              tail;                            //!<  Bytes read so far (consumer side)
+
+/*-------------------------------------------------------------------------
+   Function declarations
+-------------------------------------------------------------------------*/
+
+public:
+
+/** Class <b>Constructor</b>: the ring size is rounded up to a power of two*/
+   SerialLinkQueue (unsigned long ring_size = SERIAL_LINK_QUEUE_SIZE /*! <b>Ring size</b> [bytes]*/);
+/** Class <b>Destructor</b>*/
+   ~SerialLinkQueue ();
+
+/** Public Method [producer side] to <b>append a record</b>. Returns false if the ring is full or the payload exceeds SERIAL_LINK_MAX_PAYLOAD*/
+   bool                          Push (double time /*! <b>Delivery time</b> [s]*/, typ_kind kind /*! <b>Record type</b>*/, int count /*! Number of the data words or bytes*/, const void *payload /*! <b>Payload</b> (may be NULL if "payload_size" is 0)*/, unsigned int payload_size /*! Payload size [bytes]*/);
+/** Public Method [consumer side] returning the <b>oldest record</b>, NULL if the ring is empty. The record stays valid until "Pop"*/
+   typ_Record*                   Front ();
+/** Public Method [consumer side] to <b>free the oldest record</b> returned by "Front"*/
+   void                          Pop ();
+/** Public Method returning the <b>payload</b> of a record*/
+   static inline void*           Payload (typ_Record *record)  {return record + 1;};
+/** Public Method returning the <b>ring occupancy</b> [bytes]*/
+   inline unsigned long          Used ()           {return __atomic_load_n (&head, __ATOMIC_ACQUIRE) - __atomic_load_n (&tail, __ATOMIC_ACQUIRE);};
+
+};
+
+#endif // __SerialLinkQueue_h end
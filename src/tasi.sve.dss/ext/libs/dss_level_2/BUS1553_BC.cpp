@@ -0,0 +1,371 @@
+/******************************************************************************
+*
+*    PROJECT:      DSS - S/C Dynamics Simulation Software
+*    FILE:         BUS1553_BC.cpp
+*    RELEASE:      0.01
+*    AUTHOR:       DSS Team
+*    DATE:         2026/10/19
+*
+*    OVERVIEW
+*    ========
+*    Source file for the BUS1553_BC Model (MIL-STD-1553B Bus Controller
+*    frame scheduler)
+*
+*    CHANGE LOG
+*    ==========
+*    DSS Team       2026/10/19  "Serial_Initialization_Flag" set: the Model updating calls the RT's
+*                               handlers, it is not updated concurrently with the other Models.
+*    DSS Team       2026/10/19  The frames schedule starts at the initialization epoch, as after "Command_Switch_ON".
+*
+******************************************************************************/
+#include "BUS1553_BC.h"
+#include <cstdlib>
+#include <cstring>
+
+// Static Data Initialization
+
+const CommandTable::typ_CommandSchema BUS1553_BC::Command_Schemas[] =
+{
+   {"ENABLE_MESSAGE",      Cmd_Enable_Message,     "ii"},
+   {"SET_MESSAGE_DATA",    Cmd_Set_Message_Data,   "iw+"},
+   {"RESET_BUS_STATS",     Cmd_Reset_Bus_Stats,    ""},
+   {NULL,                  0,                      NULL}
+};
+const CommandTable BUS1553_BC::Command_Table (Command_Schemas);
+
+//-------------------------------------------------------------------------
+BUS1553_BC::BUS1553_BC (const char* ModelName)
+      :GenericObject (ModelName, sizeof(BUS1553_BC) , sizeof(X), sizeof(U), sizeof(Y), &X, &Xdot, &U, &Y)
+//-------------------------------------------------------------------------
+{
+   message       = NULL;
+   n_messages    = 0;
+   frame_message = NULL;
+   frame_first   = NULL;
+   memset (&P, '\0', sizeof(P));
+   Serial_Initialization_Flag = true; // The updating serves the RT's, not to be run concurrently with them
+}
+
+//-------------------------------------------------------------------------
+BUS1553_BC::~BUS1553_BC ()
+//-------------------------------------------------------------------------
+{
+   Free_Schedule ();
+}
+
+//-------------------------------------------------------------------------
+void   BUS1553_BC::Free_Schedule ()
+//-------------------------------------------------------------------------
+{
+   delete[] message;
+   delete[] frame_message;
+   delete[] frame_first;
+   message       = NULL;
+   frame_message = NULL;
+   frame_first   = NULL;
+   n_messages    = 0;
+}
+
+//-------------------------------------------------------------------------
+void   BUS1553_BC::Initialize     (typ_return &result)
+//-------------------------------------------------------------------------
+{
+   result = Nominal;
+   Free_Schedule ();
+   memset (&Y, '\0', sizeof(Y));
+
+   /* ********************************************************
+   * MAJOR/MINOR FRAME STRUCTURE
+   ***********************************************************/
+   if (input_file->load (&P.minor_frames,       Name, "MINOR_FRAMES",       1) == Error
+    || input_file->load (&P.minor_frame_period, Name, "MINOR_FRAME_PERIOD", 1) == Error)
+      result = Error;
+   if (P.minor_frames < 1 || P.minor_frames > BUS1553_MAX_MINOR_FRAMES || P.minor_frame_period <= 0.0)
+   {
+      Log_Error ("%s : MINOR_FRAMES shall be in [1, %d] and MINOR_FRAME_PERIOD shall be positive", Name, BUS1553_MAX_MINOR_FRAMES);
+      P.minor_frames = 0;
+      result         = Error;
+   }
+   /* ********************************************************
+   * BUS TIMING [s]
+   ***********************************************************/
+   P.rt_response_time = 8.0e-6;
+   P.intermessage_gap = 4.0e-6;
+   input_file->load (&P.rt_response_time, Name, "RT_RESPONSE_TIME", 1, false);
+   input_file->load (&P.intermessage_gap, Name, "INTERMESSAGE_GAP", 1, false);
+
+   /* ********************************************************
+   * MESSAGES SCHEDULE
+   ***********************************************************/
+   if (P.minor_frames > 0 && Load_Schedule () == Error)
+      result = Error;
+
+   // The BC starts executing the schedule from the minor frame 0
+   OFF_ON_Switch_Status = On;
+   next_minor_frame     = 0;
+   frame_origin         = Get_Current_Epoch ();
+   frame_counter        = 0.0;
+   total_bus_time       = 0.0;
+   total_frames         = 0.0;
+
+   // Publish the OUTPUT data
+   Publish (&Y.minor_frame,       1, "Y.minor_frame",       "");
+   Publish (&Y.major_frames,      1, "Y.major_frames",      "");
+   Publish (&Y.frame_bus_time,    1, "Y.frame_bus_time",    "s");
+   Publish (&Y.bus_load,          1, "Y.bus_load",          "");
+   Publish (&Y.peak_bus_load,     1, "Y.peak_bus_load",     "");
+   Publish (&Y.average_bus_load,  1, "Y.average_bus_load",  "");
+   Publish (&Y.transactions,      1, "Y.transactions",      "");
+   Publish (&Y.no_responses,      1, "Y.no_responses",      "");
+   Publish (&Y.overruns,          1, "Y.overruns",          "");
+
+   Log_Message ("%s : %d messages scheduled over %d minor frames of %g s", Name, n_messages, P.minor_frames, P.minor_frame_period);
+}
+
+//-------------------------------------------------------------------------
+typ_return BUS1553_BC::Load_Schedule ()
+//-------------------------------------------------------------------------
+{
+   typ_return     result = Nominal;
+   typ_message    *msg;
+   char           line[TOKEN_SIZE], *token, *save;
+   int            i, n_rows, old_error, n_words, frame;
+
+   input_file->DisableLineTokenizer(); // Acquire each schedule line as a single token
+   n_rows = input_file->GetRowsNumber (Name, "BUS1553_SCHEDULE", 1);
+   if (n_rows > 0)
+   {
+      old_error = input_file->error;
+      if (input_file->readSymbol (Name, "BUS1553_SCHEDULE", n_rows) == Nominal && old_error == input_file->error)
+      {
+         message = new typ_message[n_rows];
+// Each entry is: "minor_frame, TYPE, rt, subaddress/mode_code[, word_count][, word1, word2, ...]"
+         for (i = 0; i < n_rows; i++)
+         {
+            strncpy (line, input_file->buffer + i*TOKEN_SIZE, TOKEN_SIZE-1);
+            line[TOKEN_SIZE-1] = '\0';
+            msg = &message[n_messages];
+            memset (msg, '\0', sizeof(typ_message));
+            msg->enabled = true;
+
+            token = strtok_r (line, " ,\t", &save);
+            msg->minor_frame = token ? atoi (token) : -1;
+            token = strtok_r (NULL, " ,\t", &save);
+            if (!token)                   msg->minor_frame = -1;
+            else if (!strcmp (token, "BC_RT")) msg->type = BC_RT;
+            else if (!strcmp (token, "RT_BC")) msg->type = RT_BC;
+            else if (!strcmp (token, "MC_RX")) msg->type = MC_RX;
+            else if (!strcmp (token, "MC_TX")) msg->type = MC_TX;
+            else                          msg->minor_frame = -1;
+            token = strtok_r (NULL, " ,\t", &save);
+            msg->rt = token ? atoi (token) : 0;
+            token = strtok_r (NULL, " ,\t", &save);
+            msg->sa = token ? atoi (token) : -1;
+
+            if (msg->type == BC_RT || msg->type == RT_BC)
+            {
+               token = strtok_r (NULL, " ,\t", &save);
+               msg->word_count = token ? atoi (token) : 0;
+               if (msg->sa < 1 || msg->sa > 30 || msg->word_count < 1 || msg->word_count > 32)
+                  msg->minor_frame = -1;
+            }
+            else
+            {
+               msg->word_count = (msg->sa >= 16) ? 1 : 0; // Mode codes 16..31 have one data word
+               if (msg->sa < 0 || msg->sa > 31)
+                  msg->minor_frame = -1;
+            }
+            if (msg->rt < 1 || msg->rt > 31 || (msg->rt == B1553_BROADCAST_ADDRES && (msg->type == RT_BC || (msg->type == MC_TX && msg->word_count))))
+               msg->minor_frame = -1;
+
+            // BC-to-RT data words (the not provided ones are 0)
+            for (n_words = 0; (token = strtok_r (NULL, " ,\t", &save)) != NULL; n_words++)
+               if (n_words < msg->word_count && (msg->type == BC_RT || msg->type == MC_RX))
+                  msg->words[n_words] = (unsigned short) _AtoI (token);
+               else
+                  msg->minor_frame = -1;
+
+            if (msg->minor_frame < 0 || msg->minor_frame >= P.minor_frames)
+            {
+               Log_Error ("%s : \"BUS1553_SCHEDULE\" entry \"%s\" is not valid, it has been ignored", Name, input_file->buffer + i*TOKEN_SIZE);
+               result = Error;
+               continue;
+            }
+            n_messages++;
+         }
+      }
+      else
+         result = Error;
+   }
+   input_file->EnableLineTokenizer(); // Enable (default) the instruction lines tokenization
+
+// Group the messages by minor frame, keeping the schedule order inside each frame
+   frame_first   = new int[P.minor_frames+1];
+   frame_message = new int[n_messages > 0 ? n_messages : 1];
+   memset (frame_first, '\0', (P.minor_frames+1)*sizeof(int));
+   for (i = 0; i < n_messages; i++)
+      frame_first[message[i].minor_frame+1]++;
+   for (frame = 0; frame < P.minor_frames; frame++)
+      frame_first[frame+1] += frame_first[frame];
+   for (i = 0; i < n_messages; i++)
+      frame_message[frame_first[message[i].minor_frame]++] = i;
+   for (frame = P.minor_frames; frame > 0; frame--) // Restore the first items shifted by the filling
+      frame_first[frame] = frame_first[frame-1];
+   frame_first[0] = 0;
+
+   return result;
+}
+
+//-------------------------------------------------------------------------
+void   BUS1553_BC::Update         (typ_return &result, double time, bool is_the_final_updating)
+//-------------------------------------------------------------------------
+{
+   double   epoch = Get_Current_Epoch (), frame_time;
+
+   result = Nominal;
+   if (!is_the_final_updating || Get_off_on () != On || !frame_first)
+      return;
+
+   // Execute all the minor frames whose boundary is elapsed, each one as a single batch
+   while ((frame_time = frame_origin + frame_counter * P.minor_frame_period) <= time + BUS1553_FRAME_TIME_TOLERANCE)
+   {
+      Set_Current_Epoch (frame_time); // The transactions are recorded at the frame boundary
+      Execute_Minor_Frame (next_minor_frame);
+      frame_counter += 1.0;
+      if (++next_minor_frame == P.minor_frames)
+      {
+         next_minor_frame = 0;
+         Y.major_frames  += 1.0;
+      }
+   }
+   Set_Current_Epoch (epoch);
+}
+
+//-------------------------------------------------------------------------
+double BUS1553_BC::Execute_Minor_Frame (int minor_frame)
+//-------------------------------------------------------------------------
+{
+   double   bus_time = 0.0;
+   int      i;
+
+   if (minor_frame < 0 || minor_frame >= P.minor_frames || !frame_first)
+      return 0.0;
+
+   for (i = frame_first[minor_frame]; i < frame_first[minor_frame+1]; i++)
+      if (message[frame_message[i]].enabled)
+         bus_time += Execute_Message (&message[frame_message[i]]) + P.intermessage_gap;
+
+   // Bus load statistics
+   Y.minor_frame     = minor_frame;
+   Y.frame_bus_time  = bus_time;
+   Y.bus_load        = bus_time / P.minor_frame_period;
+   if (Y.bus_load > Y.peak_bus_load)
+      Y.peak_bus_load = Y.bus_load;
+   total_bus_time   += bus_time;
+   total_frames     += 1.0;
+   Y.average_bus_load = total_bus_time / (total_frames * P.minor_frame_period);
+   if (bus_time > P.minor_frame_period)
+   {
+      Y.overruns += 1.0;
+      DSS_WARNING ("%s : minor frame %d bus time %g s exceeds the minor frame period", Name, minor_frame, bus_time);
+   }
+   return bus_time;
+}
+
+//-------------------------------------------------------------------------
+double BUS1553_BC::Execute_Message (typ_message *msg)
+//-------------------------------------------------------------------------
+{
+   unsigned short words[32];
+   bool           broadcast = (msg->rt == B1553_BROADCAST_ADDRES);
+   bool           present   = broadcast || Get_Rt1553 (msg->rt) != NULL;
+   int            bc_words  = (msg->type == BC_RT || msg->type == MC_RX) ? msg->word_count : 0;
+   int            rt_words  = msg->word_count - bc_words;
+   double         bus_time;
+
+   Y.transactions += 1.0;
+   if (present)
+   {
+      // The RT handlers work on a copy of the BC-to-RT words, the RT-to-BC words are kept in the message
+      memcpy (words, msg->words, sizeof(words));
+      switch (msg->type)
+      {
+         case BC_RT:
+            Bc1553_ReceiveData (msg->rt, (unsigned char) msg->sa, (unsigned char) msg->word_count, words);
+            break;
+         case RT_BC:
+            Bc1553_TransmitData (msg->rt, (unsigned char) msg->sa, (unsigned char) msg->word_count, msg->words);
+            break;
+         case MC_RX:
+            Bc1553_ReceiveModeCommand (msg->rt, DSS_RX, (typ_B1553_ModeCode) msg->sa, words);
+            break;
+         case MC_TX:
+            Bc1553_ReceiveModeCommand (msg->rt, DSS_TX, (typ_B1553_ModeCode) msg->sa, msg->words);
+            break;
+      }
+   }
+
+   // Command word and BC-to-RT data words, then RT status word and RT-to-BC data words (no status if broadcast)
+   bus_time = (1 + bc_words) * BUS1553_WORD_TIME;
+   if (!broadcast)
+   {
+      if (present)
+         bus_time += P.rt_response_time + (1 + rt_words) * BUS1553_WORD_TIME;
+      else
+      {
+         bus_time += BUS1553_NO_RESPONSE_TIMEOUT;
+         Y.no_responses += 1.0;
+      }
+   }
+   return bus_time;
+}
+
+//-------------------------------------------------------------------------
+typ_return BUS1553_BC::Command_Switch_ON ()
+//-------------------------------------------------------------------------
+{
+   GenericObject::Command_Switch_ON ();
+   // The schedule restarts from the minor frame 0 at the switch ON time
+   next_minor_frame = 0;
+   frame_origin     = Get_Current_Epoch ();
+   frame_counter    = 0.0;
+   return Nominal;
+}
+
+//-------------------------------------------------------------------------
+void  BUS1553_BC::Local_Command  (typ_return &result, int command_id, int n_args, const CommandTable::typ_CommandArg args[])
+//-------------------------------------------------------------------------
+{
+   typ_message    *msg = (command_id != Cmd_Reset_Bus_Stats) ? Get_Message (args[0].i) : NULL;
+   int            i;
+
+   result = Error;
+   switch (command_id)
+   {
+      case Cmd_Enable_Message:
+         if (!msg)
+            break;
+         msg->enabled = (args[1].i != 0);
+         result       = Nominal;
+         break;
+      case Cmd_Set_Message_Data:
+         if (!msg || (msg->type != BC_RT && msg->type != MC_RX) || n_args-1 > msg->word_count)
+            break;
+         for (i = 1; i < n_args; i++)
+            msg->words[i-1] = (unsigned short) args[i].i;
+         result = Nominal;
+         break;
+      case Cmd_Reset_Bus_Stats:
+         Y.peak_bus_load    = 0.0;
+         Y.average_bus_load = 0.0;
+         Y.transactions     = 0.0;
+         Y.no_responses     = 0.0;
+         Y.overruns         = 0.0;
+         total_bus_time     = 0.0;
+         total_frames       = 0.0;
+         result             = Nominal;
+         break;
+   }
+   if (result == Error && command_id != Cmd_Reset_Bus_Stats)
+      Log_Warning ("%s : message %d is not scheduled, or its data words cannot be set", Name, args[0].i);
+}
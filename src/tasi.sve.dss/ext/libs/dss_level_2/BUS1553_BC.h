@@ -0,0 +1,185 @@
+#if !defined(__BUS1553_BC_h) // Sentry, use file only if it's not already included.
+#define __BUS1553_BC_h
+
+/******************************************************************************
+*
+*    PROJECT:      DSS - S/C Dynamics Simulation Software
+*    FILE:         BUS1553_BC.h
+*    RELEASE:      0.01
+*    AUTHOR:       DSS Team
+*    DATE:         2026/10/19
+*
+*    OVERVIEW
+*    ========
+*    Header file for the BUS1553_BC Model: MIL-STD-1553B Bus Controller
+*    executing a major/minor frame schedule.
+*    At each minor frame boundary the whole transaction list of the minor
+*    frame is executed in one batch against the RT dispatch table
+*    (GenericObject::Bc1553_*), and the bus occupancy of the frame is
+*    computed with the 1553B word and message timing model (1 Mbit/s, 20 us
+*    per word, RT response time, no-response timeout, intermessage gap).
+*
+*    SET FILE PARAMETERS
+*    ===================
+*       <Name>.MINOR_FRAMES        = number of minor frames per major frame
+*       <Name>.MINOR_FRAME_PERIOD  = minor frame period [s]
+*       <Name>.RT_RESPONSE_TIME    = RT status response time [s]       (optional, default 8 us)
+*       <Name>.INTERMESSAGE_GAP    = gap between two messages [s]      (optional, default 4 us)
+*       <Name>.BUS1553_SCHEDULE    = [
+*          minor_frame, BC_RT, rt, sa, word_count [, word1, word2, ...]
+*          minor_frame, RT_BC, rt, sa, word_count
+*          minor_frame, MC_RX, rt, mode_code [, data_word]
+*          minor_frame, MC_TX, rt, mode_code
+*       ]
+*    Words are decimal or hexadecimal with '#' prefix; rt 31 is broadcast.
+*    The messages are identified by their row [1..n] in the schedule.
+*
+*    MODEL COMMANDS
+*    ==============
+*       ENABLE_MESSAGE,message,flag         enable (1) / disable (0) a message
+*       SET_MESSAGE_DATA,message,w1,w2,...  BC-to-RT data words (or mode code data word)
+*       RESET_BUS_STATS                     reset the bus statistics
+*
+*    CHANGE LOG
+*    ==========
+*
+******************************************************************************/
+
+#include "../dss_level_1/GenericObject.h"
+
+#define BUS1553_WORD_TIME              20.0e-6     //!< Transmission time of a 1553 word (3 us sync + 16 data bits + parity at 1 Mbit/s) [s]
+#define BUS1553_NO_RESPONSE_TIMEOUT    14.0e-6     //!< Bus Controller no-response timeout [s]
+#define BUS1553_MAX_MINOR_FRAMES       1024        //!< Maximum number of minor frames per major frame
+#define BUS1553_FRAME_TIME_TOLERANCE   1.0e-9      //!< Tolerance on the minor frame boundary time [s]
+
+/**
+* Class definition for the MIL-STD-1553B Bus Controller Model.
+*/
+
+class BUS1553_BC : public GenericObject
+{
+
+/*-------------------------------------------------------------------------
+   Data Type Definition
+-------------------------------------------------------------------------*/
+
+public:
+
+   struct typ_status /** Type STATUS shall be mandatory implemented (eventually empty) at BUS1553_BC HW Model */
+   {
+   };
+
+   struct typ_input /** Type INPUT shall be mandatory implemented (eventually empty) at BUS1553_BC HW Model */
+   {
+   };
+
+   struct typ_output /** Type OUTPUT shall be mandatory implemented (eventually empty) at BUS1553_BC HW Model */
+   {
+      double minor_frame;           //!< Index of the last executed minor frame [0..n-1]
+      double major_frames;          //!< Number of the completed major frames
+      double frame_bus_time;        //!< Bus occupancy time of the last executed minor frame [s]
+      double bus_load;              //!< Bus load of the last executed minor frame [0..1]
+      double peak_bus_load;         //!< Peak minor frame bus load [0..1]
+      double average_bus_load;      //!< Average bus load since the statistics reset [0..1]
+      double transactions;          //!< Number of the executed transactions
+      double no_responses;          //!< Number of the transactions addressed to a not present RT
+      double overruns;              //!< Number of the minor frames whose bus time exceeds the period
+   };
+
+   struct typ_parameters  /** Type PARAMETER shall be mandatory implemented (eventually empty) at BUS1553_BC HW Model */
+   {
+      int    minor_frames;          //!< Number of minor frames per major frame
+      double minor_frame_period;    //!< Minor frame period [s]
+      double rt_response_time;      //!< RT status response time [s]
+      double intermessage_gap;      //!< Gap between two messages [s]
+   };
+
+   enum typ_message_type  /** BUS 1553 <b>message (transaction) type</b> */
+   {
+      BC_RT = 0,                    //!< BC-to-RT data transfer (Bc1553_ReceiveData)
+      RT_BC,                        //!< RT-to-BC data transfer (Bc1553_TransmitData)
+      MC_RX,                        //!< Mode command, data word (if any) from the BC
+      MC_TX                         //!< Mode command, data word (if any) from the RT
+   };
+
+   struct typ_message  /** Scheduled BUS 1553 <b>message</b> */
+   {
+      int               minor_frame;   //!< Minor frame the message belongs to
+      typ_message_type  type;          //!< Message type
+      int               rt;            //!< RT address (31 broadcast)
+      int               sa;            //!< Subaddress, or mode code
+      int               word_count;    //!< Number of the data words
+      bool              enabled;       //!< Flag to say the message is executed
+      unsigned short    words[32];     //!< Data words (BC-to-RT data, or last RT-to-BC data)
+   };
+
+   enum typ_command  /** Identifiers of the BUS1553_BC Model commands */
+   {
+      Cmd_Enable_Message = 1,       //!< ENABLE_MESSAGE,message,flag
+      Cmd_Set_Message_Data,         //!< SET_MESSAGE_DATA,message,word1,word2,...
+      Cmd_Reset_Bus_Stats           //!< RESET_BUS_STATS
+   };
+
+/*-------------------------------------------------------------------------
+   Data declarations
+-------------------------------------------------------------------------*/
+
+public:
+
+   typ_status     X;       //!< STATUS X shall be mandatory instanciated at Level 2 HW Model
+   typ_status     Xdot;    //!< STATUS DERIVATIVE Xdot shall be mandatory instanciated at Level 2 HW Model
+   typ_input      U;       //!< INPUT  U shall be mandatory instanciated at Level 2 HW Model
+   typ_output     Y;       //!< OUTPUT Y shall be mandatory instanciated at Level 2 HW Model
+   typ_parameters P;       //!< PARAMETER P shall be mandatory instanciated at Level 2 HW Model
+
+private:
+
+   typ_message    *message;            //!< Scheduled messages, in schedule order
+   int            n_messages;          //!< Number of the scheduled messages
+   int            *frame_message;      //!< Messages indexes grouped by minor frame
+   int            *frame_first;        //!< First "frame_message" item of each minor frame ([minor_frames+1])
+   int            next_minor_frame;    //!< Next minor frame to be executed
+   double         frame_origin;        //!< Time of the first minor frame since the BC switch ON [s]
+   double         frame_counter;       //!< Number of the minor frames executed since the BC switch ON
+   double         total_bus_time;      //!< Bus occupancy time since the statistics reset [s]
+   double         total_frames;        //!< Number of the minor frames executed since the statistics reset
+
+protected:
+
+   static const CommandTable::typ_CommandSchema Command_Schemas[];   //!< Schemas of the BUS1553_BC Model commands
+   static const CommandTable                    Command_Table;       //!< Perfect-hash table of the BUS1553_BC Model commands
+
+/*-------------------------------------------------------------------------
+   Function declarations
+-------------------------------------------------------------------------*/
+
+public:
+
+   BUS1553_BC (const char* ModelName);
+   ~BUS1553_BC ();
+
+   void   Initialize     (typ_return &result);
+   void   Update         (typ_return &result, double time, bool is_the_final_updating = true);
+   void   Local_Command  (typ_return &result, int command_id, int n_args, const CommandTable::typ_CommandArg args[]);
+   const CommandTable* Get_Command_Table () {return &Command_Table;};
+   typ_return Command_Switch_ON ();
+
+/** Public Method to execute one <b>minor frame</b> transaction list in one batch; it returns the frame bus occupancy time [s]*/
+   double                  Execute_Minor_Frame (int minor_frame);
+/** Public Method to return a scheduled <b>message</b> [1..n] (NULL if not existing), e.g. to read the last RT-to-BC data*/
+   inline typ_message*     Get_Message (int index)    {return (1 <= index && index <= n_messages) ? &message[index-1] : NULL;};
+/** Public Method to return the number of the scheduled <b>messages</b>*/
+   inline int              Get_N_Messages ()          {return n_messages;};
+
+private:
+
+/** Private Method to load the <b>BUS1553_SCHEDULE</b> table from the set file*/
+   typ_return              Load_Schedule ();
+/** Private Method to execute one message, returning its bus occupancy time [s]*/
+   double                  Execute_Message (typ_message *msg);
+/** Private Method to release the schedule*/
+   void                    Free_Schedule ();
+
+};
+
+#endif // __BUS1553_BC_h sentry.
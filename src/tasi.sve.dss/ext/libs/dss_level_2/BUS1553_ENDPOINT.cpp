@@ -0,0 +1,116 @@
+/******************************************************************************
+*
+*    PROJECT:      DSS - S/C Dynamics Simulation Software
+*    FILE:         BUS1553_ENDPOINT.cpp
+*    RELEASE:      0.01
+*    AUTHOR:       DSS Team
+*    DATE:         2026/10/19
+*
+*    OVERVIEW
+*    ========
+*    Source file for the BUS1553_ENDPOINT Model (local IPC endpoint of an
+*    external 1553 Bus Controller)
+*
+*    CHANGE LOG
+*    ==========
+*    DSS Team       2026/10/19  "Serial_Initialization_Flag" set: the Model updating calls the RT's
+*                               handlers, it is not updated concurrently with the other Models.
+*
+******************************************************************************/
+#include "BUS1553_ENDPOINT.h"
+#include <cstring>
+
+//-------------------------------------------------------------------------
+BUS1553_ENDPOINT::BUS1553_ENDPOINT (const char* ModelName)
+      :GenericObject (ModelName, sizeof(BUS1553_ENDPOINT) , sizeof(X), sizeof(U), sizeof(Y), &X, &Xdot, &U, &Y)
+//-------------------------------------------------------------------------
+{
+   memset (&P, '\0', sizeof(P));
+   Serial_Initialization_Flag = true; // The updating serves the RT's, not to be run concurrently with them
+}
+
+//-------------------------------------------------------------------------
+BUS1553_ENDPOINT::~BUS1553_ENDPOINT ()
+//-------------------------------------------------------------------------
+{
+   endpoint.Close ();
+}
+
+//-------------------------------------------------------------------------
+void   BUS1553_ENDPOINT::Initialize     (typ_return &result)
+//-------------------------------------------------------------------------
+{
+   char  endpoint_name[TOKEN_SIZE], transport[TOKEN_SIZE], *name_token[1], *transport_token[1];
+
+   result = Nominal;
+   endpoint.Close ();
+   memset (&Y, '\0', sizeof(Y));
+
+   /* ********************************************************
+   * ENDPOINT
+   ***********************************************************/
+   endpoint_name[0]   = '\0';
+   name_token[0]      = endpoint_name;
+   strcpy (transport, "SHM");
+   transport_token[0] = transport;
+   if (input_file->load (name_token, Name, "ENDPOINT_NAME", 1) == Error)
+      result = Error;
+   input_file->load (transport_token, Name, "TRANSPORT", 1, false);
+   if (!strcmp (transport, "SHM"))
+      P.transport = Bus1553Ipc::Shared_Memory;
+   else if (!strcmp (transport, "SOCKET"))
+      P.transport = Bus1553Ipc::Socket;
+   else
+   {
+      Log_Error ("%s : TRANSPORT \"%s\" is not valid (SHM or SOCKET)", Name, transport);
+      result = Error;
+   }
+   P.wait_time = 0.0;
+   input_file->load (&P.wait_time, Name, "WAIT_TIME", 1, false);
+   if (P.wait_time < 0.0)
+      P.wait_time = 0.0;
+
+   if (result == Nominal && endpoint.Open (endpoint_name, P.transport) == Error)
+   {
+      Log_Error ("%s : unable to open the \"%s\" 1553 endpoint (%s)", Name, endpoint_name, transport);
+      result = Error;
+   }
+   OFF_ON_Switch_Status = On;
+
+   // Publish the OUTPUT data
+   Publish (&Y.transactions,          1, "Y.transactions",          "");
+   Publish (&Y.batches,               1, "Y.batches",               "");
+   Publish (&Y.no_responses,          1, "Y.no_responses",          "");
+   Publish (&Y.invalid_transactions,  1, "Y.invalid_transactions",  "");
+   Publish (&Y.missed_batches,        1, "Y.missed_batches",        "");
+   Publish (&Y.service_time,          1, "Y.service_time",          "s");
+
+   if (result == Nominal)
+      Log_Message ("%s : 1553 endpoint \"%s\" open (%s, wait time %g s)", Name, endpoint_name, transport, P.wait_time);
+}
+
+//-------------------------------------------------------------------------
+void   BUS1553_ENDPOINT::Update         (typ_return &result, double time, bool is_the_final_updating)
+//-------------------------------------------------------------------------
+{
+   double   start;
+
+   result = Nominal;
+   if (!is_the_final_updating || Get_off_on () != On || !endpoint.Is_Open ())
+      return;
+
+   // Lock-step: serve the batch of the step, waiting for it up to WAIT_TIME. Free-running: serve all the pending batches
+   start = Bus1553Ipc::Clock ();
+   if (P.wait_time > 0.0)
+   {
+      if (endpoint.Serve (P.wait_time) == 0)
+         Y.missed_batches += 1.0;
+   }
+   else while (endpoint.Serve (0.0) > 0)
+      ;
+   Y.service_time         = Bus1553Ipc::Clock () - start;
+   Y.transactions         = (double) endpoint.transactions;
+   Y.batches              = (double) endpoint.batches;
+   Y.no_responses         = (double) endpoint.no_responses;
+   Y.invalid_transactions = (double) endpoint.invalid;
+}
@@ -0,0 +1,106 @@
+#if !defined(__BUS1553_ENDPOINT_h) // Sentry, use file only if it's not already included.
+#define __BUS1553_ENDPOINT_h
+
+/******************************************************************************
+*
+*    PROJECT:      DSS - S/C Dynamics Simulation Software
+*    FILE:         BUS1553_ENDPOINT.h
+*    RELEASE:      0.01
+*    AUTHOR:       DSS Team
+*    DATE:         2026/10/19
+*
+*    OVERVIEW
+*    ========
+*    Header file for the BUS1553_ENDPOINT Model: local IPC endpoint letting
+*    an external MIL-STD-1553B Bus Controller (e.g. a flight-software
+*    emulator running as a separate process on the same host, linked to
+*    the Bus1553Client library) submit batches of 1553 transactions to the
+*    simulated RTs.
+*    At each final updating the pending batches are served by the RT
+*    dispatch table (GenericObject::Bc1553_*), on the simulation thread.
+*    With a positive WAIT_TIME the Model waits up to WAIT_TIME for the
+*    batch of the step, which keeps the external BC and the simulation in
+*    lock-step (one batch per minor frame).
+*
+*    SET FILE PARAMETERS
+*    ===================
+*       <Name>.ENDPOINT_NAME       = endpoint name (shared memory object "/<name>", or abstract socket "\0<name>")
+*       <Name>.TRANSPORT           = SHM or SOCKET                     (optional, default SHM)
+*       <Name>.WAIT_TIME           = wait time for a batch at each step [s] (optional, default 0: no wait)
+*
+*    CHANGE LOG
+*    ==========
+*
+******************************************************************************/
+
+#include "../dss_level_1/GenericObject.h"
+#include "../dss_level_1/Bus1553Endpoint.h"
+
+/**
+* Class definition for the BUS 1553 external Bus Controller Endpoint Model.
+*/
+
+class BUS1553_ENDPOINT : public GenericObject
+{
+
+/*-------------------------------------------------------------------------
+   Data Type Definition
+-------------------------------------------------------------------------*/
+
+public:
+
+   struct typ_status /** Type STATUS shall be mandatory implemented (eventually empty) at BUS1553_ENDPOINT HW Model */
+   {
+   };
+
+   struct typ_input /** Type INPUT shall be mandatory implemented (eventually empty) at BUS1553_ENDPOINT HW Model */
+   {
+   };
+
+   struct typ_output /** Type OUTPUT shall be mandatory implemented (eventually empty) at BUS1553_ENDPOINT HW Model */
+   {
+      double transactions;          //!< Number of the served transactions
+      double batches;               //!< Number of the served batches
+      double no_responses;          //!< Number of the transactions addressed to a not present RT
+      double invalid_transactions;  //!< Number of the invalid transactions
+      double missed_batches;        //!< Number of the steps without batch within WAIT_TIME (WAIT_TIME > 0 only)
+      double service_time;          //!< Wall-clock time spent serving the last step, waiting included [s]
+   };
+
+   struct typ_parameters  /** Type PARAMETER shall be mandatory implemented (eventually empty) at BUS1553_ENDPOINT HW Model */
+   {
+      Bus1553Ipc::typ_transport  transport;   //!< IPC transport
+      double                     wait_time;   //!< Wait time for a batch at each step [s]
+   };
+
+/*-------------------------------------------------------------------------
+   Data declarations
+-------------------------------------------------------------------------*/
+
+public:
+
+   typ_status     X;       //!< STATUS X shall be mandatory instanciated at Level 2 HW Model
+   typ_status     Xdot;    //!< STATUS DERIVATIVE Xdot shall be mandatory instanciated at Level 2 HW Model
+   typ_input      U;       //!< INPUT  U shall be mandatory instanciated at Level 2 HW Model
+   typ_output     Y;       //!< OUTPUT Y shall be mandatory instanciated at Level 2 HW Model
+   typ_parameters P;       //!< PARAMETER P shall be mandatory instanciated at Level 2 HW Model
+
+private:
+
+   Bus1553Endpoint   endpoint;         //!< Simulator side of the IPC endpoint
+
+/*-------------------------------------------------------------------------
+   Function declarations
+-------------------------------------------------------------------------*/
+
+public:
+
+   BUS1553_ENDPOINT (const char* ModelName);
+   ~BUS1553_ENDPOINT ();
+
+   void   Initialize     (typ_return &result);
+   void   Update         (typ_return &result, double time, bool is_the_final_updating = true);
+
+};
+
+#endif // __BUS1553_ENDPOINT_h sentry.
@@ -37,6 +37,36 @@
    in order to correctly avaluate the ARW noise value and all the model outputs.
    The Y.w_meas is in unit reference frame
    *******************************************************************
+
+   *******************************************************************
+   DSS Team 2026/10/19
+   SET_DATA_VALIDITY_BIT and SET_GO_NOG_BIT moved from "Local_Parser" to the
+   table-driven "Local_Command"; "Local_Parser" only reports the not allowed commands
+   *******************************************************************
+   DSS Team 2026/10/19
+   Debug messages through the DSS_TRACE/DSS_DEBUG macros (no formatting when
+   debug is disabled); fixed the ARW_noise array printed as a double
+   *******************************************************************
+   DSS Team 2026/10/19
+   High rate condition and not implemented subaddress warnings rate-limited
+   (DSS_WARNING): they were logged at each step or bus transaction
+   *******************************************************************
+   DSS Team 2026/10/19
+   Added "Reconfigure": the changed set file parameters are reloaded by
+   "Load_Parameters" (moved out of "Initialize") without resetting the unit
+   *******************************************************************
+   DSS Team 2026/10/19
+   The angular velocity is projected on the unit axes by the fixed-size
+   Mat3 product (LinearAlgebra.h) instead of the generic MAT_PROD loop
+   *******************************************************************
+   DSS Team 2026/10/19
+   ARW and QWN noise drawn from the Model "Random_Stream" (reproducible,
+   thread-safe) instead of "RandomNormal" (global rand())
+   *******************************************************************
+   DSS Team 2026/10/19
+   "Reconfigure" returns Error and keeps the previous parameters when the
+   reloaded ones cannot be read (not parsed or missing mandatory symbols)
+   *******************************************************************
    
 ******************************************************************************/
 #include "GYRO_HONEYWELL.h"
@@ -45,6 +75,16 @@
 #include <cmath>
 #include "MathLib.h"
 
+// Static Data Initialization
+
+const CommandTable::typ_CommandSchema GYRO_HONEYWELL::Command_Schemas[] =
+{
+   {"SET_DATA_VALIDITY_BIT",  Cmd_Set_Data_Validity_Bit, "i"},
+   {"SET_GO_NOG_BIT",         Cmd_Set_Go_Nog_Bit,        "i"},
+   {NULL,                     0,                         NULL}
+};
+const CommandTable GYRO_HONEYWELL::Command_Table (Command_Schemas);
+
 //-------------------------------------------------------------------------
 GYRO_HONEYWELL::GYRO_HONEYWELL (const char *ModelName, int RT_Address)
        :GenericObject (ModelName, sizeof(GYRO_HONEYWELL) , sizeof(X), sizeof(U), sizeof(Y), &X, &Xdot, &U, &Y)
@@ -80,6 +120,55 @@ void   GYRO_HONEYWELL::Initialize     (typ_return &result)
    // Initialize ARW values
    memset(ARW_noise, '\0', sizeof(ARW_noise));
 
+   Load_Parameters ();
+
+   /* ********************************************************
+   *   FIRST OUTPUT RATE
+   ***********************************************************/   
+   if( input_file->load (Y.w_meas, "SC_ANGULAR_RATE", 3, false) ){
+      for(int i=0; i<3; i++)
+         Y.w_meas[i] = Y.w_meas[i]*DEG2RAD;
+   }
+   
+   //Initialize wrap around data words
+   for(int i=0; i<32; i++)
+      crgs_wrap_around_words[i] = 0x0000;
+   
+   // Publish the INPUT array data
+   Publish (U.omega,        3,    "U.omega_BRF",   "rad/s");
+
+   // Publish the OUTPUT array data
+   Publish ( Y.angle_LSB,                    3,   "Y.angle_LSB", "");
+   Publish (&Y.frame_timer_200Hz,            1,   "Y.frame_timer_200Hz", "");
+   Publish ( Y.w_meas,                       3,   "Y.w_meas", "rad/s");
+   Publish (&Y.health_status_bits,           1,   "Y.health_status_bits", "");
+   
+}
+
+//-------------------------------------------------------------------------
+void   GYRO_HONEYWELL::Reconfigure    (typ_return &result, int n_parameters, const char* parameters[])
+//-------------------------------------------------------------------------
+{
+   typ_parameters previous_P = P;
+   int            previous_errors = input_file->error;
+
+   // The unit status, time counters and health bits are kept, only the parameters are reloaded
+   result = Nominal;
+   Load_Parameters ();
+   if (input_file->error > previous_errors) // Not parsed or missing symbols: the previous parameters are kept
+   {
+      P      = previous_P;
+      result = Error;
+      Log_Error ("%s.GYRO_HONEYWELL::Reconfigure : %i errors reading the parameters, the previous ones are kept", Name, input_file->error - previous_errors);
+      return;
+   }
+   DSS_TRACE ("%s.GYRO_HONEYWELL::Reconfigure --- %i parameters changed, bias = %f, ARW = %f", Name, n_parameters, P.bias, P.ARW_noise);
+}
+
+//-------------------------------------------------------------------------
+void   GYRO_HONEYWELL::Load_Parameters ()
+//-------------------------------------------------------------------------
+{
    /* *********************************************************************************
    * READS CHANNEL PARAMETERS FROM SET FILE
    **********************************************************************************/
@@ -127,27 +216,6 @@ void   GYRO_HONEYWELL::Initialize     (typ_return &result)
    *   GYRO POSITION WRT SC
    ***********************************************************/   
    input_file->load (P.p_sc,      Name, "POSITION_WRT_SC", 3); 
-   /* ********************************************************
-   *   FIRST OUTPUT RATE
-   ***********************************************************/   
-   if( input_file->load (Y.w_meas, "SC_ANGULAR_RATE", 3, false) ){
-      for(int i=0; i<3; i++)
-         Y.w_meas[i] = Y.w_meas[i]*DEG2RAD;
-   }
-   
-   //Initialize wrap around data words
-   for(int i=0; i<32; i++)
-      crgs_wrap_around_words[i] = 0x0000;
-   
-   // Publish the INPUT array data
-   Publish (U.omega,        3,    "U.omega_BRF",   "rad/s");
-
-   // Publish the OUTPUT array data
-   Publish ( Y.angle_LSB,                    3,   "Y.angle_LSB", "");
-   Publish (&Y.frame_timer_200Hz,            1,   "Y.frame_timer_200Hz", "");
-   Publish ( Y.w_meas,                       3,   "Y.w_meas", "rad/s");
-   Publish (&Y.health_status_bits,           1,   "Y.health_status_bits", "");
-   
 }
 
 //-------------------------------------------------------------------------
@@ -168,12 +236,12 @@ void   GYRO_HONEYWELL::Status         (typ_return &result, double time)
    if(OFF_ON_Switch_Status==On){
       
       //PROJECTS ANGULAR VELOCITY ON GYRO ASSEMBLY AXES
-      result = MAT_PROD(&w_crgs_axes[0],&P.BRF2UNIT[0][0], U.omega, 3, 3, 1);
+      Vec3::View(w_crgs_axes) = Mat3::View(P.BRF2UNIT) * Vec3::View(U.omega);
 
       /* Check high rate condition*/
       if(w_crgs_axes[0] > CGRS_MAX_RATE || w_crgs_axes[1] > CGRS_MAX_RATE || w_crgs_axes[2] > CGRS_MAX_RATE)
       {
-         Log_Warning ("%s high rate condition is occurred", Name);   
+         DSS_WARNING ("%s high rate condition is occurred", Name);   
       }    
       
       /*********************************************************
@@ -227,7 +295,7 @@ void   GYRO_HONEYWELL::Status         (typ_return &result, double time)
       {
          Xdot.angle[i] = (w_crgs_axes[i] + K0 + ARW_noise[i]) / S0;
       }
-      Log_Debug ("%s.GYRO_HONEYWELL::Status --- ARW_noise = %f", Name, ARW_noise);   
+      DSS_TRACE ("%s.GYRO_HONEYWELL::Status --- ARW_noise = [%f %f %f]", Name, ARW_noise[0], ARW_noise[1], ARW_noise[2]);   
       
       /*********************************************************
       * MANAGE real rapresentation of the data values
@@ -267,7 +335,7 @@ void   GYRO_HONEYWELL::Update (typ_return &result, double time, bool is_the_fina
          {  
              ARW_noise[i] = ARW(P.ARW_noise,1.0/delta_time_at_last_update);
          }
-         Log_Debug ("%s.GYRO_HONEYWELL::Update --- delta_time_at_last_update = %f, ARW_noise = %f", Name, delta_time_at_last_update, ARW_noise);   
+         DSS_DEBUG ("%s.GYRO_HONEYWELL::Update --- delta_time_at_last_update = %f, ARW_noise = [%f %f %f]", Name, delta_time_at_last_update, ARW_noise[0], ARW_noise[1], ARW_noise[2]);   
          
          /* ********************************************************
          * Time counters update
@@ -382,22 +450,27 @@ void   GYRO_HONEYWELL::Update (typ_return &result, double time, bool is_the_fina
 void  GYRO_HONEYWELL::Local_Parser   (typ_return &result, char* model_command, int n_parameters, char* parameters[])
 //-------------------------------------------------------------------------
 {  
+   // Commands not declared in the Model Commands Table
    result = Error;
-   switch (toupper(model_command[0]))
+   Log_Warning ("Command string \"%s\" is not allowed for the Model \"%s\", or some of the \"%i\" parameters is wrong", model_command, Name, n_parameters);
+}
+
+//-------------------------------------------------------------------------
+void  GYRO_HONEYWELL::Local_Command  (typ_return &result, int command_id, int n_args, const CommandTable::typ_CommandArg args[])
+//-------------------------------------------------------------------------
+{  
+   result = Error;
+   switch (command_id)
     {
-        case 'S':
-            if (!strcmp (model_command, "SET_DATA_VALIDITY_BIT") && n_parameters == 1){
-               Health_Bits.hb.data_validity  = atoi(parameters[0]);
-               result                        = Nominal;
-            }
-            else if (!strcmp (model_command, "SET_GO_NOG_BIT") && n_parameters == 1){
-               Health_Bits.hb.GO_NOGO  = atoi(parameters[0]);
-               result                  = Nominal;
-            }
+        case Cmd_Set_Data_Validity_Bit:
+            Health_Bits.hb.data_validity  = args[0].i;
+            result                        = Nominal;
+            break;
+        case Cmd_Set_Go_Nog_Bit:
+            Health_Bits.hb.GO_NOGO  = args[0].i;
+            result                  = Nominal;
             break;
     }
-    if (result == Error)
-        Log_Warning ("Command string \"%s\" is not allowed for the Model \"%s\", or some of the \"%i\" parameters is wrong", model_command, Name, n_parameters);
 }
 
 //-------------------------------------------------------------------------
@@ -428,7 +501,7 @@ double GYRO_HONEYWELL::ARW(double arw, double sample_time)
    double sigma;
    // Convert ARW to sigma of White Noise
    sigma = (arw * Sqrt(sample_time)) * DEG2RAD /60; //rad/s
-   return RandomNormal(0,sigma);
+   return Random_Stream.Normal(0,sigma);
 }
 
 
@@ -440,7 +513,7 @@ double GYRO_HONEYWELL::QWN()
 * Create an Gaussian white noise to be add to the ANGULAR output in order to add 
 * the QUANTIZATION WHITE NOISE
 *******************************************************************************/
-   return RandomNormal(0,P.OUT_noise); //[('')/LSB]
+   return Random_Stream.Normal(0,P.OUT_noise); //[('')/LSB]
 }
 
 //-------------------------------------------------------------------------
@@ -469,13 +542,13 @@ typ_return GYRO_HONEYWELL::Rt1553_ReceiveData (const unsigned char Subaddress, c
                 else
                 {
                   result = Nominal;
-                  Log_Warning ("%s.RT Receiving Subaddress %d, wrong dataword numbers (DataWordCount = %d)", Name, Subaddress, DataWordCount);
+                  DSS_WARNING ("%s.RT Receiving Subaddress %d, wrong dataword numbers (DataWordCount = %d)", Name, Subaddress, DataWordCount);
                 }
             break;
             
 
             default:
-               Log_Warning ("%s.RT Receiving Subaddress %d is not implemented for the model.", Name, Subaddress);   
+               DSS_WARNING ("%s.RT Receiving Subaddress %d is not implemented for the model.", Name, Subaddress);   
             break;
         }
     }
@@ -563,7 +636,7 @@ typ_return GYRO_HONEYWELL::Rt1553_TransmitData (const unsigned char Subaddress,
                 else
                 {
                   result = Nominal;
-                  Log_Warning ("%s.RT Transmit Subaddress %d, wrong dataword numbers (DataWordCount = %d)", Name, Subaddress, DataWordCount);
+                  DSS_WARNING ("%s.RT Transmit Subaddress %d, wrong dataword numbers (DataWordCount = %d)", Name, Subaddress, DataWordCount);
                 }
             break;
             
@@ -587,7 +660,7 @@ typ_return GYRO_HONEYWELL::Rt1553_TransmitData (const unsigned char Subaddress,
             
             default:
                 result = Nominal;         
-                Log_Warning ("%s.RT Trasmitting Subaddress %d is not implemented for the model.", Name, Subaddress);   
+                DSS_WARNING ("%s.RT Trasmitting Subaddress %d is not implemented for the model.", Name, Subaddress);   
             break;
         }
 
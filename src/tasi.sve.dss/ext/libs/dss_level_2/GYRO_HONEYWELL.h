@@ -20,6 +20,14 @@
    F.Sabbioni 11/04/2012
    Added Wrap around TC/TM (B1553 Rx/Tx transactions)  
    *******************************************************************
+   DSS Team 2026/10/19
+   SET_DATA_VALIDITY_BIT and SET_GO_NOG_BIT declared in the Model Commands Table
+   (typed arguments validated when queued) and executed by "Local_Command"
+   *******************************************************************
+   DSS Team 2026/10/19
+   Added "Reconfigure" (live configuration reload), the set file parameters are
+   read by "Load_Parameters"
+   *******************************************************************
 *    ==========
 *
 ******************************************************************************/
@@ -115,6 +123,12 @@ public:
 
 #endif
 
+   enum typ_command  /** Identifiers of the GYRO_HONEYWELL Model commands */
+   {
+      Cmd_Set_Data_Validity_Bit = 1,   //!< SET_DATA_VALIDITY_BIT,flag
+      Cmd_Set_Go_Nog_Bit               //!< SET_GO_NOG_BIT,flag
+   };
+
 /*-------------------------------------------------------------------------
    Data declarations
 -------------------------------------------------------------------------*/
@@ -150,6 +164,11 @@ public:
    
    // ARW value (calculated in Status and used in Update)
    double   ARW_noise[3];
+
+protected:
+
+   static const CommandTable::typ_CommandSchema Command_Schemas[];   //!< Schemas of the GYRO_HONEYWELL Model commands
+   static const CommandTable                    Command_Table;       //!< Perfect-hash table of the GYRO_HONEYWELL Model commands
    
 /*-------------------------------------------------------------------------
    Function declarations
@@ -161,10 +180,13 @@ public:
    ~GYRO_HONEYWELL ();
 
    void   Initialize     (typ_return &result);                 
+   void   Reconfigure    (typ_return &result, int n_parameters, const char* parameters[]);
    void   Get_Input      (typ_return &result, double time, bool is_the_first_getinput = true);                                                
    void   Status         (typ_return &result, double time);                                                
    void   Update         (typ_return &result, double time, bool is_the_final_updating = true);             
    void   Local_Parser   (typ_return &result, char* model_command, int n_parameters, char* parameters[]);
+   void   Local_Command  (typ_return &result, int command_id, int n_args, const CommandTable::typ_CommandArg args[]);
+   const CommandTable* Get_Command_Table () {return &Command_Table;};
 
    typ_return Command_Switch_ON();  
 
@@ -178,6 +200,8 @@ protected:
    double      ARW            (double arw, double sampleFreq); //!< Return Angular Random Walk noise
    /** Compute Output White Noise*/
    double      QWN            ();                           //!< Return Quantization Withe Noise
+   /** Read the set file parameters*/
+   void        Load_Parameters ();                          //!< Read the P parameters from "input_file"
    
 };
 
@@ -12,6 +12,8 @@
 *
 *   CHANGE LOG
 *   ==========
+*   DSS Team       2026/10/19  "Concurrent_Update_Flag" set: the Model updating touches its own
+*                              data only, it can be first updated concurrently with the other Models.
 *
 ******************************************************************************/
 #include "SUM.h"
@@ -49,6 +51,8 @@ SUM::SUM (const char* ModelName, int nIn)
    // Publish the OUTPUT array data
    Publish (&Y.sum,         1,   "Y.sum", "");
 
+   Concurrent_Update_Flag = true; // The updating touches the Model data only
+
 }
 
 //-------------------------------------------------------------------------
@@ -0,0 +1,145 @@
+/******************************************************************************
+
+    PROJECT:      DSS - S/C Dynamics Simulation Software
+    FILE:         Bus1553Decode.cpp
+    RELEASE:      0.01
+    AUTHOR:       DSS Team
+    DATE:         2026/10/19
+
+    OVERVIEW
+    ========
+    Standalone decoder of the binary BUS 1553 recordings ("1553_dump_*.bin")
+    written by the Bus1553Recorder (ENABLE_1553_LOG static command).
+    The records are printed in the 1553 text dump format:
+
+       <Model>.ReceiveData <RT>,<SA>\t\t<word>\t<word>\t...
+       <Model>.TransmitData <RT>,<SA>\t\t<word>\t<word>\t...
+       <Model>.ReceiveModeCommand <RT>,<MC>,<T/R>\t\t<word>\t...
+
+    USAGE
+    =====
+       bus1553_decode [-t] [-r rt_mask] [-s sa_mask] recording.bin [output.txt]
+
+       -t          prefix each line with the simulation time [s]
+       -r, -s      RT and subaddress masks (decimal, 0x or '#' hexadecimal)
+                   further selecting the recorded transactions
+
+    Build: g++ -I../ext/libs/dss_level_1 Bus1553Decode.cpp -o bus1553_decode
+
+    CHANGE LOG
+    ==========
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Bus1553Recorder.h"
+
+//-------------------------------------------------------------------------
+static unsigned long Parse_Mask (const char *text)
+//-------------------------------------------------------------------------
+{
+   return (*text == '#') ? strtoul (text+1, NULL, 16) : strtoul (text, NULL, 0);
+}
+
+//-------------------------------------------------------------------------
+int main (int argc, char *argv[])
+//-------------------------------------------------------------------------
+{
+   Bus1553Recorder::typ_Header   header;
+   Bus1553Recorder::typ_Record   record;
+   static char                   names[BUS1553_RECORDER_MAX_MODELS][sizeof(record.words)+1];
+   const char                    *input_name = NULL, *output_name = NULL, *name;
+   unsigned long                 rt_mask = 0xFFFFFFFF, sa_mask = 0xFFFFFFFF;
+   unsigned long long            n;
+   bool                          print_time = false;
+   FILE                          *input, *output = stdout;
+   int                           i, sa;
+
+// Command line
+   for (i = 1; i < argc; i++)
+   {
+      if (!strcmp (argv[i], "-t"))
+         print_time = true;
+      else if (!strcmp (argv[i], "-r") && i+1 < argc)
+         rt_mask = Parse_Mask (argv[++i]);
+      else if (!strcmp (argv[i], "-s") && i+1 < argc)
+         sa_mask = Parse_Mask (argv[++i]);
+      else if (!input_name)
+         input_name = argv[i];
+      else if (!output_name)
+         output_name = argv[i];
+      else
+         input_name = NULL, i = argc;
+   }
+   if (!input_name)
+   {
+      fprintf (stderr, "usage: %s [-t] [-r rt_mask] [-s sa_mask] recording.bin [output.txt]\n", argv[0]);
+      return 2;
+   }
+
+// Check the recording header
+   input = fopen (input_name, "rb");
+   if (!input)
+   {
+      fprintf (stderr, "%s: unable to open \"%s\"\n", argv[0], input_name);
+      return 1;
+   }
+   if (fread (&header, sizeof(header), 1, input) != 1
+    || memcmp (header.magic, BUS1553_RECORDER_MAGIC, 8)
+    || header.version != BUS1553_RECORDER_VERSION
+    || header.record_size != sizeof(record)
+    || fseek (input, BUS1553_RECORDER_HEADER_SIZE, SEEK_SET))
+   {
+      fprintf (stderr, "%s: \"%s\" is not a BUS 1553 recording (version %d)\n", argv[0], input_name, BUS1553_RECORDER_VERSION);
+      fclose (input);
+      return 1;
+   }
+   if (output_name && !(output = fopen (output_name, "wt")))
+   {
+      fprintf (stderr, "%s: unable to open for writing \"%s\"\n", argv[0], output_name);
+      fclose (input);
+      return 1;
+   }
+
+// Decode the valid records (the file can be longer if the recording has not been closed)
+   for (n = 0; n < header.n_records && fread (&record, sizeof(record), 1, input) == 1; n++)
+   {
+      if (record.transaction == Bus1553Recorder::Model_Name)
+      {
+         if (record.model < BUS1553_RECORDER_MAX_MODELS)
+            memcpy (names[record.model], record.words, sizeof(record.words));
+         continue;
+      }
+      sa = (record.transaction == Bus1553Recorder::Mode_Command) ? B1553_MODE_FIELD_CODE : record.sa;
+      if (!((rt_mask >> (record.rt & 31)) & (sa_mask >> (sa & 31)) & 1))
+         continue;
+      name = (record.model < BUS1553_RECORDER_MAX_MODELS) ? names[record.model] : "?";
+
+      if (print_time)
+         fprintf (output, "% 12.3f ", record.time);
+      switch (record.transaction)
+      {
+         case Bus1553Recorder::Receive_Data:
+            fprintf (output, "%s.ReceiveData %d,%d\t\t", name, record.rt, record.sa);
+            break;
+         case Bus1553Recorder::Transmit_Data:
+            fprintf (output, "%s.TransmitData %d,%d\t\t", name, record.rt, record.sa);
+            break;
+         default:
+            fprintf (output, "%s.ReceiveModeCommand %d,%d,%c\t\t", name, record.rt, record.sa, record.tx_rx ? 'T' : 'R');
+            break;
+      }
+      for (i = 0; i < record.word_count && i < 32; i++)
+         fprintf (output, "%04X\t", record.words[i]);
+      fprintf (output, "\n");
+   }
+
+   if (n < header.n_records)
+      fprintf (stderr, "%s: \"%s\" truncated, %llu of %llu records decoded\n", argv[0], input_name, n, header.n_records);
+   fclose (input);
+   if (output != stdout)
+      fclose (output);
+   return 0;
+}
@@ -0,0 +1,223 @@
+/******************************************************************************
+
+    PROJECT:      DSS - S/C Dynamics Simulation Software
+    FILE:         QuatBatchCheck.cpp
+    RELEASE:      0.01
+    AUTHOR:       DSS Team
+    DATE:         2026/10/19
+
+    OVERVIEW
+    ========
+    Standalone check of the batched (structure of arrays) quaternion functions
+    of MathLib against their scalar counterparts:
+
+       QUAT_PROP_BATCH         vs  QUAT_PROP        (positive and negative dT, zero rates included)
+       QUAT_TO_ROT_BATCH       vs  QUAT_TO_ROT      (matrices and normalized quaternions)
+       QUAT_COMPOSE_BATCH      vs  QUAT_COMPOSE
+       CONTINUITY_QUAT_BATCH   vs  CONTINUITY_QUAT  (with and without "assign_q_old")
+
+    The quaternions are pseudo-random (fixed seed), in an odd number so that
+    both the SSE2 kernels (pairs) and the scalar tail are exercised. Every
+    output component shall match within CHECK_TOLERANCE (absolute, the
+    compared values being of order 1).
+
+    USAGE
+    =====
+       quat_batch_check
+
+       Prints the maximum difference of each function; the exit status is 0
+       if all the functions are within the tolerance, 1 otherwise.
+
+    Build: g++ -I../ext/libs/dss_level_1 QuatBatchCheck.cpp ../ext/libs/dss_level_1/MathLib.cpp -o quat_batch_check
+
+    CHANGE LOG
+    ==========
+
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "MathLib.h"
+
+#define  CHECK_N                 1001                 // Number of the quaternions (odd)
+#define  CHECK_TOLERANCE         1.0e-12              // Maximum allowed absolute difference
+
+static double  Q[4][CHECK_N], Q_2[4][CHECK_N], Q_old[4][CHECK_N], W[3][CHECK_N], Q_out[4][CHECK_N], R[3][3][CHECK_N];
+
+//-------------------------------------------------------------------------
+static double Random (double lower, double upper)
+//-------------------------------------------------------------------------
+{
+   return lower + (upper - lower) * rand () / (double) RAND_MAX;
+}
+
+//-------------------------------------------------------------------------
+static void Random_Quaternions (double q[4][CHECK_N])
+//-------------------------------------------------------------------------
+{
+   double   norm;
+   int      i, j;
+
+   for (i = 0; i < CHECK_N; i++)
+   {
+      for (norm = 0., j = 0; j < 4; j++)
+      {
+         q[j][i] = Random (-1., 1.);
+         norm   += q[j][i] * q[j][i];
+      }
+      for (j = 0; j < 4; j++)
+         q[j][i] /= sqrt (norm);
+   }
+}
+
+//-------------------------------------------------------------------------
+static bool Report (const char *name, double max_difference)
+//-------------------------------------------------------------------------
+{
+   bool  passed = max_difference <= CHECK_TOLERANCE;
+
+   printf ("%-32s max difference %.3e  %s\n", name, max_difference, passed ? "OK" : "FAILED");
+   return passed;
+}
+
+//-------------------------------------------------------------------------
+static bool Check_Quat_Prop (double dT)
+//-------------------------------------------------------------------------
+{
+   double      *q_in[4] = {Q[0], Q[1], Q[2], Q[3]}, *q_out[4] = {Q_out[0], Q_out[1], Q_out[2], Q_out[3]}, *w[3] = {W[0], W[1], W[2]};
+   double      q[4], w_i[3], q_i[4], max_difference = 0.;
+   typ_return  result;
+   char        name[64];
+   int         i, j;
+
+   QUAT_PROP_BATCH (result, CHECK_N, q_in, w, dT, q_out);
+   for (i = 0; i < CHECK_N; i++)
+   {
+      for (j = 0; j < 4; j++)
+         q_i[j] = Q[j][i];
+      for (j = 0; j < 3; j++)
+         w_i[j] = W[j][i];
+      QUAT_PROP (result, q_i, w_i, dT, q);
+      for (j = 0; j < 4; j++)
+         max_difference = fmax (max_difference, fabs (q[j] - Q_out[j][i]));
+   }
+   snprintf (name, sizeof(name), "QUAT_PROP_BATCH (dT=%+g)", dT);
+   return Report (name, max_difference);
+}
+
+//-------------------------------------------------------------------------
+static bool Check_Quat_To_Rot ()
+//-------------------------------------------------------------------------
+{
+   double   *q[4] = {Q_out[0], Q_out[1], Q_out[2], Q_out[3]}, *r[3][3], R_i[3][3], q_i[4], max_difference = 0.;
+   int      i, j, k;
+
+// Not normalized input quaternions, both functions normalize them
+   for (i = 0; i < CHECK_N; i++)
+      for (j = 0; j < 4; j++)
+         Q_out[j][i] = 1.5 * Q[j][i];
+   for (j = 0; j < 3; j++)
+      for (k = 0; k < 3; k++)
+         r[j][k] = R[j][k];
+
+   QUAT_TO_ROT_BATCH (CHECK_N, r, q);
+   for (i = 0; i < CHECK_N; i++)
+   {
+      for (j = 0; j < 4; j++)
+         q_i[j] = 1.5 * Q[j][i];
+      QUAT_TO_ROT (R_i, q_i);
+      for (j = 0; j < 4; j++)
+         max_difference = fmax (max_difference, fabs (q_i[j] - Q_out[j][i]));
+      for (j = 0; j < 3; j++)
+         for (k = 0; k < 3; k++)
+            max_difference = fmax (max_difference, fabs (R_i[j][k] - R[j][k][i]));
+   }
+   return Report ("QUAT_TO_ROT_BATCH", max_difference);
+}
+
+//-------------------------------------------------------------------------
+static bool Check_Quat_Compose ()
+//-------------------------------------------------------------------------
+{
+   double   *q_1[4] = {Q[0], Q[1], Q[2], Q[3]}, *q_2[4] = {Q_2[0], Q_2[1], Q_2[2], Q_2[3]}, *q_out[4] = {Q_out[0], Q_out[1], Q_out[2], Q_out[3]};
+   double   q[4], q_1i[4], q_2i[4], max_difference = 0.;
+   int      i, j;
+
+   QUAT_COMPOSE_BATCH (CHECK_N, q_out, q_1, q_2);
+   for (i = 0; i < CHECK_N; i++)
+   {
+      for (j = 0; j < 4; j++)
+      {
+         q_1i[j] = Q[j][i];
+         q_2i[j] = Q_2[j][i];
+      }
+      QUAT_COMPOSE (q, q_1i, q_2i);
+      for (j = 0; j < 4; j++)
+         max_difference = fmax (max_difference, fabs (q[j] - Q_out[j][i]));
+   }
+   return Report ("QUAT_COMPOSE_BATCH", max_difference);
+}
+
+//-------------------------------------------------------------------------
+static bool Check_Continuity_Quat (bool assign_q_old)
+//-------------------------------------------------------------------------
+{
+   double      *q_dot[4] = {Q_out[0], Q_out[1], Q_out[2], Q_out[3]}, *q_old[4] = {Q_old[0], Q_old[1], Q_old[2], Q_old[3]};
+   double      q_dot_i[4], q_old_i[4], max_difference = 0.;
+   typ_return  result;
+   char        name[64];
+   int         i, j;
+
+// Previous quaternions close to the current ones, one out of three current quaternions with the opposite sign
+   for (i = 0; i < CHECK_N; i++)
+      for (j = 0; j < 4; j++)
+      {
+         Q_2[j][i]   = Q[j][i] + Random (-0.01, 0.01);
+         Q_old[j][i] = Q_2[j][i];
+         Q_out[j][i] = (i % 3) ? Q[j][i] : -Q[j][i];
+      }
+
+   CONTINUITY_QUAT_BATCH (result, CHECK_N, q_dot, q_old, assign_q_old);
+   for (i = 0; i < CHECK_N; i++)
+   {
+      for (j = 0; j < 4; j++)
+      {
+         q_dot_i[j] = (i % 3) ? Q[j][i] : -Q[j][i];
+         q_old_i[j] = Q_2[j][i];
+      }
+      CONTINUITY_QUAT (result, q_dot_i, q_old_i, assign_q_old);
+      for (j = 0; j < 4; j++)
+      {
+         max_difference = fmax (max_difference, fabs (q_dot_i[j] - Q_out[j][i]));
+         max_difference = fmax (max_difference, fabs (q_old_i[j] - Q_old[j][i]));
+      }
+   }
+   snprintf (name, sizeof(name), "CONTINUITY_QUAT_BATCH (%s)", assign_q_old ? "assign" : "no assign");
+   return Report (name, max_difference);
+}
+
+//-------------------------------------------------------------------------
+int main ()
+//-------------------------------------------------------------------------
+{
+   bool  passed = true;
+   int   i, j;
+
+   srand (1);
+   Random_Quaternions (Q);
+   Random_Quaternions (Q_2);
+   for (i = 0; i < CHECK_N; i++)
+      for (j = 0; j < 3; j++)
+         W[j][i] = (i % 10) ? Random (-0.5, 0.5) : 0.; // Zero rates included
+
+   passed &= Check_Quat_Prop (0.1);
+   passed &= Check_Quat_Prop (-0.1);
+   passed &= Check_Quat_To_Rot ();
+   passed &= Check_Quat_Compose ();
+   passed &= Check_Continuity_Quat (false);
+   passed &= Check_Continuity_Quat (true);
+
+   printf ("%s (tolerance %.1e)\n", passed ? "PASSED" : "FAILED", CHECK_TOLERANCE);
+   return passed ? 0 : 1;
+}